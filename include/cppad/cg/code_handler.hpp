@@ -141,6 +141,8 @@ protected:
     bool _used;
     // a flag indicating whether or not to reuse the IDs of destroyed variables
     bool _reuseIDs;
+    // a flag indicating whether or not to reorder operations to reduce the number of live temporaries
+    bool _minimizeLiveTemps;
     // scope color/index counter
     ScopeIDType _scopeColorCount;
     // the current scope color/index counter
@@ -197,6 +199,24 @@ public:
      */
     inline bool isReuseVariableIDs() const;
 
+    /**
+     * Defines whether or not to reorder operations, before reusing variable
+     * IDs, so that the number of temporary variables which are alive at
+     * the same time is reduced.
+     * Released temporary variable IDs are also reused starting from the
+     * lowest ones so that the most used temporaries are kept close together.
+     * This option is only used when variable IDs are reused.
+     *
+     * @param minimize whether or not to reorder operations
+     */
+    inline void setMinimizeLiveTemporaries(bool minimize);
+
+    /**
+     * Whether or not operations are reordered in order to reduce the number
+     * of temporary variables alive at the same time.
+     */
+    inline bool isMinimizeLiveTemporaries() const;
+
     /**
      * Marks the provided variables as being independent variables.
      *
@@ -419,6 +439,14 @@ public:
 
     size_t getTemporaryVariableCount() const;
 
+    /**
+     * Provides an estimate of the number of operations performed by the
+     * source code created in the last call to generateCode().
+     * It can be used to balance the work of multithreaded evaluations
+     * before any timing information is available.
+     */
+    size_t getOperationCount() const;
+
     size_t getTemporaryArraySize() const;
 
     size_t getTemporarySparseArraySize() const;
@@ -718,6 +746,52 @@ protected:
     inline void repositionEvaluationQueue(size_t fromPos,
                                           size_t toPos);
 
+    /**
+     * Reorders the operations in the evaluation queue so that the number
+     * of temporary variables which are alive at the same time is reduced.
+     * Only sequences of simple operations (without scope changes, arrays,
+     * atomic functions, loop indexed variables, ...) are reordered.
+     */
+    inline void scheduleOperations();
+
+    /**
+     * Reorders a sequence of simple operations in the evaluation queue
+     * using a greedy list scheduling algorithm which gives priority to
+     * operations which release temporary variables.
+     *
+     * @param begin the position of the first operation in the evaluation queue
+     * @param end the position after the last operation in the evaluation queue
+     * @param preds the positions of the variables used by each variable
+     * @param succs the positions of the variables which use each variable
+     * @param remainingUses the number of variables still to be evaluated
+     *                      which use each variable
+     */
+    inline void scheduleOperations(size_t begin,
+                                   size_t end,
+                                   const std::vector<std::vector<size_t> >& preds,
+                                   const std::vector<std::vector<size_t> >& succs,
+                                   std::vector<size_t>& remainingUses);
+
+    /**
+     * Determines the positions in the evaluation queue of the variables
+     * used by a variable (including those used by its right hand side
+     * operations which do not create variables).
+     *
+     * @param node the variable in the evaluation queue
+     * @param preds where the positions are saved
+     * @param inlined if not null, where the operations which do not create
+     *                variables are saved
+     */
+    inline void findEvaluationPredecessors(Node& node,
+                                           std::vector<size_t>& preds,
+                                           std::vector<Node*>* inlined);
+
+    /**
+     * Whether or not an operation can be freely moved in the evaluation
+     * queue (as long as the variables it uses are evaluated before).
+     */
+    inline static bool isSchedulable(const Node& node);
+
     /**
      * Determines when each temporary variable is last used in the
      * evaluation order
@@ -893,6 +967,7 @@ protected:
     friend class CGAbstractAtomicFun<Base>;
     friend class BaseAbstractAtomicFun<Base>;
     friend class LoopModel<Base>;
+    friend class GraphBinaryReader<Base>;
 
 };
 
@@ -38,6 +38,7 @@ CodeHandler<Base>::CodeHandler(size_t varCount) :
         _atomicFunctionsOrder(nullptr),
         _used(false),
         _reuseIDs(true),
+        _minimizeLiveTemps(false),
         _scopeColorCount(0),
         _currentScopeColor(0),
         _lang(nullptr),
@@ -72,6 +73,16 @@ inline bool CodeHandler<Base>::isReuseVariableIDs() const {
     return _reuseIDs;
 }
 
+template<class Base>
+inline void CodeHandler<Base>::setMinimizeLiveTemporaries(bool minimize) {
+    _minimizeLiveTemps = minimize;
+}
+
+template<class Base>
+inline bool CodeHandler<Base>::isMinimizeLiveTemporaries() const {
+    return _minimizeLiveTemps;
+}
+
 template<class Base>
 inline void CodeHandler<Base>::makeVariables(std::vector<AD<CGB> >& variables) {
     for (auto& v : variables) {
@@ -271,9 +282,11 @@ void CodeHandler<Base>::generateCode(std::ostream& out,
                                      const std::string& jobName) {
     using namespace std::chrono;
     steady_clock::time_point beginTime;
+    std::ostream::pos_type beginPos = -1;
 
     if (_jobTimer != nullptr) {
         _jobTimer->startingJob("source for '" + jobName + "'");
+        beginPos = out.tellp();
     } else if (_verbose) {
         std::cout << "generating source for '" << jobName << "' ... ";
         std::cout.flush();
@@ -463,6 +476,10 @@ void CodeHandler<Base>::generateCode(std::ostream& out,
     _alteredNodes.clear();
 
     if (_jobTimer != nullptr) {
+        _jobTimer->addNodeCount(getManagedNodesCount());
+        std::ostream::pos_type endPos = out.tellp();
+        if (beginPos != std::ostream::pos_type(-1) && endPos != std::ostream::pos_type(-1))
+            _jobTimer->addSourceBytes(size_t(endPos - beginPos));
         _jobTimer->finishedJob();
     } else if (_verbose) {
         OStreamConfigRestore osr(std::cout);
@@ -479,6 +496,15 @@ size_t CodeHandler<Base>::getTemporaryVariableCount() const {
         return _idCount - _minTemporaryVarID;
 }
 
+template<class Base>
+size_t CodeHandler<Base>::getOperationCount() const {
+    size_t total = 0;
+    for (const Node* node : _variableOrder) {
+        total += _operationCount[*node];
+    }
+    return total;
+}
+
 template<class Base>
 size_t CodeHandler<Base>::getTemporaryArraySize() const {
     return _idArrayCount - 1;
@@ -1635,6 +1661,10 @@ inline void CodeHandler<Base>::addToEvaluationQueue(Node& arg) {
 template<class Base>
 inline void CodeHandler<Base>::reduceTemporaryVariables(ArrayView<CGB>& dependent) {
 
+    if (_minimizeLiveTemps) {
+        scheduleOperations();
+    }
+
     reorderOperations(dependent);
 
     /**
@@ -1668,6 +1698,7 @@ inline void CodeHandler<Base>::reduceTemporaryVariables(ArrayView<CGB>& dependen
      * Redefine temporary variable IDs
      */
     std::vector<size_t> freedVariables; // variable IDs no longer in use
+    auto idGreater = std::greater<size_t>();
     _idCount = _minTemporaryVarID;
     ArrayIdCompresser<Base> arrayComp(_varId, _idArrayCount);
     ArrayIdCompresser<Base> sparseArrayComp(_varId, _idSparseArrayCount);
@@ -1679,6 +1710,10 @@ inline void CodeHandler<Base>::reduceTemporaryVariables(ArrayView<CGB>& dependen
         for (size_t r = 0; r < released.size(); r++) {
             if (isTemporary(*released[r])) {
                 freedVariables.push_back(_varId[*released[r]]);
+                if (_minimizeLiveTemps) {
+                    // lowest IDs are reused first
+                    std::push_heap(freedVariables.begin(), freedVariables.end(), idGreater);
+                }
             } else if (isTemporaryArray(*released[r])) {
                 arrayComp.addFreeArraySpace(*released[r]);
             } else if (isTemporarySparseArray(*released[r])) {
@@ -1692,6 +1727,9 @@ inline void CodeHandler<Base>::reduceTemporaryVariables(ArrayView<CGB>& dependen
                 _varId[var] = _idCount;
                 _idCount++;
             } else {
+                if (_minimizeLiveTemps) {
+                    std::pop_heap(freedVariables.begin(), freedVariables.end(), idGreater);
+                }
                 size_t id = freedVariables.back();
                 freedVariables.pop_back();
                 _varId[var] = id;
@@ -1869,6 +1907,249 @@ inline void CodeHandler<Base>::repositionEvaluationQueue(size_t fromPos, size_t
     updateEvaluationQueueOrder(*node, toPos);
 }
 
+template<class Base>
+inline void CodeHandler<Base>::scheduleOperations() {
+    size_t nv = _variableOrder.size();
+
+    /**
+     * determine the dependencies between variables in the evaluation queue
+     */
+    std::vector<std::vector<size_t> > preds(nv);
+    std::vector<std::vector<size_t> > succs(nv);
+    std::vector<size_t> remainingUses(nv, 0);
+
+    for (size_t p = 0; p < nv; ++p) {
+        findEvaluationPredecessors(*_variableOrder[p], preds[p], nullptr);
+        for (size_t d : preds[p]) {
+            succs[d].push_back(p);
+            remainingUses[d]++;
+        }
+    }
+
+    /**
+     * reorder sequences of simple operations
+     */
+    size_t p = 0;
+    while (p < nv) {
+        if (!isSchedulable(*_variableOrder[p])) {
+            for (size_t d : preds[p])
+                remainingUses[d]--;
+            ++p;
+            continue;
+        }
+
+        size_t end = p + 1;
+        while (end < nv && isSchedulable(*_variableOrder[end]))
+            ++end;
+
+        if (end - p > 2) {
+            scheduleOperations(p, end, preds, succs, remainingUses);
+        } else {
+            for (size_t l = p; l < end; ++l) {
+                for (size_t d : preds[l])
+                    remainingUses[d]--;
+            }
+        }
+
+        p = end;
+    }
+}
+
+template<class Base>
+inline void CodeHandler<Base>::scheduleOperations(size_t begin,
+                                                  size_t end,
+                                                  const std::vector<std::vector<size_t> >& preds,
+                                                  const std::vector<std::vector<size_t> >& succs,
+                                                  std::vector<size_t>& remainingUses) {
+    size_t n = end - begin;
+
+    // ready operations sorted by priority: (-score, -step of the most recently evaluated argument, position)
+    using Key = std::tuple<long, long, size_t>;
+    std::set<Key> ready;
+
+    std::vector<size_t> missing(n, 0); // number of arguments in the sequence which were not evaluated yet
+    std::vector<long> score(n, 0); // number of released temporaries minus the created temporary
+    std::vector<long> recent(n, -1); // the step when the most recent argument was evaluated
+    std::vector<bool> done(n, false);
+
+    auto isTmp = [&](size_t pos) {
+        return isTemporary(*_variableOrder[pos]);
+    };
+
+    for (size_t l = 0; l < n; ++l) {
+        size_t pos = begin + l;
+        if (isTmp(pos))
+            score[l]--;
+        for (size_t d : preds[pos]) {
+            if (d >= begin && d < end)
+                missing[l]++;
+            if (remainingUses[d] == 1 && isTmp(d))
+                score[l]++; // the only operation still using this temporary
+        }
+        if (missing[l] == 0)
+            ready.insert(Key(-score[l], 1, pos));
+    }
+
+    std::vector<Node*> newOrder;
+    newOrder.reserve(n);
+
+    for (long step = 0; !ready.empty(); ++step) {
+        Key key = *ready.begin();
+        ready.erase(ready.begin());
+
+        size_t pos = std::get<2>(key);
+        size_t l = pos - begin;
+        done[l] = true;
+        newOrder.push_back(_variableOrder[pos]);
+
+        for (size_t d : preds[pos]) {
+            size_t& uses = remainingUses[d];
+            uses--;
+            if (uses == 1 && isTmp(d)) {
+                // the last operation using this temporary will now release it
+                for (size_t s : succs[d]) {
+                    if (s < begin || s >= end || done[s - begin])
+                        continue;
+                    size_t ls = s - begin;
+                    if (missing[ls] == 0) {
+                        ready.erase(Key(-score[ls], -recent[ls], s));
+                        score[ls]++;
+                        ready.insert(Key(-score[ls], -recent[ls], s));
+                    } else {
+                        score[ls]++;
+                    }
+                }
+            }
+        }
+
+        for (size_t s : succs[pos]) {
+            if (s < begin || s >= end)
+                continue;
+            size_t ls = s - begin;
+            recent[ls] = step;
+            missing[ls]--;
+            if (missing[ls] == 0) {
+                ready.insert(Key(-score[ls], -recent[ls], s));
+            }
+        }
+    }
+
+    CPPADCG_ASSERT_UNKNOWN(newOrder.size() == n)
+
+    /**
+     * update the evaluation order
+     * (operations which do not create variables must be determined before
+     *  any change)
+     */
+    std::vector<std::vector<Node*> > inlined(n);
+    std::vector<size_t> aux;
+    for (size_t l = 0; l < n; ++l) {
+        findEvaluationPredecessors(*_variableOrder[begin + l], aux, &inlined[l]);
+    }
+
+    for (size_t l = 0; l < n; ++l) {
+        Node* node = newOrder[l];
+        size_t oldPos = getEvaluationOrder(*node) - 1;
+        size_t newPos = begin + l;
+        _variableOrder[newPos] = node;
+        setEvaluationOrder(*node, newPos + 1);
+        for (Node* i : inlined[oldPos - begin]) {
+            setEvaluationOrder(*i, newPos + 1);
+        }
+    }
+}
+
+template<class Base>
+inline void CodeHandler<Base>::findEvaluationPredecessors(Node& node,
+                                                          std::vector<size_t>& preds,
+                                                          std::vector<Node*>* inlined) {
+    size_t order = getEvaluationOrder(node);
+    preds.clear();
+
+    startNewOperationTreeVisit();
+    markVisited(node);
+
+    std::vector<Node*> stack{&node};
+
+    while (!stack.empty()) {
+        Node* n = stack.back();
+        stack.pop_back();
+
+        for (const Arg& a : n->getArguments()) {
+            if (a.getOperation() == nullptr)
+                continue;
+
+            Node& arg = *a.getOperation();
+            if (isVisited(arg))
+                continue;
+            markVisited(arg);
+
+            if (arg.getOperationType() == CGOpCode::Index) {
+                size_t iorder = getEvaluationOrder(static_cast<IndexOperationNode<Base>&> (arg).getIndexCreationNode());
+                if (iorder > 0 && iorder < order)
+                    preds.push_back(iorder - 1);
+                continue;
+            }
+
+            size_t argOrder = getEvaluationOrder(arg);
+            if (argOrder == order) {
+                // does not create a variable (evaluated together with node)
+                if (inlined != nullptr)
+                    inlined->push_back(&arg);
+                stack.push_back(&arg);
+            } else if (argOrder > 0 && argOrder < order) {
+                preds.push_back(argOrder - 1);
+            }
+        }
+    }
+
+    std::sort(preds.begin(), preds.end());
+    preds.erase(std::unique(preds.begin(), preds.end()), preds.end());
+}
+
+template<class Base>
+inline bool CodeHandler<Base>::isSchedulable(const Node& node) {
+    switch (node.getOperationType()) {
+        case CGOpCode::Assign:
+        case CGOpCode::Abs:
+        case CGOpCode::Acos:
+        case CGOpCode::Acosh:
+        case CGOpCode::Add:
+        case CGOpCode::Asin:
+        case CGOpCode::Asinh:
+        case CGOpCode::Atan:
+        case CGOpCode::Atanh:
+        case CGOpCode::ComLt:
+        case CGOpCode::ComLe:
+        case CGOpCode::ComEq:
+        case CGOpCode::ComGe:
+        case CGOpCode::ComGt:
+        case CGOpCode::ComNe:
+        case CGOpCode::Cosh:
+        case CGOpCode::Cos:
+        case CGOpCode::Div:
+        case CGOpCode::Erf:
+        case CGOpCode::Erfc:
+        case CGOpCode::Exp:
+        case CGOpCode::Expm1:
+        case CGOpCode::Log:
+        case CGOpCode::Log1p:
+        case CGOpCode::Mul:
+        case CGOpCode::Pow:
+        case CGOpCode::Sign:
+        case CGOpCode::Sinh:
+        case CGOpCode::Sin:
+        case CGOpCode::Sqrt:
+        case CGOpCode::Sub:
+        case CGOpCode::Tanh:
+        case CGOpCode::Tan:
+        case CGOpCode::UnMinus:
+            return true;
+        default:
+            return false;
+    }
+}
+
 template<class Base>
 inline void CodeHandler<Base>::determineLastTempVarUsage(Node& root) {
 
@@ -23,6 +23,7 @@
 #include <array>
 #include <assert.h>
 #include <cstddef>
+#include <cstdint>
 #include <errno.h>
 #include <fstream>
 #include <iomanip>
@@ -46,7 +47,11 @@
 #include <string.h>
 #include <chrono>
 #include <thread>
+#include <tuple>
+#include <type_traits>
 #include <functional>
+#include <future>
+#include <mutex>
 
 // ---------------------------------------------------------------------------
 // operating system detection
@@ -118,6 +123,7 @@
 #include <cppad/cg/atomic_dependency_locator.hpp>
 #include <cppad/cg/variable_name_generator.hpp>
 #include <cppad/cg/job_timer.hpp>
+#include <cppad/cg/job_profiler.hpp>
 #include <cppad/cg/lang/language.hpp>
 #include <cppad/cg/lang/lang_stream_stack.hpp>
 #include <cppad/cg/scope_path_element.hpp>
@@ -165,6 +171,8 @@
 #include <cppad/cg/solver.hpp>
 #include <cppad/cg/collect_variable.hpp>
 #include <cppad/cg/graph_mod.hpp>
+#include <cppad/cg/graph_sparsity.hpp>
+#include <cppad/cg/graph_binary.hpp>
 #include <cppad/cg/operation_node_name_streambuf.hpp>
 
 // ---------------------------------------------------------------------------
@@ -189,12 +197,14 @@
 
 // ---------------------------------------------------------------------------
 // C source code generation
+#include <cppad/cg/model/threadpool/multi_threading_type.hpp>
 #include <cppad/cg/lang/c/lang_c_atomic_fun.hpp>
 #include <cppad/cg/lang/c/language_c.hpp>
 #include <cppad/cg/lang/c/language_c_arrays.hpp>
 #include <cppad/cg/lang/c/language_c_index_patterns.hpp>
 #include <cppad/cg/lang/c/language_c_double.hpp>
 #include <cppad/cg/lang/c/language_c_float.hpp>
+#include <cppad/cg/lang/c/language_c_single_precision.hpp>
 #include <cppad/cg/lang/c/language_c_loops.hpp>
 #include <cppad/cg/lang/c/lang_c_default_var_name_gen.hpp>
 #include <cppad/cg/lang/c/lang_c_default_hessian_var_name_gen.hpp>
@@ -203,16 +213,21 @@
 #include <cppad/cg/lang/c/lang_c_util.hpp>
 
 //
-#include <cppad/cg/model/threadpool/multi_threading_type.hpp>
 #include <cppad/cg/model/threadpool/thread_pool_schedule_strategy.hpp>
+#include <cppad/cg/model/threadpool/thread_pool_affinity.hpp>
+#include <cppad/cg/model/threadpool/thread_pool_executor.hpp>
+#include <cppad/cg/model/threadpool/thread_pool_profile.hpp>
 #include <cppad/cg/model/external_function_wrapper.hpp>
 #include <cppad/cg/model/atomic_external_function_wrapper.hpp>
 #include <cppad/cg/model/generic_model_external_function_wrapper.hpp>
 #include <cppad/cg/model/model_library_processor.hpp>
 #include <cppad/cg/model/model_library.hpp>
+#include <cppad/cg/model/bound_model_function.hpp>
 #include <cppad/cg/model/generic_model.hpp>
 #include <cppad/cg/model/functor_generic_model.hpp>
 #include <cppad/cg/model/functor_model_library.hpp>
+#include <cppad/cg/model/versioned_model_library.hpp>
+#include <cppad/cg/model/versioned_model.hpp>
 #include <cppad/cg/model/save_files_model_library_processor.hpp>
 
 // automated static library creation
@@ -230,6 +245,7 @@
 #include <cppad/cg/model/threadpool/pthread_pool_h.hpp>
 #include <cppad/cg/model/threadpool/openmp_c.hpp>
 #include <cppad/cg/model/threadpool/openmp_h.hpp>
+#include <cppad/cg/model/sparsity_cache.hpp>
 #include <cppad/cg/model/model_c_source_gen.hpp>
 #include <cppad/cg/model/model_c_source_gen_impl.hpp>
 #include <cppad/cg/model/model_library_c_source_gen.hpp>
@@ -237,6 +253,7 @@
 
 #include <cppad/cg/model/model_c_source_gen_for0.hpp>
 #include <cppad/cg/model/model_c_source_gen_for1.hpp>
+#include <cppad/cg/model/model_c_source_gen_for_taylor.hpp>
 #include <cppad/cg/model/model_c_source_gen_rev1.hpp>
 #include <cppad/cg/model/model_c_source_gen_rev2.hpp>
 #include <cppad/cg/model/model_c_source_gen_jac.hpp>
@@ -256,6 +273,11 @@
 #include <cppad/cg/model/dynamic_lib/dynamiclib.hpp>
 #include <cppad/cg/model/dynamic_lib/dynamic_library_processor.hpp>
 
+// automated creation of libraries linked directly into applications
+#include <cppad/cg/model/static_lib/static_lib_model.hpp>
+#include <cppad/cg/model/static_lib/static_lib.hpp>
+#include <cppad/cg/model/static_lib/static_library_processor.hpp>
+
 // ---------------------------------------------------------------------------
 // automated dynamic library creation for Linux
 #include <cppad/cg/model/dynamic_lib/linux/linux_dynamiclib_model.hpp>
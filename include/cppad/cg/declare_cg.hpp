@@ -71,6 +71,9 @@ class BidirGraph;
 template<class Base>
 class ScopePathElement;
 
+template<class Base>
+class GraphBinaryReader;
+
 /***************************************************************************
  * Nodes
  **************************************************************************/
@@ -125,6 +128,9 @@ class LangStreamOperation;
 template<class Base>
 class LanguageC;
 
+template<class Base>
+class LanguageCSinglePrecision;
+
 template<class Base>
 class VariableNameGenerator;
 
@@ -140,12 +146,21 @@ class LangCCustomVariableNameGenerator;
 template<class Base>
 class GenericModel;
 
+template<class Base>
+class BoundModelFunction;
+
 template<class Base>
 class ModelLibraryProcessor;
 
 template<class Base>
 class FunctorGenericModel;
 
+template<class Base>
+class VersionedModelLibrary;
+
+template<class Base>
+class VersionedModel;
+
 /***************************************************************************
  * Dynamic model compilation
  **************************************************************************/
@@ -162,6 +177,12 @@ class ModelCSourceGen;
 template<class Base>
 class ModelLibraryCSourceGen;
 
+template<class Base>
+class StaticLibModel;
+
+template<class Base>
+class StaticLib;
+
 #if CPPAD_CG_SYSTEM_LINUX
 template<class Base>
 class LinuxDynamicLibModel;
@@ -292,6 +313,24 @@ enum class JacobianADMode {
     Forward, Reverse, Automatic
 };
 
+/**
+ * The order of the non-zero elements of sparse matrices
+ */
+enum class SparseMatrixLayout {
+    Coordinate = 0, // no particular order
+    CompressedRow = 1, // ordered by row and then by column (CSR)
+    CompressedColumn = 2 // ordered by column and then by row (CSC)
+};
+
+/**
+ * The elements of a symmetric matrix which are stored
+ */
+enum class MatrixTriangle {
+    Full = 0, // all elements
+    Lower = 1, // elements in the diagonal and below it
+    Upper = 2 // elements in the diagonal and above it
+};
+
 /**
  * Index pattern types
  */
@@ -0,0 +1,843 @@
+#ifndef CPPAD_CG_GRAPH_BINARY_INCLUDED
+#define CPPAD_CG_GRAPH_BINARY_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+#if CPPAD_CG_SYSTEM_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * The layout of the binary files used to save operation graphs
+ * (see GraphBinaryWriter and GraphBinaryReader).
+ *
+ * A file starts with a Header followed by these sections (each one starts
+ * at a multiple of 8 bytes):
+ *  - the node records (independent variables first; the arguments of a
+ *    node always appear before that node),
+ *  - the information values of all nodes (uint64_t),
+ *  - the arguments of all nodes (uint64_t, see PARAMETER),
+ *  - the parameter values (Base),
+ *  - the dependent variables (uint64_t, same encoding as arguments),
+ *  - the atomic function records,
+ *  - the strings (null terminated).
+ *
+ * Values are saved in the native representation of the machine so that a
+ * memory mapped file can be used directly without any conversion.
+ */
+class GraphBinaryFormat {
+public:
+    static const uint32_t VERSION = 1;
+    static const uint32_t ENDIANNESS = 0x01020304;
+    /**
+     * Bit used in arguments and dependents to distinguish parameter
+     * indexes from node indexes
+     */
+    static const uint64_t PARAMETER = uint64_t(1) << 63;
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t endianness;
+        uint32_t baseSize;
+        uint32_t reserved;
+        uint64_t independents;
+        uint64_t nodes;
+        uint64_t dependents;
+        uint64_t info;
+        uint64_t arguments;
+        uint64_t parameters;
+        uint64_t atomics;
+        uint64_t strings;
+    };
+
+    struct NodeRecord {
+        uint64_t op;
+        /// index of the first information value
+        uint64_t info;
+        uint64_t infoSize;
+        /// index of the first argument
+        uint64_t args;
+        uint64_t argsSize;
+        /// string references (offset + 1 or zero if there is no string)
+        uint64_t name;
+        uint64_t before;
+        uint64_t after;
+    };
+
+    struct AtomicRecord {
+        /// the atomic function ID used in the saved graph
+        uint64_t id;
+        /// string reference
+        uint64_t name;
+    };
+
+    static inline const char* magic() {
+        return "CGGRAPH";
+    }
+
+    static inline size_t padding(size_t bytes) {
+        return (8 - bytes % 8) % 8;
+    }
+
+    /**
+     * Whether or not an operation can be saved (independent variables
+     * are saved separately).
+     * Operations used by loops, by conditional branches created during
+     * source generation and custom operations are not supported.
+     */
+    static inline bool isSupported(CGOpCode op) {
+        switch (op) {
+            case CGOpCode::Inv:
+            case CGOpCode::DependentMultiAssign:
+            case CGOpCode::DependentRefRhs:
+            case CGOpCode::IndexDeclaration:
+            case CGOpCode::Index:
+            case CGOpCode::IndexAssign:
+            case CGOpCode::LoopStart:
+            case CGOpCode::LoopIndexedIndep:
+            case CGOpCode::LoopIndexedDep:
+            case CGOpCode::LoopIndexedTmp:
+            case CGOpCode::LoopEnd:
+            case CGOpCode::TmpDcl:
+            case CGOpCode::Tmp:
+            case CGOpCode::IndexCondExpr:
+            case CGOpCode::StartIf:
+            case CGOpCode::ElseIf:
+            case CGOpCode::Else:
+            case CGOpCode::EndIf:
+            case CGOpCode::CondResult:
+            case CGOpCode::UserCustom:
+            case CGOpCode::NumberOp:
+                return false;
+            default:
+                return true;
+        }
+    }
+};
+
+/**
+ * A read-only view of the contents of a file.
+ * The file is memory mapped when supported by the system, otherwise it is
+ * read into memory.
+ */
+class MappedFile {
+private:
+    const char* data_;
+    size_t size_;
+    /// the mapped memory (nullptr if the file was not mapped)
+    void* map_;
+    /// the file contents if it could not be mapped
+    std::vector<uint64_t> buffer_;
+public:
+
+    /**
+     * @param fileName the file path
+     * @throws CGException if the file could not be opened
+     */
+    inline explicit MappedFile(const std::string& fileName) :
+        data_(nullptr),
+        size_(0),
+        map_(nullptr) {
+#if CPPAD_CG_SYSTEM_LINUX
+        int fd = ::open(fileName.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw CGException("Failed to open '", fileName, "': ", strerror(errno));
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw CGException("Failed to determine the size of '", fileName, "': ", strerror(errno));
+        }
+        size_ = size_t(st.st_size);
+
+        if (size_ > 0) {
+            void* m = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (m == MAP_FAILED) {
+                throw CGException("Failed to map '", fileName, "': ", strerror(errno));
+            }
+            map_ = m;
+            data_ = static_cast<const char*>(m);
+        } else {
+            ::close(fd);
+        }
+#else
+        std::ifstream in(fileName, std::ios::binary | std::ios::ate);
+        if (!in.is_open()) {
+            throw CGException("Failed to open '", fileName, "'");
+        }
+        size_ = size_t(in.tellg());
+        in.seekg(0);
+        buffer_.resize((size_ + 7) / 8); // 8 byte alignment
+        in.read(reinterpret_cast<char*>(buffer_.data()), size_);
+        if (!in) {
+            throw CGException("Failed to read '", fileName, "'");
+        }
+        data_ = reinterpret_cast<const char*>(buffer_.data());
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    inline const char* data() const {
+        return data_;
+    }
+
+    inline size_t size() const {
+        return size_;
+    }
+
+    inline virtual ~MappedFile() {
+#if CPPAD_CG_SYSTEM_LINUX
+        if (map_ != nullptr) {
+            ::munmap(map_, size_);
+        }
+#endif
+    }
+};
+
+/**
+ * Saves an operation graph of a CodeHandler using a binary format which can
+ * be loaded later by GraphBinaryReader (e.g. in a different process)
+ * without the code which created the model.
+ *
+ * Only the nodes used by the dependent variables are saved.
+ * Graphs with loops (and their index patterns) or custom operations are
+ * not supported (see GraphBinaryFormat::isSupported()).
+ * Atomic functions are saved by name and must be provided again when the
+ * graph is loaded.
+ */
+template<class Base>
+class GraphBinaryWriter {
+    static_assert(std::is_trivially_copyable<Base>::value, "Parameters are saved using their memory representation");
+    static_assert(alignof(Base) <= 8, "Unsupported parameter alignment");
+public:
+    using Node = OperationNode<Base>;
+    using Format = GraphBinaryFormat;
+public:
+
+    /**
+     * Saves an operation graph.
+     *
+     * @param out the output stream (it should be opened in binary mode)
+     * @param handler the code handler which owns the nodes
+     * @param independents the independent variables
+     * @param dependents the dependent variables
+     * @throws CGException if the graph contains unsupported operations
+     */
+    static inline void write(std::ostream& out,
+                             const CodeHandler<Base>& handler,
+                             const std::vector<CG<Base> >& independents,
+                             const std::vector<CG<Base> >& dependents) {
+        std::vector<const Node*> nodes;
+        std::map<const Node*, uint64_t> index;
+
+        for (const CG<Base>& x : independents) {
+            const Node* node = x.getOperationNode();
+            CPPADCG_ASSERT_KNOWN(node != nullptr && node->getOperationType() == CGOpCode::Inv,
+                                 "Invalid independent variable")
+            index[node] = nodes.size();
+            nodes.push_back(node);
+        }
+
+        sortNodes(dependents, nodes, index);
+
+        /**
+         * sections
+         */
+        std::vector<Format::NodeRecord> records(nodes.size());
+        std::vector<uint64_t> info;
+        std::vector<uint64_t> args;
+        std::vector<Base> params;
+        std::string strings;
+        std::set<size_t> atomicIds;
+
+        auto addString = [&strings](const std::string& s) -> uint64_t {
+            uint64_t ref = strings.size() + 1;
+            strings.append(s);
+            strings.push_back('\0');
+            return ref;
+        };
+
+        auto encode = [&](const Node* node, const Base* param) -> uint64_t {
+            if (node != nullptr)
+                return index.at(node);
+            params.push_back(*param);
+            return (params.size() - 1) | Format::PARAMETER;
+        };
+
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            const Node& node = *nodes[i];
+            Format::NodeRecord& r = records[i];
+            CGOpCode op = node.getOperationType();
+
+            r.op = uint64_t(op);
+            r.info = info.size();
+            r.infoSize = node.getInfo().size();
+            info.insert(info.end(), node.getInfo().begin(), node.getInfo().end());
+
+            r.args = args.size();
+            r.argsSize = node.getArguments().size();
+            for (const Argument<Base>& a : node.getArguments()) {
+                args.push_back(encode(a.getOperation(), a.getParameter()));
+            }
+
+            r.name = node.getName() != nullptr ? addString(*node.getName()) : 0;
+            r.before = 0;
+            r.after = 0;
+            if (op == CGOpCode::Pri) {
+                const auto& print = static_cast<const PrintOperationNode<Base>&>(node);
+                r.before = addString(print.getBeforeString());
+                r.after = addString(print.getAfterString());
+            } else if (op == CGOpCode::AtomicForward || op == CGOpCode::AtomicReverse) {
+                CPPADCG_ASSERT_KNOWN(!node.getInfo().empty(), "Invalid atomic function call")
+                atomicIds.insert(node.getInfo()[0]);
+            }
+        }
+
+        std::vector<uint64_t> deps;
+        deps.reserve(dependents.size());
+        for (const CG<Base>& y : dependents) {
+            if (y.getOperationNode() != nullptr) {
+                deps.push_back(encode(y.getOperationNode(), nullptr));
+            } else {
+                deps.push_back(encode(nullptr, &y.getValue()));
+            }
+        }
+
+        std::vector<Format::AtomicRecord> atomics;
+        const auto& registered = handler.getAtomicFunctions();
+        for (size_t id : atomicIds) {
+            auto it = registered.find(id);
+            if (it == registered.end() || it->second == nullptr) {
+                throw CGException("Unknown atomic function with ID ", id);
+            }
+            atomics.push_back(Format::AtomicRecord{uint64_t(id), addString(it->second->atomic_name())});
+        }
+
+        /**
+         * output
+         */
+        Format::Header h;
+        memset(&h, 0, sizeof(h));
+        memcpy(h.magic, Format::magic(), 8);
+        h.version = Format::VERSION;
+        h.endianness = Format::ENDIANNESS;
+        h.baseSize = sizeof(Base);
+        h.independents = independents.size();
+        h.nodes = records.size();
+        h.dependents = deps.size();
+        h.info = info.size();
+        h.arguments = args.size();
+        h.parameters = params.size();
+        h.atomics = atomics.size();
+        h.strings = strings.size();
+
+        writeSection(out, &h, sizeof(h));
+        writeSection(out, records.data(), records.size() * sizeof(Format::NodeRecord));
+        writeSection(out, info.data(), info.size() * sizeof(uint64_t));
+        writeSection(out, args.data(), args.size() * sizeof(uint64_t));
+        writeSection(out, params.data(), params.size() * sizeof(Base));
+        writeSection(out, deps.data(), deps.size() * sizeof(uint64_t));
+        writeSection(out, atomics.data(), atomics.size() * sizeof(Format::AtomicRecord));
+        writeSection(out, strings.data(), strings.size());
+
+        if (!out) {
+            throw CGException("Failed to write the operation graph");
+        }
+    }
+
+    /**
+     * Saves an operation graph to a file.
+     *
+     * @see write()
+     */
+    static inline void save(const std::string& fileName,
+                            const CodeHandler<Base>& handler,
+                            const std::vector<CG<Base> >& independents,
+                            const std::vector<CG<Base> >& dependents) {
+        std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            throw CGException("Failed to create '", fileName, "'");
+        }
+        write(out, handler, independents, dependents);
+    }
+
+private:
+
+    /**
+     * Adds the nodes used by the dependents so that the arguments of each
+     * node appear before that node (without recursion).
+     */
+    static inline void sortNodes(const std::vector<CG<Base> >& dependents,
+                                 std::vector<const Node*>& nodes,
+                                 std::map<const Node*, uint64_t>& index) {
+        std::vector<std::pair<const Node*, size_t> > stack;
+        std::set<const Node*> visiting;
+
+        for (const CG<Base>& y : dependents) {
+            const Node* root = y.getOperationNode();
+            if (root == nullptr || index.find(root) != index.end() || visiting.find(root) != visiting.end())
+                continue;
+
+            visiting.insert(root);
+            stack.emplace_back(root, 0);
+
+            while (!stack.empty()) {
+                const Node* node = stack.back().first;
+                size_t a = stack.back().second;
+                const std::vector<Argument<Base> >& args = node->getArguments();
+
+                if (a < args.size()) {
+                    stack.back().second++;
+
+                    const Node* arg = args[a].getOperation();
+                    if (arg != nullptr && index.find(arg) == index.end() && visiting.find(arg) == visiting.end()) {
+                        visiting.insert(arg);
+                        stack.emplace_back(arg, 0);
+                    }
+                } else {
+                    CGOpCode op = node->getOperationType();
+                    if (op == CGOpCode::Inv) {
+                        throw CGException("The operation graph uses an independent variable which was not provided");
+                    } else if (!Format::isSupported(op)) {
+                        throw CGException("Unable to save an operation graph with the operation '", op, "'");
+                    }
+
+                    index[node] = nodes.size();
+                    nodes.push_back(node);
+                    stack.pop_back();
+                }
+            }
+        }
+    }
+
+    static inline void writeSection(std::ostream& out,
+                                    const void* data,
+                                    size_t bytes) {
+        static const char zeros[8] = {0};
+        if (bytes > 0) {
+            out.write(static_cast<const char*>(data), bytes);
+        }
+        out.write(zeros, Format::padding(bytes));
+    }
+};
+
+/**
+ * Loads operation graphs saved by GraphBinaryWriter into a CodeHandler.
+ *
+ * The saved data is read directly (e.g. from a MappedFile) without a
+ * parsing step into intermediate structures, however the nodes of the new
+ * graph are still created in the CodeHandler (loading is not zero-copy).
+ * The number of arguments and information values of each node are
+ * validated so that corrupted or untrusted files are rejected with a
+ * CGException.
+ * The loaded graph can then be used like any other graph (e.g. to generate
+ * source code or with an Evaluator).
+ */
+template<class Base>
+class GraphBinaryReader {
+    static_assert(std::is_trivially_copyable<Base>::value, "Parameters are saved using their memory representation");
+    static_assert(alignof(Base) <= 8, "Unsupported parameter alignment");
+public:
+    using Node = OperationNode<Base>;
+    using Format = GraphBinaryFormat;
+private:
+    const Format::Header* header_;
+    const Format::NodeRecord* nodes_;
+    const uint64_t* info_;
+    const uint64_t* args_;
+    const Base* params_;
+    const uint64_t* deps_;
+    const Format::AtomicRecord* atomics_;
+    const char* strings_;
+public:
+
+    /**
+     * @param data the saved graph which must remain valid while this
+     *             object is used (it must be aligned to 8 bytes)
+     * @param size the number of bytes in data
+     * @throws CGException if data does not contain a valid graph
+     */
+    inline GraphBinaryReader(const char* data,
+                             size_t size) {
+        if (data == nullptr || reinterpret_cast<uintptr_t>(data) % 8 != 0) {
+            throw CGException("Operation graph data must be aligned to 8 bytes");
+        }
+
+        size_t offset = 0;
+        header_ = section<Format::Header>(data, size, offset, 1);
+
+        const Format::Header& h = *header_;
+        if (memcmp(h.magic, Format::magic(), 8) != 0) {
+            throw CGException("Invalid operation graph file");
+        }
+        if (h.version != Format::VERSION) {
+            throw CGException("Unsupported operation graph version (", h.version, ")");
+        }
+        if (h.endianness != Format::ENDIANNESS || h.baseSize != sizeof(Base)) {
+            throw CGException("The operation graph was saved for a different machine or base type");
+        }
+        if (h.independents > h.nodes) {
+            throw CGException("Invalid number of independent variables in the operation graph");
+        }
+
+        nodes_ = section<Format::NodeRecord>(data, size, offset, h.nodes);
+        info_ = section<uint64_t>(data, size, offset, h.info);
+        args_ = section<uint64_t>(data, size, offset, h.arguments);
+        params_ = section<Base>(data, size, offset, h.parameters);
+        deps_ = section<uint64_t>(data, size, offset, h.dependents);
+        atomics_ = section<Format::AtomicRecord>(data, size, offset, h.atomics);
+        strings_ = section<char>(data, size, offset, h.strings);
+        if (h.strings > 0 && strings_[h.strings - 1] != '\0') {
+            throw CGException("Invalid strings in the operation graph");
+        }
+    }
+
+    /**
+     * @param file the file with the saved graph which must remain open
+     *             while this object is used
+     */
+    inline explicit GraphBinaryReader(const MappedFile& file) :
+        GraphBinaryReader(file.data(), file.size()) {
+    }
+
+    inline size_t getIndependentCount() const {
+        return header_->independents;
+    }
+
+    inline size_t getDependentCount() const {
+        return header_->dependents;
+    }
+
+    inline size_t getNodeCount() const {
+        return header_->nodes;
+    }
+
+    /**
+     * Provides the names of the atomic functions used by the graph which
+     * must be provided to load().
+     */
+    inline std::vector<std::string> getAtomicFunctionNames() const {
+        std::vector<std::string> names(header_->atomics);
+        for (size_t i = 0; i < names.size(); ++i) {
+            names[i] = getString(atomics_[i].name);
+        }
+        return names;
+    }
+
+    /**
+     * Creates the nodes of the saved graph.
+     *
+     * @param handler the code handler which will own the new nodes
+     * @param independents the new independent variables
+     * @param atomics the atomic functions used by the graph
+     * @return the dependent variables
+     * @throws CGException if the graph is invalid or an atomic function
+     *                     was not provided
+     */
+    inline std::vector<CG<Base> > load(CodeHandler<Base>& handler,
+                                       std::vector<CG<Base> >& independents,
+                                       const std::vector<CGAbstractAtomicFun<Base>*>& atomics = {}) const {
+        const Format::Header& h = *header_;
+
+        /**
+         * atomic functions
+         */
+        std::map<uint64_t, size_t> atomicIds;
+        for (size_t i = 0; i < h.atomics; ++i) {
+            const char* name = getString(atomics_[i].name);
+            CGAbstractAtomicFun<Base>* atomic = nullptr;
+            for (CGAbstractAtomicFun<Base>* a : atomics) {
+                if (a != nullptr && a->atomic_name() == name) {
+                    atomic = a;
+                    break;
+                }
+            }
+            if (atomic == nullptr) {
+                throw CGException("The atomic function '", name, "' used by the operation graph was not provided");
+            }
+
+            handler.registerAtomicFunction(*atomic);
+            atomicIds[atomics_[i].id] = atomic->getId();
+        }
+
+        /**
+         * nodes
+         */
+        std::vector<Node*> nodes(h.nodes);
+
+        independents.resize(h.independents);
+        handler.makeVariables(independents);
+
+        for (size_t i = 0; i < h.nodes; ++i) {
+            const Format::NodeRecord& r = nodes_[i];
+            if (r.op >= uint64_t(CGOpCode::NumberOp) ||
+                r.info > h.info || r.infoSize > h.info - r.info ||
+                r.args > h.arguments || r.argsSize > h.arguments - r.args) {
+                throw CGException("Invalid node in the operation graph");
+            }
+            CGOpCode op = CGOpCode(r.op);
+
+            if (i < h.independents) {
+                if (op != CGOpCode::Inv) {
+                    throw CGException("Invalid independent variable in the operation graph");
+                }
+                nodes[i] = independents[i].getOperationNode();
+
+            } else {
+                if (!Format::isSupported(op)) {
+                    throw CGException("Unsupported operation '", op, "' in the operation graph");
+                }
+
+                std::vector<size_t> info(info_ + r.info, info_ + r.info + r.infoSize);
+                if (op == CGOpCode::AtomicForward || op == CGOpCode::AtomicReverse) {
+                    if (info.empty() || atomicIds.find(info[0]) == atomicIds.end()) {
+                        throw CGException("Invalid atomic function call in the operation graph");
+                    }
+                    info[0] = atomicIds.at(info[0]);
+                }
+
+                std::vector<Argument<Base> > args;
+                args.reserve(r.argsSize);
+                for (size_t a = 0; a < r.argsSize; ++a) {
+                    uint64_t v = args_[r.args + a];
+                    if (v & Format::PARAMETER) {
+                        args.push_back(Argument<Base>(parameter(v)));
+                    } else if (v < i) {
+                        args.push_back(Argument<Base>(*nodes[v]));
+                    } else {
+                        throw CGException("Invalid argument in the operation graph");
+                    }
+                }
+
+                validateNode(op, info, args);
+
+                if (op == CGOpCode::Pri) {
+                    nodes[i] = handler.makePrintNode(getString(r.before), args[0], getString(r.after));
+                } else {
+                    nodes[i] = handler.makeNode(op, std::move(info), std::move(args));
+                }
+            }
+
+            if (r.name != 0) {
+                nodes[i]->setName(getString(r.name));
+            }
+        }
+
+        /**
+         * dependents
+         */
+        std::vector<CG<Base> > dependents(h.dependents);
+        for (size_t i = 0; i < h.dependents; ++i) {
+            uint64_t v = deps_[i];
+            if (v & Format::PARAMETER) {
+                dependents[i] = CG<Base>(parameter(v));
+            } else if (v < h.nodes) {
+                dependents[i] = CG<Base>(*nodes[v]);
+            } else {
+                throw CGException("Invalid dependent variable in the operation graph");
+            }
+        }
+
+        return dependents;
+    }
+
+private:
+
+    /**
+     * Checks the number of arguments and information values of a node
+     * against those created by CodeHandler and the atomic functions.
+     */
+    static inline void validateNode(CGOpCode op,
+                                    const std::vector<size_t>& info,
+                                    const std::vector<Argument<Base> >& args) {
+        bool valid;
+        switch (op) {
+            case CGOpCode::Abs:
+            case CGOpCode::Acos:
+            case CGOpCode::Acosh:
+            case CGOpCode::Alias:
+            case CGOpCode::Asin:
+            case CGOpCode::Asinh:
+            case CGOpCode::Assign:
+            case CGOpCode::Atan:
+            case CGOpCode::Atanh:
+            case CGOpCode::Cosh:
+            case CGOpCode::Cos:
+            case CGOpCode::Erf:
+            case CGOpCode::Erfc:
+            case CGOpCode::Exp:
+            case CGOpCode::Expm1:
+            case CGOpCode::Log:
+            case CGOpCode::Log1p:
+            case CGOpCode::Pri:
+            case CGOpCode::Sign:
+            case CGOpCode::Sinh:
+            case CGOpCode::Sin:
+            case CGOpCode::Sqrt:
+            case CGOpCode::Tanh:
+            case CGOpCode::Tan:
+            case CGOpCode::UnMinus:
+                valid = args.size() == 1 && info.empty() && areValues(args);
+                break;
+
+            case CGOpCode::Add:
+            case CGOpCode::Div:
+            case CGOpCode::Mul:
+            case CGOpCode::Pow:
+            case CGOpCode::Sub:
+                valid = args.size() == 2 && info.empty() && areValues(args);
+                break;
+
+            case CGOpCode::ComLt:
+            case CGOpCode::ComLe:
+            case CGOpCode::ComEq:
+            case CGOpCode::ComGe:
+            case CGOpCode::ComGt:
+            case CGOpCode::ComNe:
+                valid = args.size() == 4 && info.empty() && areValues(args);
+                break;
+
+            case CGOpCode::ArrayCreation:
+                valid = info.empty() && areValues(args);
+                break;
+
+            case CGOpCode::SparseArrayCreation:
+                // {size, index1, index2, ...}
+                valid = !info.empty() && info.size() == args.size() + 1 && areValues(args);
+                for (size_t k = 1; valid && k < info.size(); ++k) {
+                    valid = info[k] < info[0];
+                }
+                break;
+
+            case CGOpCode::ArrayElement:
+                // {index}; {array, atomic call}
+                valid = info.size() == 1 && args.size() == 2 &&
+                        args[0].getOperation() != nullptr && args[1].getOperation() != nullptr &&
+                        info[0] < arraySize(*args[0].getOperation()) &&
+                        (args[1].getOperation()->getOperationType() == CGOpCode::AtomicForward ||
+                         args[1].getOperation()->getOperationType() == CGOpCode::AtomicReverse);
+                break;
+
+            case CGOpCode::AtomicForward:
+                // {id, q, p}; {tx..., ty...}
+                valid = info.size() == 3 && info[1] <= info[2] && info[2] < args.size() &&
+                        args.size() == 2 * (info[2] + 1) && areArrays(args);
+                break;
+
+            case CGOpCode::AtomicReverse:
+                // {id, p}; {tx..., ty..., px..., py...}
+                valid = info.size() == 2 && info[1] < args.size() &&
+                        args.size() == 4 * (info[1] + 1) && areArrays(args);
+                break;
+
+            default:
+                valid = false;
+        }
+
+        if (!valid) {
+            throw CGException("Invalid operation '", op, "' in the operation graph");
+        }
+    }
+
+    static inline bool isArray(const Node* node) {
+        return node != nullptr &&
+                (node->getOperationType() == CGOpCode::ArrayCreation ||
+                 node->getOperationType() == CGOpCode::SparseArrayCreation);
+    }
+
+    /**
+     * Whether or not all the arguments are arrays (used by atomic
+     * function calls).
+     */
+    static inline bool areArrays(const std::vector<Argument<Base> >& args) {
+        for (const Argument<Base>& a : args) {
+            if (!isArray(a.getOperation()))
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * Whether or not all the arguments are scalar values (arrays and atomic
+     * function calls can only be used through ArrayElement).
+     */
+    static inline bool areValues(const std::vector<Argument<Base> >& args) {
+        for (const Argument<Base>& a : args) {
+            const Node* node = a.getOperation();
+            if (isArray(node) || (node != nullptr &&
+                                  (node->getOperationType() == CGOpCode::AtomicForward ||
+                                   node->getOperationType() == CGOpCode::AtomicReverse)))
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @return the number of elements of an array (zero if the node is not
+     *         an array)
+     */
+    static inline size_t arraySize(const Node& node) {
+        if (node.getOperationType() == CGOpCode::ArrayCreation)
+            return node.getArguments().size();
+        else if (node.getOperationType() == CGOpCode::SparseArrayCreation)
+            return node.getInfo()[0];
+        return 0;
+    }
+
+    template<class T>
+    static inline const T* section(const char* data,
+                                   size_t size,
+                                   size_t& offset,
+                                   uint64_t count) {
+        if (offset > size || count > (size - offset) / sizeof(T)) {
+            throw CGException("Truncated operation graph");
+        }
+        const T* s = reinterpret_cast<const T*>(data + offset);
+        size_t bytes = count * sizeof(T);
+        offset += bytes + Format::padding(bytes);
+        return s;
+    }
+
+    inline const Base& parameter(uint64_t v) const {
+        uint64_t p = v & ~Format::PARAMETER;
+        if (p >= header_->parameters) {
+            throw CGException("Invalid parameter in the operation graph");
+        }
+        return params_[p];
+    }
+
+    inline const char* getString(uint64_t ref) const {
+        if (ref == 0 || ref > header_->strings) {
+            throw CGException("Invalid string in the operation graph");
+        }
+        return strings_ + (ref - 1);
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
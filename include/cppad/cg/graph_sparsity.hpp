@@ -0,0 +1,468 @@
+#ifndef CPPAD_CG_GRAPH_SPARSITY_INCLUDED
+#define CPPAD_CG_GRAPH_SPARSITY_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Determines the Jacobian and Hessian sparsity patterns of a model by
+ * walking the operation graph recorded by a CodeHandler instead of using
+ * the sparsity sweeps of CppAD (ForSparseJac and RevSparseHes).
+ *
+ * The graph is only walked once in each direction:
+ *  - a forward pass determines the independent variables which affect each
+ *    node (the Jacobian sparsity pattern),
+ *  - a reverse pass determines the equations which use each node and adds
+ *    the second order interactions of nonlinear operations to the total
+ *    Hessian sparsity and to the Hessian sparsity of each equation.
+ *
+ * Index sets are kept sorted and are shared between nodes whenever an
+ * operation does not add new elements (e.g. chains of unary operations or
+ * sums with a common sub-expression), which avoids copying large sets.
+ *
+ * Only the operations created by the zero order forward mode of regular
+ * tapes are supported; isSupported() returns false if the model uses
+ * atomic functions or loops, in which case the CppAD sparsity methods
+ * should be used.
+ */
+template<class Base>
+class GraphSparsity {
+public:
+    using SparsitySetType = std::vector<std::set<size_t> >;
+private:
+    using Node = OperationNode<Base>;
+    /**
+     * Sorted indexes which can be shared by several nodes
+     * (nullptr is used for empty sets)
+     */
+    using Indexes = std::shared_ptr<const std::vector<size_t> >;
+private:
+    ADFun<CG<Base> >& fun_;
+    /**
+     * whether or not to determine the Hessian sparsity of each equation
+     */
+    const bool hessianByEquation_;
+    CodeHandler<Base> handler_;
+    std::vector<CG<Base> > dep_;
+    /**
+     * the nodes used by the dependent variables (the arguments of a node
+     * always appear before that node)
+     */
+    std::vector<Node*> order_;
+    /**
+     * the independent variables which affect each node
+     * (indexed by the position of the nodes in the code handler)
+     */
+    std::vector<Indexes> indeps_;
+    bool recorded_;
+    bool supported_;
+    bool hessianDetermined_;
+    SparsitySetType hess_;
+    std::vector<SparsitySetType> hessians_;
+public:
+
+    /**
+     * @param fun the model
+     * @param hessianByEquation whether or not to also determine the Hessian
+     *                          sparsity of each equation
+     */
+    inline explicit GraphSparsity(ADFun<CG<Base> >& fun,
+                                  bool hessianByEquation = true) :
+        fun_(fun),
+        hessianByEquation_(hessianByEquation),
+        recorded_(false),
+        supported_(false),
+        hessianDetermined_(false) {
+    }
+
+    GraphSparsity(const GraphSparsity&) = delete;
+    GraphSparsity& operator=(const GraphSparsity&) = delete;
+
+    /**
+     * Whether or not the sparsity patterns of this model can be determined
+     * from its operation graph.
+     * The graph is recorded the first time this method is called.
+     */
+    inline bool isSupported() {
+        if (!recorded_) {
+            record();
+        }
+        return supported_;
+    }
+
+    /**
+     * Provides the Jacobian sparsity pattern (one set of independent
+     * variable indexes for each equation).
+     */
+    inline SparsitySetType getJacobianSparsity() {
+        CPPADCG_ASSERT_KNOWN(isSupported(), "Unsupported operation in the model graph")
+
+        SparsitySetType jac(dep_.size());
+        for (size_t i = 0; i < dep_.size(); ++i) {
+            const Indexes& d = indeps(dep_[i].getOperationNode());
+            if (d != nullptr) {
+                jac[i].insert(d->begin(), d->end());
+            }
+        }
+        return jac;
+    }
+
+    /**
+     * Provides the sparsity pattern for the sum of the Hessians of all
+     * equations.
+     */
+    inline const SparsitySetType& getHessianSparsity() {
+        if (!hessianDetermined_) {
+            determineHessianSparsity();
+        }
+        return hess_;
+    }
+
+    /**
+     * Provides the Hessian sparsity pattern of each equation.
+     */
+    inline const std::vector<SparsitySetType>& getHessianSparsities() {
+        CPPADCG_ASSERT_KNOWN(hessianByEquation_, "The Hessian sparsity of each equation was not requested")
+        if (!hessianDetermined_) {
+            determineHessianSparsity();
+        }
+        return hessians_;
+    }
+
+private:
+
+    inline void record() {
+        recorded_ = true;
+
+        size_t n = fun_.Domain();
+
+        std::vector<CG<Base> > x(n);
+        handler_.makeVariables(x);
+
+        // make sure the position in the code handler is the same as the independent index
+        assert(x.size() == 0 || (x[0].getOperationNode()->getHandlerPosition() == 0 && x[x.size() - 1].getOperationNode()->getHandlerPosition() == x.size() - 1));
+
+        dep_ = fun_.Forward(0, x);
+
+        supported_ = sortNodes();
+        if (!supported_) {
+            return;
+        }
+
+        /**
+         * forward pass
+         */
+        indeps_.resize(handler_.getManagedNodesCount());
+
+        for (Node* node : order_) {
+            CGOpCode op = node->getOperationType();
+            Indexes& d = indeps_[node->getHandlerPosition()];
+
+            if (op == CGOpCode::Inv) {
+                // particular case where the position in the code handler is the same as the independent index
+                d = std::make_shared<std::vector<size_t> >(1, node->getHandlerPosition());
+            } else if (op != CGOpCode::Sign) { // the derivative of sign() is always zero
+                const std::vector<Argument<Base> >& args = node->getArguments();
+                for (size_t a = firstDerivativeArgument(op); a < args.size(); ++a) {
+                    d = merge(d, indeps(args[a].getOperation()));
+                }
+            }
+        }
+    }
+
+    /**
+     * Determines the order used to visit the nodes without recursion
+     * (models can have very long chains of operations).
+     *
+     * @return false if an unsupported operation was found
+     */
+    inline bool sortNodes() {
+        std::vector<bool> added(handler_.getManagedNodesCount(), false);
+        std::vector<std::pair<Node*, size_t> > stack;
+
+        for (const CG<Base>& d : dep_) {
+            Node* root = d.getOperationNode();
+            if (root == nullptr || added[root->getHandlerPosition()])
+                continue;
+            if (!isSupportedOperation(root->getOperationType()))
+                return false;
+
+            added[root->getHandlerPosition()] = true;
+            stack.emplace_back(root, 0);
+
+            while (!stack.empty()) {
+                Node* node = stack.back().first;
+                size_t a = stack.back().second;
+                const std::vector<Argument<Base> >& args = node->getArguments();
+
+                if (a < args.size()) {
+                    stack.back().second++;
+
+                    Node* arg = args[a].getOperation();
+                    if (arg != nullptr && !added[arg->getHandlerPosition()]) {
+                        if (!isSupportedOperation(arg->getOperationType()))
+                            return false;
+
+                        added[arg->getHandlerPosition()] = true;
+                        stack.emplace_back(arg, 0);
+                    }
+                } else {
+                    order_.push_back(node);
+                    stack.pop_back();
+                }
+            }
+        }
+
+        return true;
+    }
+
+    inline void determineHessianSparsity() {
+        CPPADCG_ASSERT_KNOWN(isSupported(), "Unsupported operation in the model graph")
+        hessianDetermined_ = true;
+
+        size_t n = fun_.Domain();
+        size_t m = dep_.size();
+
+        hess_ = SparsitySetType(n);
+        if (hessianByEquation_) {
+            hessians_.assign(m, SparsitySetType(n));
+        }
+
+        size_t nNodes = indeps_.size();
+        std::vector<bool> inCone(nNodes, false);
+        std::vector<Indexes> eqs; // the equations which use each node
+        if (hessianByEquation_) {
+            eqs.resize(nNodes);
+        }
+
+        for (size_t i = 0; i < m; ++i) {
+            Node* node = dep_[i].getOperationNode();
+            if (node == nullptr)
+                continue;
+
+            size_t p = node->getHandlerPosition();
+            inCone[p] = true;
+            if (hessianByEquation_) {
+                auto e = (eqs[p] == nullptr) ? std::make_shared<std::vector<size_t> >() : std::make_shared<std::vector<size_t> >(*eqs[p]);
+                e->push_back(i);
+                eqs[p] = e;
+            }
+        }
+
+        /**
+         * reverse pass
+         * (the equations of a node are final once it is reached since all
+         *  the nodes using it were already visited)
+         */
+        std::set<std::pair<const std::vector<size_t>*, const std::vector<size_t>*> > totalBlocks;
+        std::set<std::tuple<const std::vector<size_t>*, const std::vector<size_t>*, const std::vector<size_t>*> > eqBlocks;
+        std::vector<Indexes> created; // keeps new sets alive while their addresses are used in the blocks
+        const Indexes noEquations;
+
+        auto addBlock = [&](const Indexes& rows, const Indexes& cols, const Indexes& equations) {
+            if (rows == nullptr || cols == nullptr)
+                return;
+
+            if (totalBlocks.emplace(rows.get(), cols.get()).second) {
+                addSparsity(hess_, *rows, *cols);
+            }
+
+            if (equations != nullptr && eqBlocks.emplace(equations.get(), rows.get(), cols.get()).second) {
+                for (size_t i : *equations) {
+                    addSparsity(hessians_[i], *rows, *cols);
+                }
+            }
+        };
+
+        for (auto it = order_.rbegin(); it != order_.rend(); ++it) {
+            Node* node = *it;
+            size_t p = node->getHandlerPosition();
+            CGOpCode op = node->getOperationType();
+            if (!inCone[p] || op == CGOpCode::Sign)
+                continue;
+
+            const Indexes& equations = hessianByEquation_ ? eqs[p] : noEquations;
+            const std::vector<Argument<Base> >& args = node->getArguments();
+
+            for (size_t a = firstDerivativeArgument(op); a < args.size(); ++a) {
+                Node* arg = args[a].getOperation();
+                if (arg != nullptr) {
+                    size_t pa = arg->getHandlerPosition();
+                    inCone[pa] = true;
+                    if (hessianByEquation_) {
+                        eqs[pa] = merge(eqs[pa], equations);
+                    }
+                }
+            }
+
+            /**
+             * second order interactions created by this operation
+             */
+            switch (op) {
+                case CGOpCode::Mul: {
+                    const Indexes& a = indeps(args[0].getOperation());
+                    const Indexes& b = indeps(args[1].getOperation());
+                    addBlock(a, b, equations);
+                    addBlock(b, a, equations);
+                    break;
+                }
+                case CGOpCode::Div: {
+                    const Indexes& a = indeps(args[0].getOperation());
+                    const Indexes& b = indeps(args[1].getOperation());
+                    addBlock(a, b, equations);
+                    addBlock(b, a, equations);
+                    addBlock(b, b, equations);
+                    break;
+                }
+                case CGOpCode::Pow: {
+                    Indexes u = merge(indeps(args[0].getOperation()), indeps(args[1].getOperation()));
+                    addBlock(u, u, equations);
+                    created.push_back(std::move(u));
+                    break;
+                }
+                case CGOpCode::Acos:
+                case CGOpCode::Acosh:
+                case CGOpCode::Asin:
+                case CGOpCode::Asinh:
+                case CGOpCode::Atan:
+                case CGOpCode::Atanh:
+                case CGOpCode::Cosh:
+                case CGOpCode::Cos:
+                case CGOpCode::Erf:
+                case CGOpCode::Erfc:
+                case CGOpCode::Exp:
+                case CGOpCode::Expm1:
+                case CGOpCode::Log:
+                case CGOpCode::Log1p:
+                case CGOpCode::Sinh:
+                case CGOpCode::Sin:
+                case CGOpCode::Sqrt:
+                case CGOpCode::Tanh:
+                case CGOpCode::Tan: {
+                    const Indexes& a = indeps(args[0].getOperation());
+                    addBlock(a, a, equations);
+                    break;
+                }
+                default:
+                    break; // linear
+            }
+        }
+    }
+
+    inline const Indexes& indeps(const Node* node) const {
+        static const Indexes empty;
+        if (node == nullptr)
+            return empty;
+        return indeps_[node->getHandlerPosition()];
+    }
+
+    /**
+     * Determines the union of two sets reusing one of them when possible.
+     */
+    static inline Indexes merge(const Indexes& a,
+                                const Indexes& b) {
+        if (a == nullptr || a == b)
+            return b;
+        if (b == nullptr)
+            return a;
+        if (std::includes(a->begin(), a->end(), b->begin(), b->end()))
+            return a;
+        if (std::includes(b->begin(), b->end(), a->begin(), a->end()))
+            return b;
+
+        auto u = std::make_shared<std::vector<size_t> >();
+        u->reserve(a->size() + b->size());
+        std::set_union(a->begin(), a->end(), b->begin(), b->end(), std::back_inserter(*u));
+        return u;
+    }
+
+    static inline void addSparsity(SparsitySetType& sparsity,
+                                   const std::vector<size_t>& rows,
+                                   const std::vector<size_t>& cols) {
+        for (size_t j : rows) {
+            sparsity[j].insert(cols.begin(), cols.end());
+        }
+    }
+
+    /**
+     * The index of the first argument which affects the derivatives of an
+     * operation (the values compared by conditional expressions do not).
+     */
+    static inline size_t firstDerivativeArgument(CGOpCode op) {
+        switch (op) {
+            case CGOpCode::ComLt:
+            case CGOpCode::ComLe:
+            case CGOpCode::ComEq:
+            case CGOpCode::ComGe:
+            case CGOpCode::ComGt:
+            case CGOpCode::ComNe:
+                return 2;
+            default:
+                return 0;
+        }
+    }
+
+    static inline bool isSupportedOperation(CGOpCode op) {
+        switch (op) {
+            case CGOpCode::Assign:
+            case CGOpCode::Abs:
+            case CGOpCode::Acos:
+            case CGOpCode::Acosh:
+            case CGOpCode::Add:
+            case CGOpCode::Alias:
+            case CGOpCode::Asin:
+            case CGOpCode::Asinh:
+            case CGOpCode::Atan:
+            case CGOpCode::Atanh:
+            case CGOpCode::ComLt:
+            case CGOpCode::ComLe:
+            case CGOpCode::ComEq:
+            case CGOpCode::ComGe:
+            case CGOpCode::ComGt:
+            case CGOpCode::ComNe:
+            case CGOpCode::Cosh:
+            case CGOpCode::Cos:
+            case CGOpCode::Div:
+            case CGOpCode::Erf:
+            case CGOpCode::Erfc:
+            case CGOpCode::Exp:
+            case CGOpCode::Expm1:
+            case CGOpCode::Inv:
+            case CGOpCode::Log:
+            case CGOpCode::Log1p:
+            case CGOpCode::Mul:
+            case CGOpCode::Pow:
+            case CGOpCode::Pri:
+            case CGOpCode::Sign:
+            case CGOpCode::Sinh:
+            case CGOpCode::Sin:
+            case CGOpCode::Sqrt:
+            case CGOpCode::Sub:
+            case CGOpCode::Tanh:
+            case CGOpCode::Tan:
+            case CGOpCode::UnMinus:
+                return true;
+            default:
+                return false; // e.g. atomic functions and loops
+        }
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
@@ -0,0 +1,310 @@
+#ifndef CPPAD_CG_JOB_PROFILER_INCLUDED
+#define CPPAD_CG_JOB_PROFILER_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * A job listener which records a hierarchical trace of all the jobs of a
+ * JobTimer.
+ * The trace can be exported in the Chrome trace-event format
+ * (chrome://tracing, Perfetto) or as an aggregated flat profile.
+ *
+ * Usage example:
+ * @code
+ * JobProfiler profiler;
+ * libSourceGen.addListener(profiler);
+ * ...
+ * std::ofstream trace("trace.json");
+ * profiler.writeChromeTrace(trace);
+ * profiler.writeFlatProfile(std::cout);
+ * @endcode
+ */
+class JobProfiler : public JobListener {
+public:
+    using duration = JobListener::duration;
+
+    /**
+     * A completed (or still running) job
+     */
+    struct Event {
+        /// the job name
+        std::string name;
+        /// the job type
+        const JobType* type;
+        /// the names of the enclosing jobs and of this job (separated by '/')
+        std::string path;
+        /// the index of the enclosing event (or -1 for top level jobs)
+        long parent;
+        /// the nesting level (0 for top level jobs)
+        size_t depth;
+        /// the thread which executed the job
+        size_t thread;
+        /// start time
+        std::chrono::steady_clock::time_point begin;
+        /// elapsed time (only valid after the job ended)
+        duration elapsed;
+        /// elapsed time spent in nested jobs
+        duration nestedElapsed;
+        /// operation graph nodes processed (including nested jobs)
+        size_t nodes;
+        /// bytes of source code emitted (including nested jobs)
+        size_t sourceBytes;
+        /// whether or not the job has already ended
+        bool finished;
+    };
+
+    /**
+     * The aggregated results of all jobs with the same path
+     */
+    struct FlatProfileEntry {
+        std::string path;
+        const JobType* type;
+        size_t calls;
+        duration total;
+        duration self;
+        size_t nodes;
+        size_t sourceBytes;
+    };
+
+protected:
+    /// all recorded jobs (in the order they started)
+    std::vector<Event> _events;
+    /// the indexes of the currently running jobs
+    std::vector<size_t> _running;
+    /// maps thread IDs into small sequential numbers
+    std::map<std::thread::id, size_t> _threads;
+    /// time reference for the trace
+    std::chrono::steady_clock::time_point _origin;
+public:
+
+    inline JobProfiler() :
+        _origin(std::chrono::steady_clock::now()) {
+    }
+
+    inline const std::vector<Event>& getEvents() const {
+        return _events;
+    }
+
+    /**
+     * Removes all recorded events.
+     * Jobs which are currently running are not affected.
+     */
+    inline void clear() {
+        if (_running.empty()) {
+            _events.clear();
+            _origin = std::chrono::steady_clock::now();
+        }
+    }
+
+    void jobStarted(const std::vector<Job>& jobs) override {
+        CPPADCG_ASSERT_UNKNOWN(!jobs.empty());
+        const Job& job = jobs.back();
+
+        auto thread = _threads.emplace(std::this_thread::get_id(), _threads.size()).first->second;
+
+        Event e;
+        e.name = job.name();
+        e.type = &job.getType();
+        e.parent = _running.empty() ? -1 : long(_running.back());
+        e.depth = jobs.size() - 1;
+        e.thread = thread;
+        e.begin = job.beginTime();
+        e.elapsed = duration::zero();
+        e.nestedElapsed = duration::zero();
+        e.nodes = 0;
+        e.sourceBytes = 0;
+        e.finished = false;
+
+        e.path = (e.parent >= 0) ? _events[e.parent].path + " / " : "";
+        e.path += e.type->getActionName();
+        if (!e.name.empty())
+            e.path += " " + e.name;
+
+        _running.push_back(_events.size());
+        _events.push_back(std::move(e));
+    }
+
+    void jobEndended(const std::vector<Job>& jobs,
+                     duration elapsed) override {
+        CPPADCG_ASSERT_UNKNOWN(!jobs.empty());
+        if (_running.empty() || _events[_running.back()].depth != jobs.size() - 1)
+            return; // the profiler was registered after the job started
+
+        const Job& job = jobs.back();
+
+        Event& e = _events[_running.back()];
+        e.elapsed = elapsed;
+        e.nodes = job.getNodeCount();
+        e.sourceBytes = job.getSourceBytes();
+        e.finished = true;
+
+        if (e.parent >= 0)
+            _events[e.parent].nestedElapsed += elapsed;
+
+        _running.pop_back();
+    }
+
+    /**
+     * Aggregates the results of all completed jobs with the same path
+     * (same job names and types in the hierarchy).
+     *
+     * @return the flat profile sorted by decreasing self time
+     */
+    inline std::vector<FlatProfileEntry> getFlatProfile() const {
+        std::vector<FlatProfileEntry> profile;
+        std::map<std::string, size_t> path2Entry;
+
+        for (const Event& e : _events) {
+            if (!e.finished)
+                continue;
+
+            auto it = path2Entry.find(e.path);
+            if (it == path2Entry.end()) {
+                it = path2Entry.emplace(e.path, profile.size()).first;
+                profile.push_back(FlatProfileEntry{e.path, e.type, 0,
+                                                   duration::zero(), duration::zero(),
+                                                   0, 0});
+            }
+
+            FlatProfileEntry& entry = profile[it->second];
+            entry.calls++;
+            entry.total += e.elapsed;
+            entry.self += e.elapsed - e.nestedElapsed;
+            entry.nodes += e.nodes;
+            entry.sourceBytes += e.sourceBytes;
+        }
+
+        std::stable_sort(profile.begin(), profile.end(), [](const FlatProfileEntry& a, const FlatProfileEntry& b) {
+            return a.self > b.self;
+        });
+
+        return profile;
+    }
+
+    /**
+     * Writes all completed jobs using the Chrome trace-event JSON format.
+     *
+     * @param out the output stream
+     */
+    inline void writeChromeTrace(std::ostream& out) const {
+        using namespace std::chrono;
+
+        OStreamConfigRestore osr(out);
+
+        out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+        bool first = true;
+        for (const Event& e : _events) {
+            if (!e.finished)
+                continue;
+
+            if (!first) out << ",";
+            first = false;
+
+            out << "\n  {\"name\": ";
+            printJSONString(out, e.name.empty() ? e.type->getActionName() : e.name);
+            out << ", \"cat\": ";
+            printJSONString(out, e.type->getActionName());
+            out << ", \"ph\": \"X\""
+                   ", \"pid\": 1"
+                   ", \"tid\": " << e.thread <<
+                   ", \"ts\": " << duration_cast<microseconds>(e.begin - _origin).count() <<
+                   ", \"dur\": " << duration_cast<microseconds>(e.elapsed).count() <<
+                   ", \"args\": {\"depth\": " << e.depth <<
+                   ", \"nodes\": " << e.nodes <<
+                   ", \"sourceBytes\": " << e.sourceBytes << "}}";
+        }
+        out << "\n]}" << std::endl;
+    }
+
+    /**
+     * Writes a table with the aggregated results of all completed jobs
+     * sorted by decreasing self time (time not spent in nested jobs).
+     *
+     * @param out the output stream
+     */
+    inline void writeFlatProfile(std::ostream& out) const {
+        using namespace std::chrono;
+
+        OStreamConfigRestore osr(out);
+
+        std::vector<FlatProfileEntry> profile = getFlatProfile();
+
+        duration total = duration::zero();
+        for (const FlatProfileEntry& e : profile)
+            total += e.self;
+        double totalSec = std::chrono::duration<double>(total).count();
+
+        out << std::setw(8) << "self %" << " "
+                << std::setw(12) << "self [s]" << " "
+                << std::setw(12) << "total [s]" << " "
+                << std::setw(8) << "calls" << " "
+                << std::setw(12) << "nodes" << " "
+                << std::setw(12) << "bytes" << "  job\n";
+
+        out << std::fixed;
+        for (const FlatProfileEntry& e : profile) {
+            double self = std::chrono::duration<double>(e.self).count();
+            out << std::setprecision(2) << std::setw(8) << (totalSec > 0 ? 100.0 * self / totalSec : 0.0) << " "
+                    << std::setprecision(3) << std::setw(12) << self << " "
+                    << std::setw(12) << std::chrono::duration<double>(e.total).count() << " "
+                    << std::setw(8) << e.calls << " "
+                    << std::setw(12) << e.nodes << " "
+                    << std::setw(12) << e.sourceBytes << "  "
+                    << e.path << "\n";
+        }
+        out.flush();
+    }
+
+    inline virtual ~JobProfiler() = default;
+
+protected:
+
+    static inline void printJSONString(std::ostream& out,
+                                       const std::string& str) {
+        out << '"';
+        for (char c : str) {
+            switch (c) {
+                case '"':
+                    out << "\\\"";
+                    break;
+                case '\\':
+                    out << "\\\\";
+                    break;
+                case '\n':
+                    out << "\\n";
+                    break;
+                case '\t':
+                    out << "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char> (c) < 0x20) {
+                        out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec << std::setfill(' ');
+                    } else {
+                        out << c;
+                    }
+            }
+        }
+        out << '"';
+    }
+
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
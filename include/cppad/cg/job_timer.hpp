@@ -136,6 +136,16 @@ private:
      * Whether or not there are/were other jobs inside
      */
     bool _nestedJobs;
+    /**
+     * Number of operation graph nodes reported for this job
+     * (including nested jobs)
+     */
+    size_t _nodes;
+    /**
+     * Number of bytes of source code reported for this job
+     * (including nested jobs)
+     */
+    size_t _sourceBytes;
 public:
 
     inline Job(const JobType& type,
@@ -143,7 +153,9 @@ public:
         _type(&type),
         _name(name),
         _beginTime(std::chrono::steady_clock::now()),
-        _nestedJobs(false) {
+        _nestedJobs(false),
+        _nodes(0),
+        _sourceBytes(0) {
     }
 
     inline const JobType& getType()const {
@@ -158,6 +170,22 @@ public:
         return _beginTime;
     }
 
+    /**
+     * Provides the number of operation graph nodes processed while this job
+     * was running (including nested jobs).
+     */
+    inline size_t getNodeCount() const {
+        return _nodes;
+    }
+
+    /**
+     * Provides the number of bytes of source code emitted while this job
+     * was running (including nested jobs).
+     */
+    inline size_t getSourceBytes() const {
+        return _sourceBytes;
+    }
+
     inline virtual ~Job() {
     }
 
@@ -257,6 +285,28 @@ public:
         return _listeners.erase(&l) > 0;
     }
 
+    /**
+     * Registers operation graph nodes processed by the currently running job.
+     * The values are added to the enclosing jobs when the job finishes.
+     *
+     * @param nodes the number of nodes
+     */
+    inline void addNodeCount(size_t nodes) {
+        if (!_jobs.empty())
+            _jobs.back()._nodes += nodes;
+    }
+
+    /**
+     * Registers source code emitted by the currently running job.
+     * The values are added to the enclosing jobs when the job finishes.
+     *
+     * @param bytes the number of bytes of source code
+     */
+    inline void addSourceBytes(size_t bytes) {
+        if (!_jobs.empty())
+            _jobs.back()._sourceBytes += bytes;
+    }
+
     inline void startingJob(const std::string& jobName,
                             const JobType& type = JobTypeHolder<>::DEFAULT,
                             const std::string& prefix = "") {
@@ -326,6 +376,12 @@ public:
             l->jobEndended(_jobs, elapsed);
         }
 
+        if (_jobs.size() > 1) {
+            Job& parent = _jobs[_jobs.size() - 2];
+            parent._nodes += job._nodes;
+            parent._sourceBytes += job._sourceBytes;
+        }
+
         _jobs.pop_back();
     }
 
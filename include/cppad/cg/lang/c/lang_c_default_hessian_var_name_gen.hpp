@@ -186,6 +186,12 @@ public:
                                   size_t id1,
                                   const OperationNode<Base>& indep2,
                                   size_t id2) override {
+        if (indep1.getOperationType() == CGOpCode::Inv && id1 < _minMultiplierID &&
+                indep2.getOperationType() == CGOpCode::Inv && id2 < _minMultiplierID) {
+            // the wrapped generator might also define several arrays
+            return _nameGen->isInSameIndependentArray(indep1, id1, indep2, id2);
+        }
+
         size_t l1;
         if (indep1.getOperationType() == CGOpCode::Inv) {
             l1 = id1 < _minMultiplierID ? 0 : 1;
@@ -95,6 +95,10 @@ protected:
     std::string _functionName;
     // the maximum number of assignments (~lines) per local function
     size_t _maxAssignmentsPerFunction;
+    // whether or not to use the dependencies between variables to decide where to split local functions
+    bool _splitByDependencies;
+    // how independent local functions are evaluated concurrently (NONE means they are always called sequentially)
+    MultiThreadingType _localFunctionTasks;
     // the maximum number of operations per variable assignment
     size_t _maxOperationsPerAssignment;
     //  maps file names to with their contents
@@ -110,6 +114,8 @@ protected:
     std::vector<const LoopStartOperationNode<Base>*> _currentLoops;
     // the maximum precision used to print values
     size_t _parameterPrecision;
+    // atomic functions called directly through C functions (atomic name -> C function name prefix)
+    std::map<std::string, std::string> _atomicDirectCalls;
 private:
     std::vector<std::string> funcArgDcl_;
     std::vector<std::string> localFuncArgDcl_;
@@ -140,6 +146,8 @@ public:
         _depAssignOperation("="),
         _ignoreZeroDepAssign(false),
         _maxAssignmentsPerFunction(0),
+        _splitByDependencies(false),
+        _localFunctionTasks(MultiThreadingType::NONE),
         _maxOperationsPerAssignment((std::numeric_limits<size_t>::max)()),
         _sources(nullptr),
         _parameterPrecision(std::numeric_limits<Base>::digits10) {
@@ -171,6 +179,32 @@ public:
         _atomicArgName = atomicArgName;
     }
 
+    /**
+     * Provides the atomic functions which are called directly through
+     * C functions instead of the function pointers in LangCAtomicFun.
+     *
+     * @return maps atomic function names to the prefix of the C functions
+     */
+    inline const std::map<std::string, std::string>& getAtomicFunctionDirectCalls() const {
+        return _atomicDirectCalls;
+    }
+
+    /**
+     * Defines atomic functions which are called directly through C
+     * functions (e.g. from another model in the same library) instead of
+     * the function pointers in LangCAtomicFun.
+     * For an atomic function mapped to <code>prefix</code> the generated
+     * source code will call <code>prefix_forward(atomicFun, index, q, p, tx, ty)</code>
+     * and <code>prefix_reverse(atomicFun, index, p, tx, px, py)</code>
+     * which must be provided elsewhere.
+     *
+     * @param directCalls maps atomic function names to the prefix of the
+     *                    C functions
+     */
+    inline void setAtomicFunctionDirectCalls(const std::map<std::string, std::string>& directCalls) {
+        _atomicDirectCalls = directCalls;
+    }
+
     inline const std::string& getDependentAssignOperation() const {
         return _depAssignOperation;
     }
@@ -205,6 +239,10 @@ public:
         _functionName = functionName;
     }
 
+    inline const std::string& getGenerateFunction() const {
+        return _functionName;
+    }
+
     virtual void setFunctionIndexArgument(const Node& funcArgIndex) {
         _funcArgIndexes.resize(1);
         _funcArgIndexes[0] = &funcArgIndex;
@@ -255,6 +293,59 @@ public:
         _sources = sources;
     }
 
+    /**
+     * Whether or not the dependencies between variables are used to
+     * determine where to split the source code into local functions.
+     */
+    inline bool isFunctionSplitByDependencies() const {
+        return _splitByDependencies;
+    }
+
+    /**
+     * Defines whether or not to use the dependencies between variables to
+     * determine where to split the source code into local functions (see
+     * setMaxAssignmentsPerFunction()).
+     * Instead of starting a new function as soon as the maximum number of
+     * assignments is reached, a new function starts at the location, after
+     * at least half of the maximum number of assignments, where the lowest
+     * number of temporary variables must be shared between local functions.
+     *
+     * @param split whether or not to split functions using the dependencies
+     *              between variables
+     */
+    inline void setFunctionSplitByDependencies(bool split) {
+        _splitByDependencies = split;
+    }
+
+    /**
+     * How local functions which do not depend on each other are evaluated
+     * concurrently.
+     */
+    inline MultiThreadingType getLocalFunctionTasks() const {
+        return _localFunctionTasks;
+    }
+
+    /**
+     * Defines whether or not local functions (see
+     * setMaxAssignmentsPerFunction()) are evaluated as parallel tasks.
+     * The dependencies between the variables of the operation graph are
+     * used to group local functions into levels where each function only
+     * depends on functions from previous levels.
+     * The functions in the same level are then evaluated concurrently using
+     * the thread pool of the model library (PTHREADS) or OpenMP.
+     * Local functions with arrays, atomic functions, loops, or conditional
+     * blocks are always evaluated alone.
+     * Reusing temporary variables (see CodeHandler::setReuseVariableIDs())
+     * reduces the number of local functions which can be evaluated
+     * concurrently.
+     *
+     * @param tasks the multithreading type used to evaluate the local
+     *              functions (NONE to always call them sequentially)
+     */
+    inline void setLocalFunctionTasks(MultiThreadingType tasks) {
+        _localFunctionTasks = tasks;
+    }
+
     /**
      * The maximum number of operations per variable assignment.
      *
@@ -781,6 +872,8 @@ protected:
 
         // the names of local functions
         std::vector<std::string> localFuncNames;
+        // the positions in the evaluation order where each local function ends
+        std::vector<size_t> localFuncEnds;
         if (multiFunction) {
             localFuncNames.reserve(variableOrder.size() / _maxAssignmentsPerFunction);
         }
@@ -822,14 +915,34 @@ protected:
                 }
             }
 
+            // where new local functions should start
+            const bool splitByDeps = multiFunction && _splitByDependencies &&
+                                     _info->variableDependencies.size() == variableOrder.size();
+            std::vector<size_t> splits;
+            if (splitByDeps) {
+                splits = findFunctionSplits(variableOrder);
+            }
+            size_t nextSplit = 0;
+
             size_t assignCount = 0;
             for (size_t i = 0; i < variableOrder.size(); ++i) {
                 Node* it = variableOrder[i];
 
                 // check if a new function should start
-                if (assignCount >= _maxAssignmentsPerFunction && multiFunction && _currentLoops.empty()) {
+                if (splitByDeps) {
+                    if (nextSplit < splits.size() && i >= splits[nextSplit] && _currentLoops.empty()) {
+                        while (nextSplit < splits.size() && i >= splits[nextSplit])
+                            nextSplit++;
+                        if (assignCount > 0) {
+                            assignCount = 0;
+                            saveLocalFunction(localFuncNames, localFuncNames.empty() && _info->zeroDependents);
+                            localFuncEnds.push_back(i);
+                        }
+                    }
+                } else if (assignCount >= _maxAssignmentsPerFunction && multiFunction && _currentLoops.empty()) {
                     assignCount = 0;
                     saveLocalFunction(localFuncNames, localFuncNames.empty() && _info->zeroDependents);
+                    localFuncEnds.push_back(i);
                 }
 
                 Node& node = *it;
@@ -853,6 +966,7 @@ protected:
             if (!localFuncNames.empty() && assignCount > 0) {
                 assignCount = 0;
                 saveLocalFunction(localFuncNames, false);
+                localFuncEnds.push_back(variableOrder.size());
             }
         }
 
@@ -863,13 +977,26 @@ protected:
             CPPADCG_ASSERT_KNOWN(tmpArg[0].array,
                                  "The temporary variables must be saved in an array in order to generate multiple functions")
 
+            // local functions which can be evaluated concurrently
+            std::vector<size_t> levels;
+            if (_localFunctionTasks != MultiThreadingType::NONE && localFuncNames.size() > 1 &&
+                _info->variableDependencies.size() == variableOrder.size() && _funcArgIndexes.empty()) {
+                levels = findLocalFunctionLevels(variableOrder, localFuncEnds);
+                if (*std::max_element(levels.begin(), levels.end()) + 1 == levels.size())
+                    levels.clear(); // no local functions can be evaluated concurrently
+            }
+
             _code << ATOMICFUN_STRUCT_DEFINITION << "\n\n";
+            printAtomicDirectCallDeclarations(_code);
             // forward declarations
             std::string localFuncArgDcl2 = implode(localFuncArgDcl_, ", ");
             for (auto & localFuncName : localFuncNames) {
                 _code << "void " << localFuncName << "(" << localFuncArgDcl2 << ");\n";
             }
             _code << "\n";
+            if (!levels.empty()) {
+                printLocalFunctionTaskDeclarations(_code);
+            }
             printFunctionDeclaration(_code, "void", _functionName, funcArgDcl_);
             _code  << " {\n";
             _nameGen->customFunctionVariableDeclarations(_code);
@@ -879,8 +1006,12 @@ protected:
                                                           _info->atomicFunctionsMaxForward,
                                                           _info->atomicFunctionsMaxReverse) << "\n";
             _nameGen->prepareCustomFunctionVariables(_code);
-            for (auto & localFuncName : localFuncNames) {
-                _code << _spaces << localFuncName << "(" << localFuncArgs_ << ");\n";
+            if (!levels.empty()) {
+                printLocalFunctionTaskCalls(_code, localFuncNames, levels);
+            } else {
+                for (auto& localFuncName : localFuncNames) {
+                    _code << _spaces << localFuncName << "(" << localFuncArgs_ << ");\n";
+                }
             }
         }
 
@@ -929,6 +1060,7 @@ protected:
                 _ss << "#include <math.h>\n"
                         "#include <stdio.h>\n\n"
                     << ATOMICFUN_STRUCT_DEFINITION << "\n\n";
+                printAtomicDirectCallDeclarations(_ss);
                 printFunctionDeclaration(_ss, "void", _functionName, funcArgDcl_);
                 _ss << " {\n";
                 _nameGen->customFunctionVariableDeclarations(_ss);
@@ -1044,6 +1176,365 @@ protected:
         return dcl + " " + funcArg.name;
     }
 
+    /**
+     * Declares the C functions used to call atomic functions directly.
+     */
+    virtual void printAtomicDirectCallDeclarations(std::ostream& out) {
+        if (_info->atomicFunctionId2Name.empty())
+            return;
+
+        std::set<std::string> prefixes;
+        for (const auto& it : _info->atomicFunctionId2Name) {
+            auto itDirect = _atomicDirectCalls.find(it.second);
+            if (itDirect != _atomicDirectCalls.end())
+                prefixes.insert(itDirect->second);
+        }
+
+        for (const std::string& prefix : prefixes) {
+            out << "int " << prefix << "_forward(struct LangCAtomicFun atomicFun, int atomicIndex, int q, int p, const Array tx[], Array* ty);\n"
+                    "int " << prefix << "_reverse(struct LangCAtomicFun atomicFun, int atomicIndex, int p, const Array tx[], Array* px, const Array py[]);\n";
+        }
+        if (!prefixes.empty())
+            out << "\n";
+    }
+
+    /**
+     * Determines where the source code should be split into local functions
+     * so that few temporary variables are shared between local functions.
+     * Whenever possible, each local function has between half and the
+     * maximum number of assignments per function and new functions are
+     * never started inside loops or conditional blocks.
+     *
+     * @param variableOrder the variables in their evaluation order
+     * @return the positions in the evaluation order where new local
+     *         functions should start
+     */
+    virtual std::vector<size_t> findFunctionSplits(const std::vector<Node*>& variableOrder) const {
+        const size_t nv = variableOrder.size();
+        const std::vector<std::set<Node*>>& dependencies = _info->variableDependencies;
+
+        std::map<const Node*, size_t> position;
+        for (size_t p = 0; p < nv; ++p) {
+            position[variableOrder[p]] = p;
+        }
+
+        // the last position where each variable is used
+        std::vector<size_t> lastUse(nv, 0);
+        for (size_t i = 0; i < nv; ++i) {
+            for (const Node* d : dependencies[i]) {
+                auto it = position.find(d);
+                if (it != position.end() && it->second < i)
+                    lastUse[it->second] = i;
+            }
+        }
+
+        // number of variables shared between functions if a function starts at each position
+        std::vector<long> shared(nv + 1, 0);
+        for (size_t p = 0; p < nv; ++p) {
+            if (lastUse[p] > p && !isDependent(*variableOrder[p])) {
+                shared[p + 1]++;
+                shared[lastUse[p] + 1]--;
+            }
+        }
+        for (size_t p = 1; p <= nv; ++p) {
+            shared[p] += shared[p - 1];
+        }
+
+        // positions where a function can start and the number of assignments before each position
+        std::vector<bool> allowed(nv);
+        std::vector<size_t> assignments(nv + 1, 0);
+        long depth = 0;
+        for (size_t p = 0; p < nv; ++p) {
+            CGOpCode op = variableOrder[p]->getOperationType();
+            allowed[p] = depth == 0;
+            if (op == CGOpCode::LoopStart || op == CGOpCode::StartIf) {
+                depth++;
+            } else if (op == CGOpCode::LoopEnd || op == CGOpCode::EndIf) {
+                depth--;
+            }
+            bool assigns = op != CGOpCode::DependentRefRhs && op != CGOpCode::TmpDcl;
+            assignments[p + 1] = assignments[p] + (assigns ? 1 : 0);
+        }
+
+        const size_t maxSize = _maxAssignmentsPerFunction;
+        const size_t minSize = maxSize / 2;
+
+        std::vector<size_t> splits;
+        size_t start = 0;
+        size_t best = 0;
+        bool found = false;
+        for (size_t p = 1; p < nv; ++p) {
+            size_t size = assignments[p] - assignments[start];
+            if (size >= minSize && allowed[p] && (!found || shared[p] <= shared[best])) {
+                best = p;
+                found = true;
+            }
+
+            if (size >= maxSize && found) {
+                splits.push_back(best);
+                start = best;
+                p = best; // continue searching from the new function start
+                found = false;
+            }
+        }
+
+        return splits;
+    }
+
+    /**
+     * Determines which local functions can be evaluated concurrently.
+     * A local function must be evaluated after the local functions which
+     * assign the variables it uses and, since temporary variables can be
+     * reused, after the local functions which use or assign the variables
+     * it assigns.
+     *
+     * @param variableOrder the variables in their evaluation order
+     * @param localFuncEnds the positions in the evaluation order where each
+     *                      local function ends
+     * @return the level of each local function (local functions only depend
+     *         on local functions from lower levels)
+     */
+    virtual std::vector<size_t> findLocalFunctionLevels(const std::vector<Node*>& variableOrder,
+                                                        const std::vector<size_t>& localFuncEnds) const {
+        const std::vector<std::set<Node*>>& dependencies = _info->variableDependencies;
+
+        // the level of the last local function which assigned each variable ID
+        std::map<size_t, size_t> lastWrite;
+        // the highest level of the local functions which used each variable ID after its last assignment
+        std::map<size_t, size_t> lastRead;
+
+        std::vector<size_t> levels(localFuncEnds.size());
+        size_t minLevel = 0;
+        size_t maxLevel = 0;
+        size_t start = 0;
+        std::set<size_t> reads, writes;
+
+        for (size_t f = 0; f < localFuncEnds.size(); ++f) {
+            size_t end = localFuncEnds[f];
+
+            // the first function sets the dependent variables to zero
+            bool alone = f == 0 && _info->zeroDependents;
+            reads.clear();
+            writes.clear();
+            for (size_t p = start; p < end; ++p) {
+                const Node& node = *variableOrder[p];
+                if (requiresSequentialEvaluation(node.getOperationType()))
+                    alone = true;
+                size_t id = getVariableID(node);
+                if (id > 0)
+                    writes.insert(id);
+                for (const Node* d : dependencies[p]) {
+                    reads.insert(getVariableID(*d));
+                }
+            }
+
+            size_t level = minLevel;
+            if (alone) {
+                level = f == 0 ? 0 : maxLevel + 1;
+            } else {
+                for (size_t id : reads) {
+                    auto it = lastWrite.find(id);
+                    if (it != lastWrite.end())
+                        level = std::max(level, it->second + 1);
+                }
+                for (size_t id : writes) {
+                    auto it = lastWrite.find(id);
+                    if (it != lastWrite.end())
+                        level = std::max(level, it->second + 1);
+                    it = lastRead.find(id);
+                    if (it != lastRead.end())
+                        level = std::max(level, it->second + 1);
+                }
+            }
+
+            levels[f] = level;
+            maxLevel = std::max(maxLevel, level);
+            if (alone)
+                minLevel = level + 1;
+
+            for (size_t id : reads) {
+                auto it = lastRead.find(id);
+                if (it == lastRead.end())
+                    lastRead[id] = level;
+                else
+                    it->second = std::max(it->second, level);
+            }
+            for (size_t id : writes) {
+                lastWrite[id] = level;
+                lastRead.erase(id);
+            }
+
+            start = end;
+        }
+
+        return levels;
+    }
+
+    /**
+     * Whether or not a local function with this operation must be evaluated
+     * alone (e.g. it uses the shared temporary arrays).
+     */
+    virtual bool requiresSequentialEvaluation(CGOpCode op) const {
+        return op == CGOpCode::ArrayCreation ||
+               op == CGOpCode::SparseArrayCreation ||
+               op == CGOpCode::AtomicForward ||
+               op == CGOpCode::AtomicReverse ||
+               op == CGOpCode::DependentMultiAssign ||
+               op == CGOpCode::DependentRefRhs ||
+               op == CGOpCode::LoopStart ||
+               op == CGOpCode::LoopEnd ||
+               op == CGOpCode::LoopIndexedDep ||
+               op == CGOpCode::LoopIndexedIndep ||
+               op == CGOpCode::LoopIndexedTmp ||
+               op == CGOpCode::IndexDeclaration ||
+               op == CGOpCode::Index ||
+               op == CGOpCode::IndexAssign ||
+               op == CGOpCode::StartIf ||
+               op == CGOpCode::ElseIf ||
+               op == CGOpCode::Else ||
+               op == CGOpCode::EndIf ||
+               op == CGOpCode::CondResult ||
+               op == CGOpCode::Tmp ||
+               op == CGOpCode::TmpDcl ||
+               op == CGOpCode::Pri;
+    }
+
+    /**
+     * Declares the structures and functions used by the wrapper function to
+     * evaluate local functions as tasks.
+     */
+    virtual void printLocalFunctionTaskDeclarations(std::ostream& out) {
+        if (_localFunctionTasks == MultiThreadingType::OPENMP) {
+            out << "int cppadcg_openmp_is_disabled();\n"
+                   "unsigned int cppadcg_openmp_get_threads();\n"
+                   "\n";
+            return;
+        }
+
+        const std::string argsStruct = _functionName + "_task_args";
+
+        out << "typedef void (*cppadcg_thpool_function_type)(void*);\n"
+               "void cppadcg_thpool_add_job(cppadcg_thpool_function_type function, void* arg, const float* avgElapsed, float* elapsed);\n"
+               "void cppadcg_thpool_wait();\n"
+               "\n"
+               "typedef struct " << argsStruct << " {\n" <<
+               _spaces << "void (*function)(" << implode(localFuncArgDcl_, ", ") << ");\n";
+        for (const std::string& dcl : localFuncArgDcl_) {
+            out << _spaces << dcl << ";\n";
+        }
+        out << "} " << argsStruct << ";\n"
+               "\n"
+               "static void " << _functionName << "_task(void* a) {\n" <<
+               _spaces << argsStruct << "* t = (" << argsStruct << "*) a;\n" <<
+               _spaces << "(*t->function)(";
+        std::vector<std::string> names = localFunctionArgumentNames();
+        for (size_t a = 0; a < names.size(); ++a) {
+            if (a > 0) out << ", ";
+            out << "t->" << names[a];
+        }
+        out << ");\n"
+               "}\n"
+               "\n";
+    }
+
+    /**
+     * Evaluates the local functions level by level in the wrapper function.
+     *
+     * @param out the output stream
+     * @param localFuncNames the names of the local functions
+     * @param levels the level of each local function
+     */
+    virtual void printLocalFunctionTaskCalls(std::ostream& out,
+                                             const std::vector<std::string>& localFuncNames,
+                                             const std::vector<size_t>& levels) {
+        const size_t nFunc = localFuncNames.size();
+        const size_t nLevels = *std::max_element(levels.begin(), levels.end()) + 1;
+
+        std::vector<std::vector<size_t>> byLevel(nLevels);
+        for (size_t f = 0; f < nFunc; ++f) {
+            byLevel[levels[f]].push_back(f);
+        }
+
+        size_t maxTasks = 0;
+        for (const auto& l : byLevel) {
+            maxTasks = std::max(maxTasks, l.size());
+        }
+
+        out << _spaces << "// local functions evaluated as tasks (" << nLevels << " levels)\n" <<
+               _spaces << "static void (*const task_functions[" << nFunc << "])(" << implode(localFuncArgDcl_, ", ") << ") = {";
+        size_t c = 0;
+        for (const auto& l : byLevel) {
+            for (size_t f : l) {
+                if (c++ > 0) out << ", ";
+                out << localFuncNames[f];
+            }
+        }
+        out << "};\n" <<
+               _spaces << "static const " << U_INDEX_TYPE << " task_level_start[" << (nLevels + 1) << "] = {0";
+        c = 0;
+        for (const auto& l : byLevel) {
+            c += l.size();
+            out << ", " << c;
+        }
+        out << "};\n";
+
+        std::string s2 = _spaces + _spaces;
+        std::string s3 = s2 + _spaces;
+
+        if (_localFunctionTasks == MultiThreadingType::OPENMP) {
+            out << _spaces << U_INDEX_TYPE << " task_l;\n" <<
+                   _spaces << "long task_i, task_n;\n" <<
+                   _spaces << "int task_enabled = !cppadcg_openmp_is_disabled();\n" <<
+                   _spaces << "unsigned int task_threads = cppadcg_openmp_get_threads();\n" <<
+                   _spaces << "for(task_l = 0; task_l < " << nLevels << "; ++task_l) {\n" <<
+                   s2 << "task_n = (long) (task_level_start[task_l + 1] - task_level_start[task_l]);\n"
+                   "#pragma omp parallel for schedule(dynamic, 1) if(task_enabled && task_n > 1) num_threads(task_threads)\n" <<
+                   s2 << "for(task_i = 0; task_i < task_n; ++task_i) {\n" <<
+                   s3 << "(*task_functions[task_level_start[task_l] + task_i])(" << localFuncArgs_ << ");\n" <<
+                   s2 << "}\n" <<
+                   _spaces << "}\n";
+            return;
+        }
+
+        const std::string argsStruct = _functionName + "_task_args";
+        std::vector<std::string> names = localFunctionArgumentNames();
+
+        out << _spaces << argsStruct << " task_args[" << maxTasks << "];\n" <<
+               _spaces << U_INDEX_TYPE << " task_l, task_i, task_n;\n" <<
+               _spaces << "for(task_i = 0; task_i < " << maxTasks << "; ++task_i) {\n";
+        for (const std::string& name : names) {
+            out << s2 << "task_args[task_i]." << name << " = " << name << ";\n";
+        }
+        out << _spaces << "}\n" <<
+               _spaces << "for(task_l = 0; task_l < " << nLevels << "; ++task_l) {\n" <<
+               s2 << "task_n = task_level_start[task_l + 1] - task_level_start[task_l];\n" <<
+               s2 << "if(task_n == 1) {\n" <<
+               s3 << "(*task_functions[task_level_start[task_l]])(" << localFuncArgs_ << ");\n" <<
+               s2 << "} else {\n" <<
+               s3 << "for(task_i = 0; task_i < task_n; ++task_i) {\n" <<
+               s3 << _spaces << "task_args[task_i].function = task_functions[task_level_start[task_l] + task_i];\n" <<
+               s3 << _spaces << "cppadcg_thpool_add_job(" << _functionName << "_task, &task_args[task_i], 0, 0);\n" <<
+               s3 << "}\n" <<
+               s3 << "cppadcg_thpool_wait();\n" <<
+               s2 << "}\n" <<
+               _spaces << "}\n";
+    }
+
+    /**
+     * The names of the arguments passed to local functions.
+     */
+    inline std::vector<std::string> localFunctionArgumentNames() const {
+        std::vector<std::string> names;
+        std::istringstream is(localFuncArgs_);
+        std::string name;
+        while (std::getline(is, name, ',')) {
+            size_t b = name.find_first_not_of(' ');
+            size_t e = name.find_last_not_of(' ');
+            names.push_back(name.substr(b, e - b + 1));
+        }
+        return names;
+    }
+
     virtual void saveLocalFunction(std::vector<std::string>& localFuncNames,
                                    bool zeroDependentArray) {
         _ss << _functionName << "__" << (localFuncNames.size() + 1);
@@ -1053,6 +1544,7 @@ protected:
         _ss << "#include <math.h>\n"
                 "#include <stdio.h>\n\n"
                 << ATOMICFUN_STRUCT_DEFINITION << "\n\n";
+        printAtomicDirectCallDeclarations(_ss);
         printFunctionDeclaration(_ss, "void", funcName, localFuncArgDcl_);
         _ss << " {\n";
         _nameGen->customFunctionVariableDeclarations(_ss);
@@ -1228,7 +1720,9 @@ protected:
     }
 
     bool requiresVariableDependencies() const override {
-        return false;
+        return (_splitByDependencies || _localFunctionTasks != MultiThreadingType::NONE) &&
+               _maxAssignmentsPerFunction > 0 && _sources != nullptr &&
+               !_functionName.empty();
     }
 
     virtual void pushIndependentVariableName(Node& op) {
@@ -1817,8 +2311,13 @@ protected:
         printArrayStructInit(_ATOMIC_TY, *ty[p]); // also does indentation
         _ss.str("");
 
-        _streamStack << _indentation << "atomicFun.forward(atomicFun.libModel, "
-                     << atomicIndex << ", " << q << ", " << p << ", "
+        auto itDirect = _atomicDirectCalls.find(_info->atomicFunctionId2Name.at(id));
+        if (itDirect != _atomicDirectCalls.end()) {
+            _streamStack << _indentation << itDirect->second << "_forward(atomicFun, ";
+        } else {
+            _streamStack << _indentation << "atomicFun.forward(atomicFun.libModel, ";
+        }
+        _streamStack << atomicIndex << ", " << q << ", " << p << ", "
                      << _ATOMIC_TX << ", &" << _ATOMIC_TY << "); // "
                      << _info->atomicFunctionId2Name.at(id)
                      << "\n";
@@ -1865,8 +2364,13 @@ protected:
         printArrayStructInit(_ATOMIC_PX, *px[0]); // also does indentation
         _ss.str("");
 
-        _streamStack << _indentation << "atomicFun.reverse(atomicFun.libModel, "
-                     << atomicIndex << ", " << p << ", "
+        auto itDirect = _atomicDirectCalls.find(_info->atomicFunctionId2Name.at(id));
+        if (itDirect != _atomicDirectCalls.end()) {
+            _streamStack << _indentation << itDirect->second << "_reverse(atomicFun, ";
+        } else {
+            _streamStack << _indentation << "atomicFun.reverse(atomicFun.libModel, ";
+        }
+        _streamStack << atomicIndex << ", " << p << ", "
                      << _ATOMIC_TX << ", &" << _ATOMIC_PX << ", " << _ATOMIC_PY << "); // "
                      << _info->atomicFunctionId2Name.at(id)
                      << "\n";
@@ -0,0 +1,114 @@
+#ifndef CPPAD_CG_LANGUAGE_C_SINGLE_PRECISION_INCLUDED
+#define CPPAD_CG_LANGUAGE_C_SINGLE_PRECISION_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+#define CPPAD_CG_C_LANG_FLOAT_FUNCNAME(fn) \
+inline const std::string& fn ## FuncName() override {\
+    static const std::string name(#fn "f");\
+    return name;\
+}
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Generates C source code using single precision (float) variables and
+ * mathematical functions (requires C99) for an operation graph created with
+ * a different base type (e.g. double).
+ * Parameters are rounded to single precision.
+ */
+template<class Base>
+class LanguageCSinglePrecision : public LanguageC<Base> {
+public:
+
+    /**
+     * Creates a C language source code generator using float variables
+     *
+     * @param spaces number of spaces for indentations
+     */
+    explicit LanguageCSinglePrecision(size_t spaces = 3) :
+        LanguageC<Base>("float", spaces) {
+        this->setParameterPrecision(std::numeric_limits<float>::max_digits10);
+    }
+
+    inline const std::string& absFuncName() override {
+        static const std::string name("fabsf");
+        return name;
+    }
+
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(acos)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(asin)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(atan)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(cosh)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(cos)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(exp)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(log)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(sinh)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(sin)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(sqrt)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(tanh)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(tan)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(pow)
+
+#if CPPAD_USE_CPLUSPLUS_2011
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(erf)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(erfc)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(asinh)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(acosh)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(atanh)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(expm1)
+    CPPAD_CG_C_LANG_FLOAT_FUNCNAME(log1p)
+#endif
+
+protected:
+
+    void printParameter(const Base& value) override {
+        writeFloatParameter(value, this->_code);
+    }
+
+    void pushParameter(const Base& value) override {
+        writeFloatParameter(value, this->_streamStack);
+    }
+
+    /**
+     * Prints a single precision literal (e.g. 0.1f) so that operations are
+     * not promoted to double precision.
+     */
+    template<class Output>
+    void writeFloatParameter(const Base& value, Output& output) {
+        std::ostringstream os;
+        os << std::setprecision(this->_parameterPrecision) << float(value);
+
+        std::string number = os.str();
+        output << number;
+
+        if (number.find_first_of("ni") != std::string::npos) {
+            return; // nan or inf
+        }
+
+        if (number.find('.') == std::string::npos && number.find('e') == std::string::npos) {
+            output << '.';
+        }
+        output << 'f';
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+#undef CPPAD_CG_C_LANG_FLOAT_FUNCNAME
+
+#endif
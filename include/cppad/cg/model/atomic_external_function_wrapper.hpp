@@ -19,10 +19,25 @@
 namespace CppAD {
 namespace cg {
 
+/**
+ * Allows compiled models to call atomic functions (atomic_base).
+ *
+ * Each wrapper holds its own workspace for the Taylor coefficients which is
+ * only ever grown, so that repeated calls from the compiled code do not
+ * allocate memory nor interfere with the buffers of the calling model.
+ */
 template<class Base>
 class AtomicExternalFunctionWrapper : public ExternalFunctionWrapper<Base> {
 private:
     atomic_base<Base>* atomic_;
+    /**
+     * workspace for the Taylor coefficients/partials
+     */
+    CppAD::vector<Base> tx_, ty_, px_, py_;
+    /**
+     * always empty (variable information is not used)
+     */
+    CppAD::vector<bool> vx_, vy_;
 public:
 
     inline AtomicExternalFunctionWrapper(atomic_base<Base>& atomic) :
@@ -39,18 +54,16 @@ public:
         size_t m = ty.size;
         size_t n = tx[0].size;
 
-        CppAD::vector<bool> vx, vy;
-
-        convert(tx, libModel._tx, n, p, p + 1);
+        convert(tx, tx_, n, p, p + 1);
 
         size_t ty_size = m * (p + 1);
-        libModel._ty.resize(ty_size);
+        ty_.resize(ty_size);
 
-        std::fill(&libModel._ty[0], &libModel._ty[0] + ty_size, Base(0));
+        std::fill(ty_.data(), ty_.data() + ty_size, Base(0));
 
-        bool ret = atomic_->forward(q, p, vx, vy, libModel._tx, libModel._ty);
+        bool ret = atomic_->forward(q, p, vx_, vy_, tx_, ty_);
 
-        convertAdd(libModel._ty, ty, m, p, p);
+        convertAdd(ty_, ty, m, p, p);
 
         return ret;
     }
@@ -63,30 +76,30 @@ public:
         size_t m = py[0].size;
         size_t n = tx[0].size;
 
-        convert(tx, libModel._tx, n, p, p + 1);
+        convert(tx, tx_, n, p, p + 1);
 
-        libModel._ty.resize(m * (p + 1));
-        std::fill(&libModel._ty[0], &libModel._ty[0] + libModel._ty.size(), Base(0));
+        size_t ty_size = m * (p + 1);
+        ty_.resize(ty_size);
+        std::fill(ty_.data(), ty_.data() + ty_size, Base(0));
 
-        convert(py, libModel._py, m, p, p + 1);
+        convert(py, py_, m, p, p + 1);
 
         size_t px_size = n * (p + 1);
-        libModel._px.resize(px_size);
+        px_.resize(px_size);
 
-        std::fill(&libModel._px[0], &libModel._px[0] + px_size, Base(0));
+        std::fill(px_.data(), px_.data() + px_size, Base(0));
 
 #ifndef NDEBUG
         if (libModel._evalAtomicForwardOne4CppAD) {
             // only required in order to avoid an issue with a validation inside CppAD
-            CppAD::vector<bool> vx, vy;
-            if (!atomic_->forward(p, p, vx, vy, libModel._tx, libModel._ty))
+            if (!atomic_->forward(p, p, vx_, vy_, tx_, ty_))
                 return false;
         }
 #endif
 
-        bool ret = atomic_->reverse(p, libModel._tx, libModel._ty, libModel._px, libModel._py);
+        bool ret = atomic_->reverse(p, tx_, ty_, px_, py_);
 
-        convertAdd(libModel._px, px, n, p, 0); // k=0 for both p=0 and p=1
+        convertAdd(px_, px, n, p, 0); // k=0 for both p=0 and p=1
 
         return ret;
     }
@@ -99,13 +112,20 @@ private:
                         size_t p,
                         size_t kmax) {
         size_t p1 = p + 1;
-        to.resize(n * p1);
+        to.resize(n * p1); // CppAD::vector keeps its capacity
+
+        if (p == 0 && !from[0].sparse) {
+            // same memory layout: no need to interleave the coefficients
+            const Base* values = static_cast<const Base*> (from[0].data);
+            std::copy(values, values + n, to.data());
+            return;
+        }
 
         for (size_t k = 0; k < kmax; k++) {
-            Base* values = static_cast<Base*> (from[k].data);
+            const Base* values = static_cast<const Base*> (from[k].data);
             if (from[k].sparse) {
                 if (p == 0) {
-                    std::fill(&to[0], &to[0] + n, Base(0));
+                    std::fill(to.data(), to.data() + n, Base(0));
                 } else {
                     for (size_t j = 0; j < n; j++) {
                         to[j * p1 + k] = Base(0);
@@ -135,7 +155,7 @@ private:
         Base* values = static_cast<Base*> (to.data);
 
         if (p == 0) {
-            std::copy(&from[0], &from[0] + n, values);
+            std::copy(from.data(), from.data() + n, values);
         } else {
             size_t p1 = p + 1;
 
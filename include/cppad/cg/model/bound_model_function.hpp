@@ -0,0 +1,94 @@
+#ifndef CPPAD_CG_BOUND_MODEL_FUNCTION_INCLUDED
+#define CPPAD_CG_BOUND_MODEL_FUNCTION_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * A compiled model function bound to fixed input and output arrays.
+ *
+ * The arrays and the model are validated only once when the object is
+ * created (e.g. FunctorGenericModel::bindForwardZero()) and each call
+ * invokes the compiled function directly.
+ * New values should be written into the bound input arrays before each call
+ * and the results are placed in the bound output arrays.
+ *
+ * The bound arrays, the model, and the model library must remain valid
+ * while this object is used.
+ * Like the model, it should only be used by one thread at a time.
+ */
+template<class Base>
+class BoundModelFunction {
+public:
+    using Function = void (*)(Base const*const*, Base * const*, LangCAtomicFun);
+private:
+    /// the compiled function
+    Function _func;
+    /// the input arrays
+    std::vector<const Base*> _in;
+    /// the output arrays
+    std::vector<Base*> _out;
+    /// used by the compiled function to call atomic functions
+    LangCAtomicFun _atomicFuncArg;
+public:
+
+    /**
+     * Creates an object which is not bound to any function.
+     */
+    inline BoundModelFunction() :
+        _func(nullptr),
+        _atomicFuncArg{nullptr} {
+    }
+
+    /**
+     * Creates a bound function.
+     *
+     * @param func the compiled function
+     * @param in the input arrays
+     * @param out the output arrays
+     * @param atomicFuncArg the atomic functions argument of the model
+     */
+    inline BoundModelFunction(Function func,
+                              std::vector<const Base*> in,
+                              std::vector<Base*> out,
+                              const LangCAtomicFun& atomicFuncArg) :
+        _func(func),
+        _in(std::move(in)),
+        _out(std::move(out)),
+        _atomicFuncArg(atomicFuncArg) {
+        CPPADCG_ASSERT_KNOWN(_func != nullptr, "Invalid compiled function")
+    }
+
+    /**
+     * Whether or not this object is bound to a function.
+     */
+    inline bool isBound() const {
+        return _func != nullptr;
+    }
+
+    /**
+     * Evaluates the compiled function using the bound arrays.
+     */
+    inline void operator()() const {
+        (*_func)(_in.data(), _out.data(), _atomicFuncArg);
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
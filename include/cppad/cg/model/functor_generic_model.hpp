@@ -45,7 +45,7 @@ protected:
     std::vector<std::string> _atomicNames; // names of the atomic/external functions required by this model
     std::vector<ExternalFunctionWrapper<Base>* > _atomic;
     size_t _missingAtomicFunctions;
-    CppAD::vector<Base> _tx, _ty, _px, _py;
+    CppAD::vector<Base> _ty, _px;
     // original model function
     void (*_zero)(Base const*const*, Base * const*, LangCAtomicFun);
     // first order forward mode
@@ -68,6 +68,37 @@ protected:
     void (*_sparseJacobian)(Base const*const*, Base * const*, LangCAtomicFun);
     // sparse hessian function in the dynamic library
     void (*_sparseHessian)(Base const*const*, Base * const*, LangCAtomicFun);
+    // single precision sparse jacobian function in the dynamic library
+    void (*_sparseJacobianFloat)(float const*const*, float * const*, LangCAtomicFun);
+    // single precision sparse hessian function in the dynamic library
+    void (*_sparseHessianFloat)(float const*const*, float * const*, LangCAtomicFun);
+    // job timing profiles of the multithreaded sparse jacobian and hessian
+    unsigned long (*_sparseJacobianProfileGet)(float*, unsigned int*);
+    void (*_sparseJacobianProfileSet)(const float*, unsigned long, unsigned int);
+    unsigned long (*_sparseHessianProfileGet)(float*, unsigned int*);
+    void (*_sparseHessianProfileSet)(const float*, unsigned long, unsigned int);
+    // independent variables and multipliers converted to single precision
+    std::vector<float> _xFloat, _wFloat;
+    // first order forward mode for multiple directions
+    void (*_forwardOneMulti)(Base const*const*, Base * const*, LangCAtomicFun);
+    // first order reverse mode for multiple directions
+    void (*_reverseOneMulti)(Base const*const*, Base * const*, LangCAtomicFun);
+    // number of directions evaluated by each call to _forwardOneMulti
+    size_t _forwardOneMultiDirections;
+    // number of directions evaluated by each call to _reverseOneMulti
+    size_t _reverseOneMultiDirections;
+    // auxiliary arrays for incomplete groups of directions
+    std::vector<Base> _multiIn, _multiOut;
+    // forward mode for Taylor coefficients
+    void (*_forwardTaylor)(Base const*const*, Base * const*, LangCAtomicFun);
+    // highest order of the coefficients determined by _forwardTaylor
+    size_t _forwardTaylorOrder;
+    // auxiliary arrays for the Taylor coefficients (ordered by order)
+    std::vector<Base> _taylorIn, _taylorOut;
+    // Hessian-vector product function in the dynamic library
+    void (*_hessianVectorProduct)(Base const*const*, Base * const*, LangCAtomicFun);
+    // number of vectors multiplied by each call to _hessianVectorProduct
+    size_t _hessianVectorProducts;
     //
     void (*_forwardOneSparsity)(unsigned long, unsigned long const**, unsigned long*);
     //
@@ -86,8 +117,22 @@ protected:
             unsigned long const** row,
             unsigned long const** col,
             unsigned long * nnz);
+    // row/column pointers of the sparse jacobian
+    void (*_jacobianSparsityPtr)(unsigned long const** ptr,
+            unsigned long * size);
+    // row/column pointers of the sparse hessian
+    void (*_hessianSparsityPtr)(unsigned long const** ptr,
+            unsigned long * size);
+    // the order of the sparse jacobian and hessian elements
+    SparseMatrixLayout _jacobianLayout, _hessianLayout;
+    // the elements of the sparse hessian
+    MatrixTriangle _hessianTriangle;
     void (*_atomicFunctions)(const char*** names,
             unsigned long * n);
+    // runs jobs using the thread pool of the model library
+    void (*_runThreadPoolJobs)(void (*)(void*), void**, unsigned long);
+    // number of threads used by the thread pool of the model library
+    unsigned int (*_getThreadNumber)();
 
 public:
 
@@ -260,6 +305,42 @@ public:
         return s;
     }
 
+    SparseMatrixLayout getSparseJacobianLayout() override {
+        return _jacobianLayout;
+    }
+
+    void JacobianSparsityPointers(size_t const** ptr,
+                                  size_t* size) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_jacobianSparsityPtr != nullptr, "No Jacobian sparsity pointers function defined in the dynamic library");
+
+        unsigned long const* dptr;
+        unsigned long dsize;
+        (*_jacobianSparsityPtr)(&dptr, &dsize);
+        *ptr = dptr;
+        *size = dsize;
+    }
+
+    SparseMatrixLayout getSparseHessianLayout() override {
+        return _hessianLayout;
+    }
+
+    MatrixTriangle getSparseHessianTriangle() override {
+        return _hessianTriangle;
+    }
+
+    void HessianSparsityPointers(size_t const** ptr,
+                                 size_t* size) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_hessianSparsityPtr != nullptr, "No Hessian sparsity pointers function defined in the dynamic library");
+
+        unsigned long const* dptr;
+        unsigned long dsize;
+        (*_hessianSparsityPtr)(&dptr, &dsize);
+        *ptr = dptr;
+        *size = dsize;
+    }
+
     void HessianSparsity(size_t i, std::vector<size_t>& rows,
                          std::vector<size_t>& cols) override {
         CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
@@ -752,6 +833,13 @@ public:
                               row, col,
                               nnz,
                               hess);
+
+        if (_hessianTriangle != MatrixTriangle::Full) {
+            // the other triangle is determined using symmetry
+            for (size_t e = 0; e < nnz; e++) {
+                hess[col[e] * _n + row[e]] = compressed[e];
+            }
+        }
     }
 
     void SparseHessian(const std::vector<Base> &x,
@@ -843,8 +931,422 @@ public:
         }
     }
 
+    bool isForwardOneMultiAvailable() override {
+        return _forwardOneMulti != nullptr;
+    }
+
+    size_t getForwardOneMultiMaxDirections() override {
+        return _forwardOneMultiDirections;
+    }
+
+    void ForwardOneMulti(ArrayView<const Base> x,
+                         ArrayView<const Base> tx1,
+                         ArrayView<Base> ty1) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_forwardOneMulti != nullptr, "No first order forward mode function for multiple directions defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " which is not supported by multiple direction functions");
+        CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size");
+        CPPADCG_ASSERT_KNOWN(_n > 0 && tx1.size() % _n == 0, "Invalid directions array size");
+        CPPADCG_ASSERT_KNOWN(ty1.size() == (tx1.size() / _n) * _m, "Invalid directional derivatives array size");
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0, "Some atomic functions used by the compiled model have not been specified yet");
+
+        const Base* fixedIn[1] = {x.data()};
+        evalMultiDirections(_forwardOneMulti, _forwardOneMultiDirections, fixedIn, 1, tx1, _n, ty1, _m);
+    }
+
+    bool isReverseOneMultiAvailable() override {
+        return _reverseOneMulti != nullptr;
+    }
+
+    size_t getReverseOneMultiMaxDirections() override {
+        return _reverseOneMultiDirections;
+    }
+
+    void ReverseOneMulti(ArrayView<const Base> x,
+                         ArrayView<const Base> py,
+                         ArrayView<Base> px) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_reverseOneMulti != nullptr, "No first order reverse mode function for multiple directions defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " which is not supported by multiple direction functions");
+        CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size");
+        CPPADCG_ASSERT_KNOWN(_m > 0 && py.size() % _m == 0, "Invalid weights array size");
+        CPPADCG_ASSERT_KNOWN(px.size() == (py.size() / _m) * _n, "Invalid partials array size");
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0, "Some atomic functions used by the compiled model have not been specified yet");
+
+        const Base* fixedIn[1] = {x.data()};
+        evalMultiDirections(_reverseOneMulti, _reverseOneMultiDirections, fixedIn, 1, py, _m, px, _n);
+    }
+
+    bool isForwardTaylorAvailable() override {
+        return _forwardTaylor != nullptr;
+    }
+
+    size_t getForwardTaylorOrder() override {
+        return _forwardTaylorOrder;
+    }
+
+    void ForwardTaylor(size_t p,
+                       ArrayView<const Base> tx,
+                       ArrayView<Base> ty) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_forwardTaylor != nullptr, "No forward mode function for Taylor coefficients defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " which is not supported by the forward mode function for Taylor coefficients");
+        CPPADCG_ASSERT_KNOWN(p <= _forwardTaylorOrder, "The requested order is higher than the order of the compiled function");
+        CPPADCG_ASSERT_KNOWN(tx.size() == _n * (p + 1), "Invalid independent Taylor coefficients array size");
+        CPPADCG_ASSERT_KNOWN(ty.size() == _m * (p + 1), "Invalid dependent Taylor coefficients array size");
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0, "Some atomic functions used by the compiled model have not been specified yet");
+
+        const size_t q = _forwardTaylorOrder;
+
+        // the compiled function uses coefficients ordered by order
+        _taylorIn.resize(_n * (q + 1));
+        for (size_t j = 0; j < _n; j++) {
+            for (size_t k = 0; k <= p; k++)
+                _taylorIn[k * _n + j] = tx[j * (p + 1) + k];
+        }
+        // higher orders do not affect the requested coefficients
+        std::fill(_taylorIn.begin() + _n * (p + 1), _taylorIn.end(), Base(0));
+
+        _taylorOut.resize(_m * (q + 1));
+
+        _inHess[0] = &_taylorIn[0];
+        _inHess[1] = &_taylorIn[0] + _n;
+        _out[0] = &_taylorOut[0];
+
+        (*_forwardTaylor)(&_inHess[0], &_out[0], _atomicFuncArg);
+
+        for (size_t i = 0; i < _m; i++) {
+            for (size_t k = 0; k <= p; k++)
+                ty[i * (p + 1) + k] = _taylorOut[k * _m + i];
+        }
+    }
+
+    bool isHessianVectorProductAvailable() override {
+        return _hessianVectorProduct != nullptr;
+    }
+
+    size_t getHessianVectorProductMaxVectors() override {
+        return _hessianVectorProducts;
+    }
+
+    void HessianVectorProduct(ArrayView<const Base> x,
+                              ArrayView<const Base> w,
+                              ArrayView<const Base> v,
+                              ArrayView<Base> hv) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_hessianVectorProduct != nullptr, "No Hessian-vector product function defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " which is not supported by the Hessian-vector product function");
+        CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size");
+        CPPADCG_ASSERT_KNOWN(w.size() == _m, "Invalid multiplier array size");
+        CPPADCG_ASSERT_KNOWN(_n > 0 && v.size() % _n == 0, "Invalid vectors array size");
+        CPPADCG_ASSERT_KNOWN(hv.size() == v.size(), "Invalid products array size");
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0, "Some atomic functions used by the compiled model have not been specified yet");
+
+        const Base* fixedIn[2] = {x.data(), w.data()};
+        evalMultiDirections(_hessianVectorProduct, _hessianVectorProducts, fixedIn, 2, v, _n, hv, _n);
+    }
+
+    bool isSparseJacobianFloatAvailable() override {
+        return _jacobianSparsity != nullptr && _sparseJacobianFloat != nullptr;
+    }
+
+    void SparseJacobianFloat(ArrayView<const Base> x,
+                             ArrayView<float> jac,
+                             size_t const** row,
+                             size_t const** col) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_sparseJacobianFloat != nullptr, "No single precision sparse Jacobian function defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " which is not supported by single precision functions");
+        CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size");
+
+        unsigned long const* drow;
+        unsigned long const* dcol;
+        unsigned long nnz;
+        (*_jacobianSparsity)(&drow, &dcol, &nnz);
+        CPPADCG_ASSERT_KNOWN(nnz == jac.size(), "Invalid number of non-zero elements in Jacobian");
+        *row = drow;
+        *col = dcol;
+
+        if (nnz > 0) {
+            _xFloat.assign(x.begin(), x.end());
+
+            float const* in[1] = {_xFloat.data()};
+            float* out[1] = {jac.data()};
+
+            (*_sparseJacobianFloat)(in, out, _atomicFuncArg);
+        }
+    }
+
+    bool isSparseHessianFloatAvailable() override {
+        return _hessianSparsity != nullptr && _sparseHessianFloat != nullptr;
+    }
+
+    void SparseHessianFloat(ArrayView<const Base> x,
+                            ArrayView<const Base> w,
+                            ArrayView<float> hess,
+                            size_t const** row,
+                            size_t const** col) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_sparseHessianFloat != nullptr, "No single precision sparse Hessian function defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " which is not supported by single precision functions");
+        CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size");
+        CPPADCG_ASSERT_KNOWN(w.size() == _m, "Invalid multiplier array size");
+
+        unsigned long const* drow, *dcol;
+        unsigned long nnz;
+        (*_hessianSparsity)(&drow, &dcol, &nnz);
+        CPPADCG_ASSERT_KNOWN(nnz == hess.size(), "Invalid number of non-zero elements in Hessian");
+        *row = drow;
+        *col = dcol;
+
+        if (nnz > 0) {
+            _xFloat.assign(x.begin(), x.end());
+            _wFloat.assign(w.begin(), w.end());
+
+            float const* in[2] = {_xFloat.data(), _wFloat.data()};
+            float* out[1] = {hess.data()};
+
+            (*_sparseHessianFloat)(in, out, _atomicFuncArg);
+        }
+    }
+
+    bool isBindAvailable() override {
+        return true;
+    }
+
+    BoundModelFunction<Base> bindForwardZero(ArrayView<const Base> x,
+                                             ArrayView<Base> dep) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_zero != nullptr, "No zero order forward function defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " please use the variable size methods");
+        CPPADCG_ASSERT_KNOWN(dep.size() == _m, "Invalid dependent array size");
+        CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size");
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0, "Some atomic functions used by the compiled model have not been specified yet");
+
+        return BoundModelFunction<Base>(_zero, {x.data()}, {dep.data()}, _atomicFuncArg);
+    }
+
+    BoundModelFunction<Base> bindJacobian(ArrayView<const Base> x,
+                                          ArrayView<Base> jac) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_jacobian != nullptr, "No Jacobian function defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " please use the variable size methods");
+        CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size");
+        CPPADCG_ASSERT_KNOWN(jac.size() == _m * _n, "Invalid Jacobian array size");
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0, "Some atomic functions used by the compiled model have not been specified yet");
+
+        return BoundModelFunction<Base>(_jacobian, {x.data()}, {jac.data()}, _atomicFuncArg);
+    }
+
+    BoundModelFunction<Base> bindHessian(ArrayView<const Base> x,
+                                         ArrayView<const Base> w,
+                                         ArrayView<Base> hess) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_hessian != nullptr, "No Hessian function defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " please use the variable size methods");
+        CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size");
+        CPPADCG_ASSERT_KNOWN(w.size() == _m, "Invalid multiplier array size");
+        CPPADCG_ASSERT_KNOWN(hess.size() == _n * _n, "Invalid Hessian size");
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0, "Some atomic functions used by the compiled model have not been specified yet");
+
+        return BoundModelFunction<Base>(_hessian, {x.data(), w.data()}, {hess.data()}, _atomicFuncArg);
+    }
+
+    BoundModelFunction<Base> bindSparseJacobian(ArrayView<const Base> x,
+                                                ArrayView<Base> jac,
+                                                size_t const** row,
+                                                size_t const** col) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_sparseJacobian != nullptr, "No sparse Jacobian function defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " please use the variable size methods");
+        CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size");
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0, "Some atomic functions used by the compiled model have not been specified yet");
+
+        unsigned long const* drow;
+        unsigned long const* dcol;
+        unsigned long nnz;
+        (*_jacobianSparsity)(&drow, &dcol, &nnz);
+        CPPADCG_ASSERT_KNOWN(nnz == jac.size(), "Invalid number of non-zero elements in Jacobian");
+        *row = drow;
+        *col = dcol;
+
+        return BoundModelFunction<Base>(_sparseJacobian, {x.data()}, {jac.data()}, _atomicFuncArg);
+    }
+
+    BoundModelFunction<Base> bindSparseHessian(ArrayView<const Base> x,
+                                               ArrayView<const Base> w,
+                                               ArrayView<Base> hess,
+                                               size_t const** row,
+                                               size_t const** col) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_sparseHessian != nullptr, "No sparse Hessian function defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " please use the variable size methods");
+        CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size");
+        CPPADCG_ASSERT_KNOWN(w.size() == _m, "Invalid multiplier array size");
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0, "Some atomic functions used by the compiled model have not been specified yet");
+
+        unsigned long const* drow, *dcol;
+        unsigned long nnz;
+        (*_hessianSparsity)(&drow, &dcol, &nnz);
+        CPPADCG_ASSERT_KNOWN(nnz == hess.size(), "Invalid number of non-zero elements in Hessian");
+        *row = drow;
+        *col = dcol;
+
+        return BoundModelFunction<Base>(_sparseHessian, {x.data(), w.data()}, {hess.data()}, _atomicFuncArg);
+    }
+
+    ThreadPoolProfile getThreadPoolProfile() override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+
+        ThreadPoolProfile profile;
+        getFunctionProfile(profile, ModelCSourceGen<Base>::FUNCTION_SPARSE_JACOBIAN, _sparseJacobianProfileGet);
+        getFunctionProfile(profile, ModelCSourceGen<Base>::FUNCTION_SPARSE_HESSIAN, _sparseHessianProfileGet);
+        return profile;
+    }
+
+    void setThreadPoolProfile(const ThreadPoolProfile& profile) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+
+        setFunctionProfile(profile, ModelCSourceGen<Base>::FUNCTION_SPARSE_JACOBIAN, _sparseJacobianProfileSet);
+        setFunctionProfile(profile, ModelCSourceGen<Base>::FUNCTION_SPARSE_HESSIAN, _sparseHessianProfileSet);
+    }
+
+    void ForwardZeroMany(const std::vector<const Base*>& x,
+                         const std::vector<Base*>& dep,
+                         size_t chunkSize = 0) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_zero != nullptr, "No zero order forward function defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " please use the variable size methods");
+        CPPADCG_ASSERT_KNOWN(x.size() == dep.size(), "The number of independent and dependent arrays must be the same");
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0, "Some atomic functions used by the compiled model have not been specified yet");
+
+        evaluatePoints(_zero, x, dep, chunkSize);
+    }
+
+    void SparseJacobianMany(const std::vector<const Base*>& x,
+                            const std::vector<Base*>& jac,
+                            size_t const** row,
+                            size_t const** col,
+                            size_t chunkSize = 0) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, "Model library is not ready (possibly closed)");
+        CPPADCG_ASSERT_KNOWN(_sparseJacobian != nullptr, "No sparse Jacobian function defined in the dynamic library");
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1, "The number of independent variable arrays is higher than 1,"
+                             " please use the variable size methods");
+        CPPADCG_ASSERT_KNOWN(x.size() == jac.size(), "The number of independent and Jacobian arrays must be the same");
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0, "Some atomic functions used by the compiled model have not been specified yet");
+
+        unsigned long const* drow;
+        unsigned long const* dcol;
+        unsigned long nnz;
+        (*_jacobianSparsity)(&drow, &dcol, &nnz);
+        *row = drow;
+        *col = dcol;
+
+        if (nnz > 0) {
+            evaluatePoints(_sparseJacobian, x, jac, chunkSize);
+        }
+    }
+
 protected:
 
+    /**
+     * A group of points evaluated by a single job
+     */
+    struct PointsJob {
+        void (*function)(Base const*const*, Base * const*, LangCAtomicFun);
+        LangCAtomicFun atomicFuncArg;
+        const Base* const* x;
+        Base* const* y;
+        size_t size;
+    };
+
+    static void evaluatePointsJob(void* arg) {
+        const PointsJob& job = *static_cast<const PointsJob*>(arg);
+
+        // each job uses its own input and output arrays
+        for (size_t p = 0; p < job.size; ++p) {
+            const Base* in[1] = {job.x[p]};
+            Base* out[1] = {job.y[p]};
+            (*job.function)(in, out, job.atomicFuncArg);
+        }
+    }
+
+    /**
+     * Evaluates a model function for several points using the thread pool
+     * of the model library.
+     * The points are evaluated sequentially when the model uses atomic
+     * functions since their evaluation relies on data in this object.
+     */
+    inline void evaluatePoints(void (*function)(Base const*const*, Base * const*, LangCAtomicFun),
+                               const std::vector<const Base*>& x,
+                               const std::vector<Base*>& y,
+                               size_t chunkSize) {
+        size_t nPoints = x.size();
+        if (nPoints == 0)
+            return;
+
+        size_t nThreads = _getThreadNumber != nullptr ? (*_getThreadNumber)() : 1;
+
+        if (_runThreadPoolJobs == nullptr || !_atomicNames.empty() || nThreads <= 1 || nPoints == 1) {
+            PointsJob job{function, _atomicFuncArg, x.data(), y.data(), nPoints};
+            evaluatePointsJob(&job);
+            return;
+        }
+
+        if (chunkSize == 0) {
+            // several chunks per thread so that the load can be balanced
+            chunkSize = std::max<size_t>(1, nPoints / (4 * nThreads));
+        }
+
+        size_t nJobs = (nPoints + chunkSize - 1) / chunkSize;
+        std::vector<PointsJob> jobs(nJobs);
+        std::vector<void*> args(nJobs);
+        for (size_t j = 0; j < nJobs; ++j) {
+            size_t start = j * chunkSize;
+            jobs[j] = PointsJob{function, _atomicFuncArg, &x[start], &y[start], std::min(chunkSize, nPoints - start)};
+            args[j] = &jobs[j];
+        }
+
+        (*_runThreadPoolJobs)(&evaluatePointsJob, args.data(), nJobs);
+    }
+
+    static void getFunctionProfile(ThreadPoolProfile& profile,
+                                   const std::string& function,
+                                   unsigned long (*profileGet)(float*, unsigned int*)) {
+        if (profileGet == nullptr)
+            return;
+
+        ThreadPoolProfile::Function& f = profile.functions[function];
+        f.elapsed.resize((*profileGet)(nullptr, nullptr));
+        (*profileGet)(f.elapsed.data(), &f.measurements);
+    }
+
+    static void setFunctionProfile(const ThreadPoolProfile& profile,
+                                   const std::string& function,
+                                   void (*profileSet)(const float*, unsigned long, unsigned int)) {
+        if (profileSet == nullptr)
+            return;
+
+        auto it = profile.functions.find(function);
+        if (it != profile.functions.end()) {
+            const ThreadPoolProfile::Function& f = it->second;
+            // the library ignores profiles with a different number of jobs
+            (*profileSet)(f.elapsed.data(), f.elapsed.size(), f.measurements);
+        }
+    }
+
     /**
      * Creates a new model
      *
@@ -868,12 +1370,34 @@ protected:
         _sparseReverseTwo(nullptr),
         _sparseJacobian(nullptr),
         _sparseHessian(nullptr),
+        _sparseJacobianFloat(nullptr),
+        _sparseHessianFloat(nullptr),
+        _sparseJacobianProfileGet(nullptr),
+        _sparseJacobianProfileSet(nullptr),
+        _sparseHessianProfileGet(nullptr),
+        _sparseHessianProfileSet(nullptr),
+        _forwardOneMulti(nullptr),
+        _reverseOneMulti(nullptr),
+        _forwardOneMultiDirections(0),
+        _reverseOneMultiDirections(0),
+        _forwardTaylor(nullptr),
+        _forwardTaylorOrder(0),
+        _hessianVectorProduct(nullptr),
+        _hessianVectorProducts(0),
         _forwardOneSparsity(nullptr),
         _reverseOneSparsity(nullptr),
         _reverseTwoSparsity(nullptr),
         _jacobianSparsity(nullptr),
         _hessianSparsity(nullptr),
-        _hessianSparsity2(nullptr) {
+        _hessianSparsity2(nullptr),
+        _jacobianSparsityPtr(nullptr),
+        _hessianSparsityPtr(nullptr),
+        _jacobianLayout(SparseMatrixLayout::Coordinate),
+        _hessianLayout(SparseMatrixLayout::Coordinate),
+        _hessianTriangle(MatrixTriangle::Full),
+        _atomicFunctions(nullptr),
+        _runThreadPoolJobs(nullptr),
+        _getThreadNumber(nullptr) {
 
     }
 
@@ -932,6 +1456,12 @@ protected:
         _sparseReverseTwo = reinterpret_cast<decltype(_sparseReverseTwo)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_SPARSE_REVERSE_TWO, false));
         _sparseJacobian = reinterpret_cast<decltype(_sparseJacobian)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_SPARSE_JACOBIAN, false));
         _sparseHessian = reinterpret_cast<decltype(_sparseHessian)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_SPARSE_HESSIAN, false));
+        _sparseJacobianFloat = reinterpret_cast<decltype(_sparseJacobianFloat)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_SPARSE_JACOBIAN_FLOAT, false));
+        _sparseHessianFloat = reinterpret_cast<decltype(_sparseHessianFloat)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_SPARSE_HESSIAN_FLOAT, false));
+        _sparseJacobianProfileGet = reinterpret_cast<decltype(_sparseJacobianProfileGet)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_SPARSE_JACOBIAN_PROFILE_GET, false));
+        _sparseJacobianProfileSet = reinterpret_cast<decltype(_sparseJacobianProfileSet)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_SPARSE_JACOBIAN_PROFILE_SET, false));
+        _sparseHessianProfileGet = reinterpret_cast<decltype(_sparseHessianProfileGet)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_SPARSE_HESSIAN_PROFILE_GET, false));
+        _sparseHessianProfileSet = reinterpret_cast<decltype(_sparseHessianProfileSet)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_SPARSE_HESSIAN_PROFILE_SET, false));
         _forwardOneSparsity = reinterpret_cast<decltype(_forwardOneSparsity)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_FORWARD_ONE_SPARSITY, false));
         _reverseOneSparsity = reinterpret_cast<decltype(_reverseOneSparsity)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_REVERSE_ONE_SPARSITY, false));
         _reverseTwoSparsity = reinterpret_cast<decltype(_reverseTwoSparsity)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_REVERSE_TWO_SPARSITY, false));
@@ -939,6 +1469,30 @@ protected:
         _hessianSparsity = reinterpret_cast<decltype(_hessianSparsity)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_HESSIAN_SPARSITY, false));
         _hessianSparsity2 = reinterpret_cast<decltype(_hessianSparsity2)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_HESSIAN_SPARSITY2, false));
         _atomicFunctions = reinterpret_cast<decltype(_atomicFunctions)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_ATOMIC_FUNC_NAMES, true));
+        _runThreadPoolJobs = reinterpret_cast<decltype(_runThreadPoolJobs)>(loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_RUNTHREADPOOLJOBS, false));
+        _getThreadNumber = reinterpret_cast<decltype(_getThreadNumber)>(loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADS, false));
+        _forwardOneMulti = reinterpret_cast<decltype(_forwardOneMulti)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_FORWARD_ONE_MULTI, false));
+        _reverseOneMulti = reinterpret_cast<decltype(_reverseOneMulti)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_REVERSE_ONE_MULTI, false));
+        _forwardOneMultiDirections = loadFunctionInfoValue(_forwardOneMulti, ModelCSourceGen<Base>::FUNCTION_FORWARD_ONE_MULTI_DIRECTIONS);
+        _reverseOneMultiDirections = loadFunctionInfoValue(_reverseOneMulti, ModelCSourceGen<Base>::FUNCTION_REVERSE_ONE_MULTI_DIRECTIONS);
+        _forwardTaylor = reinterpret_cast<decltype(_forwardTaylor)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_FORWARD_TAYLOR, false));
+        _forwardTaylorOrder = loadFunctionInfoValue(_forwardTaylor, ModelCSourceGen<Base>::FUNCTION_FORWARD_TAYLOR_ORDER);
+        _hessianVectorProduct = reinterpret_cast<decltype(_hessianVectorProduct)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_HESSIAN_VECTOR_PRODUCT, false));
+        _hessianVectorProducts = loadFunctionInfoValue(_hessianVectorProduct, ModelCSourceGen<Base>::FUNCTION_HESSIAN_VECTOR_PRODUCT_VECTORS);
+        _jacobianSparsityPtr = reinterpret_cast<decltype(_jacobianSparsityPtr)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_JACOBIAN_SPARSITY_PTR, false));
+        _hessianSparsityPtr = reinterpret_cast<decltype(_hessianSparsityPtr)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_HESSIAN_SPARSITY_PTR, false));
+        _jacobianLayout = loadSparseMatrixLayout(_jacobianSparsityPtr, ModelCSourceGen<Base>::FUNCTION_JACOBIAN_SPARSITY_LAYOUT);
+        _hessianLayout = loadSparseMatrixLayout(_hessianSparsityPtr, ModelCSourceGen<Base>::FUNCTION_HESSIAN_SPARSITY_LAYOUT);
+        void (*hessianTriangle)(unsigned long*);
+        hessianTriangle = reinterpret_cast<decltype(hessianTriangle)>(loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_HESSIAN_SPARSITY_TRIANGLE, false));
+        if (hessianTriangle != nullptr) {
+            unsigned long triangle = 0;
+            (*hessianTriangle)(&triangle);
+            CPPADCG_ASSERT_KNOWN(triangle == (unsigned long) MatrixTriangle::Lower ||
+                                 triangle == (unsigned long) MatrixTriangle::Upper,
+                                 "Invalid Hessian triangle received from the dynamic library.");
+            _hessianTriangle = MatrixTriangle(triangle);
+        }
 
         CPPADCG_ASSERT_KNOWN((_sparseForwardOne == nullptr) == (_forwardOneSparsity == nullptr), "Missing functions in the dynamic library");
         CPPADCG_ASSERT_KNOWN((_sparseForwardOne == nullptr) == (_forwardOne == nullptr), "Missing functions in the dynamic library");
@@ -948,6 +1502,8 @@ protected:
         CPPADCG_ASSERT_KNOWN((_sparseReverseTwo == nullptr) == (_reverseTwo == nullptr), "Missing functions in the dynamic library");
         CPPADCG_ASSERT_KNOWN((_sparseJacobian == nullptr) || (_jacobianSparsity != nullptr), "Missing functions in the dynamic library");
         CPPADCG_ASSERT_KNOWN((_sparseHessian == nullptr) || (_hessianSparsity != nullptr), "Missing functions in the dynamic library");
+        CPPADCG_ASSERT_KNOWN((_sparseJacobianFloat == nullptr) || (_jacobianSparsity != nullptr), "Missing functions in the dynamic library");
+        CPPADCG_ASSERT_KNOWN((_sparseHessianFloat == nullptr) || (_hessianSparsity != nullptr), "Missing functions in the dynamic library");
 
         /**
          * Prepare the atomic functions argument
@@ -968,6 +1524,104 @@ protected:
         _missingAtomicFunctions = n;
     }
 
+    /**
+     * Loads a positive value associated with a compiled function
+     * (e.g. the number of directions).
+     *
+     * @param func the compiled function which uses the value
+     * @param function the name of the function which provides the value
+     * @return the value or zero if func is not available
+     */
+    inline size_t loadFunctionInfoValue(void (*func)(Base const*const*, Base * const*, LangCAtomicFun),
+                                        const std::string& function) {
+        if (func == nullptr)
+            return 0;
+
+        void (*info)(unsigned long*);
+        info = reinterpret_cast<decltype(info)>(loadFunction(_name + "_" + function, true));
+
+        unsigned long value = 0;
+        (*info)(&value);
+        CPPADCG_ASSERT_KNOWN(value > 0, "Invalid value received from the dynamic library.");
+        return value;
+    }
+
+    /**
+     * Loads the layout of a sparse matrix with compressed rows/columns.
+     *
+     * @param ptrFunc the compiled function with the row/column pointers
+     * @param function the name of the function which provides the layout
+     * @return the layout (coordinate if ptrFunc is not available)
+     */
+    inline SparseMatrixLayout loadSparseMatrixLayout(void (*ptrFunc)(unsigned long const**, unsigned long*),
+                                                     const std::string& function) {
+        if (ptrFunc == nullptr)
+            return SparseMatrixLayout::Coordinate;
+
+        void (*info)(unsigned long*);
+        info = reinterpret_cast<decltype(info)>(loadFunction(_name + "_" + function, true));
+
+        unsigned long value = 0;
+        (*info)(&value);
+        CPPADCG_ASSERT_KNOWN(value == (unsigned long) SparseMatrixLayout::CompressedRow ||
+                             value == (unsigned long) SparseMatrixLayout::CompressedColumn,
+                             "Invalid sparse matrix layout received from the dynamic library.");
+        return SparseMatrixLayout(value);
+    }
+
+    /**
+     * Evaluates a multiple direction function for any number of directions
+     * (using groups of maxDirections directions).
+     *
+     * @param multiFunc the compiled function
+     * @param maxDirections the number of directions of the compiled function
+     * @param fixedIn the input arrays shared by all directions
+     *                (e.g. the independent variables)
+     * @param nFixedIn the number of input arrays shared by all directions
+     *                 (at most 2)
+     * @param in the values for each direction (one after the other)
+     * @param inSize the size of each direction in the input
+     * @param out the results for each direction (one after the other)
+     * @param outSize the size of each direction in the output
+     */
+    inline void evalMultiDirections(void (*multiFunc)(Base const*const*, Base * const*, LangCAtomicFun),
+                                    size_t maxDirections,
+                                    const Base* const* fixedIn,
+                                    size_t nFixedIn,
+                                    ArrayView<const Base> in,
+                                    size_t inSize,
+                                    ArrayView<Base> out,
+                                    size_t outSize) {
+        CPPADCG_ASSERT_UNKNOWN(nFixedIn > 0 && nFixedIn < 3)
+
+        size_t k = in.size() / inSize;
+
+        const Base* args[3];
+        std::copy(fixedIn, fixedIn + nFixedIn, args);
+
+        for (size_t d = 0; d < k; d += maxDirections) {
+            size_t nd = std::min(maxDirections, k - d);
+            if (nd == maxDirections) {
+                args[nFixedIn] = in.data() + d * inSize;
+                _out[0] = out.data() + d * outSize;
+
+                (*multiFunc)(args, &_out[0], _atomicFuncArg);
+            } else {
+                // the last group is incomplete
+                _multiIn.assign(maxDirections * inSize, Base(0));
+                _multiOut.resize(maxDirections * outSize);
+                std::copy(in.data() + d * inSize, in.data() + (d + nd) * inSize, _multiIn.begin());
+
+                args[nFixedIn] = _multiIn.data();
+                _out[0] = _multiOut.data();
+
+                (*multiFunc)(args, &_out[0], _atomicFuncArg);
+
+                std::copy(_multiOut.begin(), _multiOut.begin() + nd * outSize, out.data() + d * outSize);
+            }
+        }
+    }
+
     template <class VectorSet>
     inline void loadSparsity(bool set_type,
                              VectorSet& s,
@@ -1022,12 +1676,26 @@ protected:
         _sparseReverseTwo = nullptr;
         _sparseJacobian = nullptr;
         _sparseHessian = nullptr;
+        _sparseJacobianFloat = nullptr;
+        _sparseHessianFloat = nullptr;
+        _sparseJacobianProfileGet = nullptr;
+        _sparseJacobianProfileSet = nullptr;
+        _sparseHessianProfileGet = nullptr;
+        _sparseHessianProfileSet = nullptr;
+        _forwardOneMulti = nullptr;
+        _reverseOneMulti = nullptr;
+        _forwardTaylor = nullptr;
+        _hessianVectorProduct = nullptr;
         _forwardOneSparsity = nullptr;
         _reverseOneSparsity = nullptr;
         _reverseTwoSparsity = nullptr;
         _jacobianSparsity = nullptr;
         _hessianSparsity = nullptr;
         _hessianSparsity2 = nullptr;
+        _jacobianSparsityPtr = nullptr;
+        _hessianSparsityPtr = nullptr;
+        _runThreadPoolJobs = nullptr;
+        _getThreadNumber = nullptr;
     }
 
 private:
@@ -42,6 +42,15 @@ protected:
     float (*_getThreadPoolGuidedMaxWork)();
     void (*_setThreadPoolNumberOfTimeMeas)(unsigned int n);
     unsigned int (*_getThreadPoolNumberOfTimeMeas)();
+    void (*_setThreadPoolExecutor)(const CppADCGThPoolExecutor*);
+    void (*_setThreadPoolAffinity)(int);
+    int (*_getThreadPoolAffinity)();
+    void (*_setThreadPoolAffinityCpus)(const int*, int);
+    int (*_getThreadPoolAffinityCpus)(int*, int);
+    void (*_setThreadPoolSpinTime)(float);
+    float (*_getThreadPoolSpinTime)();
+    void (*_setThreadPoolSequentialThreshold)(float);
+    float (*_getThreadPoolSequentialThreshold)();
 public:
 
     std::set<std::string> getModelNames() override {
@@ -166,6 +175,66 @@ public:
         return 0;
     }
 
+    void setThreadPoolAffinity(ThreadPoolAffinity a) override {
+        if (_setThreadPoolAffinity != nullptr) {
+            (*_setThreadPoolAffinity)(int(a));
+        }
+    }
+
+    ThreadPoolAffinity getThreadPoolAffinity() const override {
+        if (_getThreadPoolAffinity != nullptr) {
+            return ThreadPoolAffinity((*_getThreadPoolAffinity)());
+        }
+        return ThreadPoolAffinity::NONE;
+    }
+
+    void setThreadPoolAffinityCpus(const std::vector<int>& cpus) override {
+        if (_setThreadPoolAffinityCpus != nullptr) {
+            (*_setThreadPoolAffinityCpus)(cpus.data(), int(cpus.size()));
+        }
+    }
+
+    std::vector<int> getThreadPoolAffinityCpus() const override {
+        std::vector<int> cpus;
+        if (_getThreadPoolAffinityCpus != nullptr) {
+            cpus.resize((*_getThreadPoolAffinityCpus)(nullptr, 0));
+            (*_getThreadPoolAffinityCpus)(cpus.data(), int(cpus.size()));
+        }
+        return cpus;
+    }
+
+    void setThreadPoolSpinTime(float seconds) override {
+        if (_setThreadPoolSpinTime != nullptr) {
+            (*_setThreadPoolSpinTime)(seconds);
+        }
+    }
+
+    float getThreadPoolSpinTime() const override {
+        if (_getThreadPoolSpinTime != nullptr) {
+            return (*_getThreadPoolSpinTime)();
+        }
+        return 0;
+    }
+
+    void setThreadPoolSequentialThreshold(float seconds) override {
+        if (_setThreadPoolSequentialThreshold != nullptr) {
+            (*_setThreadPoolSequentialThreshold)(seconds);
+        }
+    }
+
+    float getThreadPoolSequentialThreshold() const override {
+        if (_getThreadPoolSequentialThreshold != nullptr) {
+            return (*_getThreadPoolSequentialThreshold)();
+        }
+        return 0;
+    }
+
+    void setThreadPoolExecutor(const CppADCGThPoolExecutor* executor) override {
+        if (_setThreadPoolExecutor != nullptr) {
+            (*_setThreadPoolExecutor)(executor);
+        }
+    }
+
     inline virtual ~FunctorModelLibrary() = default;
 
 protected:
@@ -183,7 +252,16 @@ protected:
             _setThreadPoolGuidedMaxWork(nullptr),
             _getThreadPoolGuidedMaxWork(nullptr),
             _setThreadPoolNumberOfTimeMeas(nullptr),
-            _getThreadPoolNumberOfTimeMeas(nullptr) {
+            _getThreadPoolNumberOfTimeMeas(nullptr),
+            _setThreadPoolExecutor(nullptr),
+            _setThreadPoolAffinity(nullptr),
+            _getThreadPoolAffinity(nullptr),
+            _setThreadPoolAffinityCpus(nullptr),
+            _getThreadPoolAffinityCpus(nullptr),
+            _setThreadPoolSpinTime(nullptr),
+            _getThreadPoolSpinTime(nullptr),
+            _setThreadPoolSequentialThreshold(nullptr),
+            _getThreadPoolSequentialThreshold(nullptr) {
     }
 
     inline void validate() {
@@ -233,6 +311,15 @@ protected:
         _getThreadPoolGuidedMaxWork = reinterpret_cast<decltype(_getThreadPoolGuidedMaxWork)> (this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLGUIDEDMAXGROUPWORK, false));
         _setThreadPoolNumberOfTimeMeas = reinterpret_cast<decltype(_setThreadPoolNumberOfTimeMeas)> (this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLNUMBEROFTIMEMEAS, false));
         _getThreadPoolNumberOfTimeMeas = reinterpret_cast<decltype(_getThreadPoolNumberOfTimeMeas)> (this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLNUMBEROFTIMEMEAS, false));
+        _setThreadPoolExecutor = reinterpret_cast<decltype(_setThreadPoolExecutor)> (this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLEXECUTOR, false));
+        _setThreadPoolAffinity = reinterpret_cast<decltype(_setThreadPoolAffinity)> (this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLAFFINITY, false));
+        _getThreadPoolAffinity = reinterpret_cast<decltype(_getThreadPoolAffinity)> (this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLAFFINITY, false));
+        _setThreadPoolAffinityCpus = reinterpret_cast<decltype(_setThreadPoolAffinityCpus)> (this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLAFFINITYCPUS, false));
+        _getThreadPoolAffinityCpus = reinterpret_cast<decltype(_getThreadPoolAffinityCpus)> (this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLAFFINITYCPUS, false));
+        _setThreadPoolSpinTime = reinterpret_cast<decltype(_setThreadPoolSpinTime)> (this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLSPINTIME, false));
+        _getThreadPoolSpinTime = reinterpret_cast<decltype(_getThreadPoolSpinTime)> (this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLSPINTIME, false));
+        _setThreadPoolSequentialThreshold = reinterpret_cast<decltype(_setThreadPoolSequentialThreshold)> (this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLSEQUENTIALTHRESHOLD, false));
+        _getThreadPoolSequentialThreshold = reinterpret_cast<decltype(_getThreadPoolSequentialThreshold)> (this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLSEQUENTIALTHRESHOLD, false));
 
         if(_setThreads != nullptr) {
             (*_setThreads)(std::thread::hardware_concurrency());
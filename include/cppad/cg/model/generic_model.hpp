@@ -102,6 +102,63 @@ public:
                                  std::vector<size_t>& rows,
                                  std::vector<size_t>& cols) = 0;
 
+    /**
+     * Provides the order of the elements of the sparse Jacobian.
+     *
+     * @see ModelCSourceGen::setSparseJacobianLayout()
+     */
+    virtual SparseMatrixLayout getSparseJacobianLayout() {
+        return SparseMatrixLayout::Coordinate;
+    }
+
+    /**
+     * Provides the row pointers (compressed row layout) or the column
+     * pointers (compressed column layout) of the sparse Jacobian.
+     * The elements of row/column k are at positions ptr[k] to ptr[k+1]-1
+     * while their column/row indices are provided by JacobianSparsity().
+     *
+     * @param ptr the row/column pointers
+     * @param size the number of pointers (the number of rows/columns plus 1)
+     */
+    virtual void JacobianSparsityPointers(size_t const** ptr,
+                                          size_t* size) {
+        throw CGException("The sparse Jacobian of model '", getName(), "' does not have a compressed layout");
+    }
+
+    /**
+     * Provides the order of the elements of the sparse Hessian.
+     *
+     * @see ModelCSourceGen::setSparseHessianLayout()
+     */
+    virtual SparseMatrixLayout getSparseHessianLayout() {
+        return SparseMatrixLayout::Coordinate;
+    }
+
+    /**
+     * Provides the row pointers (compressed row layout) or the column
+     * pointers (compressed column layout) of the sparse Hessian.
+     *
+     * @param ptr the row/column pointers
+     * @param size the number of pointers (the number of rows/columns plus 1)
+     * @see JacobianSparsityPointers()
+     */
+    virtual void HessianSparsityPointers(size_t const** ptr,
+                                         size_t* size) {
+        throw CGException("The sparse Hessian of model '", getName(), "' does not have a compressed layout");
+    }
+
+    /**
+     * Provides which elements of the symmetric sparse Hessian are
+     * determined by the sparse Hessian methods.
+     * The dense Hessian provided by SparseHessian(x, w, hess) always
+     * contains all the elements.
+     *
+     * @see ModelCSourceGen::setSparseHessianTriangle()
+     */
+    virtual MatrixTriangle getSparseHessianTriangle() {
+        return MatrixTriangle::Full;
+    }
+
     /**
      * Provides the number of independent variables.
      * 
@@ -590,6 +647,170 @@ public:
                             ArrayView<Base> px2,
                             ArrayView<const Base> py2) = 0;
 
+    /***********************************************************************
+     *                        Multiple directions
+     **********************************************************************/
+
+    /**
+     * Determines whether or not the first order forward mode for multiple
+     * directions can be evaluated.
+     *
+     * @see ModelCSourceGen::setCreateForwardOneMulti()
+     */
+    virtual bool isForwardOneMultiAvailable() {
+        return false;
+    }
+
+    /**
+     * Provides the number of directions evaluated by each call to the
+     * compiled first order forward mode for multiple directions.
+     */
+    virtual size_t getForwardOneMultiMaxDirections() {
+        return 0;
+    }
+
+    /**
+     * Computes several directional derivatives (Jacobian-matrix product)
+     * using the first order forward mode:
+     *   \f[ ty1[ d m + i ] = \sum_j \frac{\partial F_i( x ) }{\partial x_j } tx1[ d n + j ] \f]
+     * The zero order values are evaluated only once for each group of
+     * getForwardOneMultiMaxDirections() directions.
+     *
+     * @param x independent variable vector
+     * @param tx1 the directions, one after the other
+     *            (its size must be a multiple of the number of independent
+     *            variables)
+     * @param ty1 the directional derivatives, one after the other
+     *            (the number of dependent variables times the number of
+     *            directions)
+     */
+    virtual void ForwardOneMulti(ArrayView<const Base> x,
+                                 ArrayView<const Base> tx1,
+                                 ArrayView<Base> ty1) {
+        throw CGException("First order forward mode for multiple directions is not available for model '", getName(), "'");
+    }
+
+    /**
+     * Determines whether or not the first order reverse mode for multiple
+     * directions can be evaluated.
+     *
+     * @see ModelCSourceGen::setCreateReverseOneMulti()
+     */
+    virtual bool isReverseOneMultiAvailable() {
+        return false;
+    }
+
+    /**
+     * Provides the number of directions evaluated by each call to the
+     * compiled first order reverse mode for multiple directions.
+     */
+    virtual size_t getReverseOneMultiMaxDirections() {
+        return 0;
+    }
+
+    /**
+     * Computes several weighted sums of the Jacobian rows
+     * (matrix-Jacobian product) using the first order reverse mode:
+     *   \f[ px[ d n + j ] = \sum_i py[ d m + i ] \frac{\partial F_i( x ) }{\partial x_j } \f]
+     * The zero order values are evaluated only once for each group of
+     * getReverseOneMultiMaxDirections() directions.
+     *
+     * @param x independent variable vector
+     * @param py the weights for each direction, one after the other
+     *           (its size must be a multiple of the number of dependent
+     *           variables)
+     * @param px the partials of the independents for each direction, one
+     *           after the other (the number of independent variables times
+     *           the number of directions)
+     */
+    virtual void ReverseOneMulti(ArrayView<const Base> x,
+                                 ArrayView<const Base> py,
+                                 ArrayView<Base> px) {
+        throw CGException("First order reverse mode for multiple directions is not available for model '", getName(), "'");
+    }
+
+    /***********************************************************************
+     *                    Forward mode Taylor coefficients
+     **********************************************************************/
+
+    /**
+     * Determines whether or not the forward mode for Taylor coefficients
+     * of higher orders can be evaluated.
+     *
+     * @see ModelCSourceGen::setCreateForwardTaylor()
+     */
+    virtual bool isForwardTaylorAvailable() {
+        return false;
+    }
+
+    /**
+     * Provides the highest order of the Taylor coefficients which can be
+     * determined by ForwardTaylor().
+     */
+    virtual size_t getForwardTaylorOrder() {
+        return 0;
+    }
+
+    /**
+     * Computes the Taylor coefficients of the dependent variables up to
+     * order p (as in CppAD::ADFun::Forward(p, tx)), for instance, to be used
+     * in Taylor series methods for the integration of ODEs.
+     *
+     * @param p the highest order (it cannot be higher than
+     *          getForwardTaylorOrder())
+     * @param tx the Taylor coefficients of the independent variables, where
+     *           the coefficient of order k for variable j is
+     *           tx[j * (p + 1) + k]
+     * @param ty the Taylor coefficients of the dependent variables, where
+     *           the coefficient of order k for variable i is
+     *           ty[i * (p + 1) + k]
+     */
+    virtual void ForwardTaylor(size_t p,
+                               ArrayView<const Base> tx,
+                               ArrayView<Base> ty) {
+        throw CGException("Forward mode for Taylor coefficients is not available for model '", getName(), "'");
+    }
+
+    /***********************************************************************
+     *                       Hessian-vector products
+     **********************************************************************/
+
+    /**
+     * Determines whether or not Hessian-vector products can be evaluated
+     * without computing the Hessian.
+     *
+     * @see ModelCSourceGen::setCreateHessianVectorProduct()
+     */
+    virtual bool isHessianVectorProductAvailable() {
+        return false;
+    }
+
+    /**
+     * Provides the number of vectors multiplied by each call to the compiled
+     * Hessian-vector product function.
+     */
+    virtual size_t getHessianVectorProductMaxVectors() {
+        return 0;
+    }
+
+    /**
+     * Computes the product of the Hessian of the Lagrangian with one or
+     * more vectors, without determining the Hessian:
+     *   \f[ hv[ d n + j ] = \sum_i w_i \sum_k \frac{\partial^2 F_i( x ) }{\partial x_j \partial x_k } v[ d n + k ] \f]
+     *
+     * @param x independent variable vector
+     * @param w equation multipliers
+     * @param v the vectors, one after the other (its size must be a
+     *          multiple of the number of independent variables)
+     * @param hv the products, one after the other (same size as v)
+     */
+    virtual void HessianVectorProduct(ArrayView<const Base> x,
+                                      ArrayView<const Base> w,
+                                      ArrayView<const Base> v,
+                                      ArrayView<Base> hv) {
+        throw CGException("Hessian-vector products are not available for model '", getName(), "'");
+    }
+
     /***********************************************************************
      *                        Sparse Jacobians
      **********************************************************************/
@@ -744,6 +965,258 @@ public:
                                size_t const** row,
                                size_t const** col) = 0;
 
+    /***********************************************************************
+     *               Single precision sparse Jacobians/Hessians
+     **********************************************************************/
+
+    /**
+     * Determines whether or not the single precision (float) sparse
+     * Jacobian can be evaluated.
+     *
+     * @see ModelCSourceGen::setCreateSparseJacobianFloat()
+     */
+    virtual bool isSparseJacobianFloatAvailable() {
+        return false;
+    }
+
+    /**
+     * Evaluates the sparse Jacobian using single precision.
+     * The independent variables are converted to float before the
+     * evaluation.
+     *
+     * @param x The independent variables
+     * @param jac The values of the sparse Jacobian in the order provided by
+     *            row and col
+     * @param row The row indices of the Jacobian values
+     * @param col The column indices of the Jacobian values
+     */
+    virtual void SparseJacobianFloat(ArrayView<const Base> x,
+                                     ArrayView<float> jac,
+                                     size_t const** row,
+                                     size_t const** col) {
+        throw CGException("Single precision sparse Jacobian is not available for model '", getName(), "'");
+    }
+
+    /**
+     * Determines whether or not the single precision (float) sparse
+     * Hessian can be evaluated.
+     *
+     * @see ModelCSourceGen::setCreateSparseHessianFloat()
+     */
+    virtual bool isSparseHessianFloatAvailable() {
+        return false;
+    }
+
+    /**
+     * Evaluates the sparse weighted sum of the Hessians using single
+     * precision.
+     * The independent variables and the multipliers are converted to float
+     * before the evaluation.
+     *
+     * @param x The independent variables
+     * @param w The equation multipliers
+     * @param hess The values of the sparse Hessian in the order provided by
+     *             row and col
+     * @param row The row indices of the Hessian values
+     * @param col The column indices of the Hessian values
+     */
+    virtual void SparseHessianFloat(ArrayView<const Base> x,
+                                    ArrayView<const Base> w,
+                                    ArrayView<float> hess,
+                                    size_t const** row,
+                                    size_t const** col) {
+        throw CGException("Single precision sparse Hessian is not available for model '", getName(), "'");
+    }
+
+    /***********************************************************************
+     *                          Bound functions
+     **********************************************************************/
+
+    /**
+     * Determines whether or not the evaluation methods can be bound to
+     * fixed arrays (e.g. bindForwardZero()).
+     */
+    virtual bool isBindAvailable() {
+        return false;
+    }
+
+    /**
+     * Validates the arrays for the zero order forward mode once and
+     * provides an object which evaluates the model with those arrays
+     * without any further validation (e.g. for small models evaluated
+     * very often).
+     *
+     * @param x The independent variables (read on each call)
+     * @param dep The dependent variables (written on each call)
+     * @return the bound function
+     */
+    virtual BoundModelFunction<Base> bindForwardZero(ArrayView<const Base> x,
+                                                     ArrayView<Base> dep) {
+        throw CGException("Bound functions are not available for model '", getName(), "'");
+    }
+
+    /**
+     * Binds the dense Jacobian evaluation to fixed arrays.
+     *
+     * @param x The independent variables (read on each call)
+     * @param jac The dense Jacobian (written on each call)
+     * @return the bound function
+     * @see bindForwardZero()
+     */
+    virtual BoundModelFunction<Base> bindJacobian(ArrayView<const Base> x,
+                                                  ArrayView<Base> jac) {
+        throw CGException("Bound functions are not available for model '", getName(), "'");
+    }
+
+    /**
+     * Binds the dense weighted sum of the Hessians to fixed arrays.
+     *
+     * @param x The independent variables (read on each call)
+     * @param w The equation multipliers (read on each call)
+     * @param hess The dense Hessian (written on each call)
+     * @return the bound function
+     * @see bindForwardZero()
+     */
+    virtual BoundModelFunction<Base> bindHessian(ArrayView<const Base> x,
+                                                 ArrayView<const Base> w,
+                                                 ArrayView<Base> hess) {
+        throw CGException("Bound functions are not available for model '", getName(), "'");
+    }
+
+    /**
+     * Binds the sparse Jacobian evaluation to fixed arrays.
+     *
+     * @param x The independent variables (read on each call)
+     * @param jac The values of the sparse Jacobian in the order provided by
+     *            row and col (written on each call)
+     * @param row The row indices of the Jacobian values
+     * @param col The column indices of the Jacobian values
+     * @return the bound function
+     * @see bindForwardZero()
+     */
+    virtual BoundModelFunction<Base> bindSparseJacobian(ArrayView<const Base> x,
+                                                        ArrayView<Base> jac,
+                                                        size_t const** row,
+                                                        size_t const** col) {
+        throw CGException("Bound functions are not available for model '", getName(), "'");
+    }
+
+    /**
+     * Binds the sparse weighted sum of the Hessians to fixed arrays.
+     *
+     * @param x The independent variables (read on each call)
+     * @param w The equation multipliers (read on each call)
+     * @param hess The values of the sparse Hessian in the order provided by
+     *             row and col (written on each call)
+     * @param row The row indices of the Hessian values
+     * @param col The column indices of the Hessian values
+     * @return the bound function
+     * @see bindForwardZero()
+     */
+    virtual BoundModelFunction<Base> bindSparseHessian(ArrayView<const Base> x,
+                                                       ArrayView<const Base> w,
+                                                       ArrayView<Base> hess,
+                                                       size_t const** row,
+                                                       size_t const** col) {
+        throw CGException("Bound functions are not available for model '", getName(), "'");
+    }
+
+    /***********************************************************************
+     *                    Multiple evaluation points
+     **********************************************************************/
+
+    /**
+     * Determines the dependent variable values for several independent
+     * variable vectors (points).
+     * Compiled models distribute groups of points (chunks) among the
+     * threads of the model library thread pool (if the library was created
+     * with multithreading support).
+     * The model can only be evaluated in parallel if it does not use atomic
+     * functions.
+     *
+     * @param x The independent variables of each point (each must have n
+     *          elements)
+     * @param dep The dependent variables of each point (each must have m
+     *            elements)
+     * @param chunkSize The number of points evaluated by each job
+     *                  (0 for an automatic value)
+     */
+    virtual void ForwardZeroMany(const std::vector<const Base*>& x,
+                                 const std::vector<Base*>& dep,
+                                 size_t chunkSize = 0) {
+        CPPADCG_ASSERT_KNOWN(x.size() == dep.size(), "The number of independent and dependent arrays must be the same");
+
+        size_t n = Domain();
+        size_t m = Range();
+        for (size_t p = 0; p < x.size(); ++p) {
+            ForwardZero(ArrayView<const Base>(x[p], n),
+                        ArrayView<Base>(dep[p], m));
+        }
+    }
+
+    /**
+     * Determines the sparse Jacobian for several independent variable
+     * vectors (points).
+     * Compiled models distribute groups of points (chunks) among the
+     * threads of the model library thread pool (if the library was created
+     * with multithreading support).
+     * The model can only be evaluated in parallel if it does not use atomic
+     * functions.
+     *
+     * @param x The independent variables of each point (each must have n
+     *          elements)
+     * @param jac The values of the sparse Jacobian of each point in the
+     *            order provided by row and col
+     * @param row The row indices of the Jacobian values
+     * @param col The column indices of the Jacobian values
+     * @param chunkSize The number of points evaluated by each job
+     *                  (0 for an automatic value)
+     */
+    virtual void SparseJacobianMany(const std::vector<const Base*>& x,
+                                    const std::vector<Base*>& jac,
+                                    size_t const** row,
+                                    size_t const** col,
+                                    size_t chunkSize = 0) {
+        CPPADCG_ASSERT_KNOWN(x.size() == jac.size(), "The number of independent and Jacobian arrays must be the same");
+
+        std::vector<size_t> rows, cols;
+        JacobianSparsity(rows, cols);
+
+        size_t n = Domain();
+        for (size_t p = 0; p < x.size(); ++p) {
+            SparseJacobian(ArrayView<const Base>(x[p], n),
+                           ArrayView<Base>(jac[p], rows.size()),
+                           row, col);
+        }
+    }
+
+    /***********************************************************************
+     *                       Thread pool profile
+     **********************************************************************/
+
+    /**
+     * Provides the reference execution times of the jobs of the
+     * multithreaded functions (only available for models created with
+     * MultiThreadingType::PTHREADS).
+     * Before the first evaluation these times are estimates determined
+     * from the number of operations of each job.
+     */
+    virtual ThreadPoolProfile getThreadPoolProfile() {
+        return ThreadPoolProfile();
+    }
+
+    /**
+     * Defines the reference execution times of the jobs of the
+     * multithreaded functions (e.g. obtained with getThreadPoolProfile()
+     * in a previous execution).
+     * Functions which are not present in the model or with a different
+     * number of jobs are ignored.
+     *
+     * @param profile the execution times
+     */
+    virtual void setThreadPoolProfile(const ThreadPoolProfile& profile) {
+    }
+
     /**
      * Provides a wrapper for this compiled model allowing it to be used as
      * an atomic function. The model must not be deleted while the atomic
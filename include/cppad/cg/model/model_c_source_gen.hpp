@@ -49,8 +49,27 @@ public:
     static const std::string FUNCTION_REVERSE_TWO;
     static const std::string FUNCTION_SPARSE_JACOBIAN;
     static const std::string FUNCTION_SPARSE_HESSIAN;
+    static const std::string FUNCTION_SPARSE_JACOBIAN_FLOAT;
+    static const std::string FUNCTION_SPARSE_HESSIAN_FLOAT;
+    static const std::string FUNCTION_SPARSE_JACOBIAN_PROFILE_GET;
+    static const std::string FUNCTION_SPARSE_JACOBIAN_PROFILE_SET;
+    static const std::string FUNCTION_SPARSE_HESSIAN_PROFILE_GET;
+    static const std::string FUNCTION_SPARSE_HESSIAN_PROFILE_SET;
+    static const std::string FUNCTION_FORWARD_ONE_MULTI;
+    static const std::string FUNCTION_REVERSE_ONE_MULTI;
+    static const std::string FUNCTION_FORWARD_ONE_MULTI_DIRECTIONS;
+    static const std::string FUNCTION_REVERSE_ONE_MULTI_DIRECTIONS;
+    static const std::string FUNCTION_FORWARD_TAYLOR;
+    static const std::string FUNCTION_FORWARD_TAYLOR_ORDER;
+    static const std::string FUNCTION_HESSIAN_VECTOR_PRODUCT;
+    static const std::string FUNCTION_HESSIAN_VECTOR_PRODUCT_VECTORS;
     static const std::string FUNCTION_JACOBIAN_SPARSITY;
     static const std::string FUNCTION_HESSIAN_SPARSITY;
+    static const std::string FUNCTION_JACOBIAN_SPARSITY_PTR;
+    static const std::string FUNCTION_HESSIAN_SPARSITY_PTR;
+    static const std::string FUNCTION_JACOBIAN_SPARSITY_LAYOUT;
+    static const std::string FUNCTION_HESSIAN_SPARSITY_LAYOUT;
+    static const std::string FUNCTION_HESSIAN_SPARSITY_TRIANGLE;
     static const std::string FUNCTION_HESSIAN_SPARSITY2;
     static const std::string FUNCTION_SPARSE_FORWARD_ONE;
     static const std::string FUNCTION_SPARSE_REVERSE_ONE;
@@ -182,6 +201,10 @@ protected:
     bool _sparseJacobian;
     /// generate source code for a sparse Hessian
     bool _sparseHessian;
+    /// generate source code for a single precision (float) sparse Jacobian
+    bool _sparseJacobianFloat;
+    /// generate source code for a single precision (float) sparse Hessian
+    bool _sparseHessianFloat;
     /**
      * generate source-code for the Hessian sparsity pattern for each
      * equation/dependent
@@ -193,6 +216,26 @@ protected:
     bool _reverseOne;
     /// generate source code for reverse second order mode
     bool _reverseTwo;
+    /**
+     * number of directions of the generated first order forward mode
+     * function for multiple directions (zero for no function)
+     */
+    size_t _forwardOneMultiDirections;
+    /**
+     * number of directions of the generated first order reverse mode
+     * function for multiple directions (zero for no function)
+     */
+    size_t _reverseOneMultiDirections;
+    /**
+     * the highest order of the generated forward mode function for Taylor
+     * coefficients (zero for no function)
+     */
+    size_t _forwardTaylorOrder;
+    /**
+     * the number of vectors used by the generated Hessian-vector product
+     * function (zero for no function)
+     */
+    size_t _hessianVectorProducts;
     /**
      * whether or not the sparse Jacobian should reuse the forward or reverse
      * one functions when _sparseJacobian is true
@@ -209,11 +252,24 @@ protected:
      */
     Position _custom_jac;
     LocalSparsityInfo _jacSparsity;
+    /**
+     * The order of the elements in the sparse Jacobian
+     */
+    SparseMatrixLayout _jacLayout;
     /**
      * Custom Hessian element indexes
      */
     Position _custom_hess;
     LocalSparsityInfo _hessSparsity;
+    /**
+     * The order of the elements in the sparse Hessian
+     */
+    SparseMatrixLayout _hessLayout;
+    /**
+     * The elements of the sparse Hessian which are determined
+     * (when custom elements are not defined)
+     */
+    MatrixTriangle _hessTriangle;
     /**
      * Hessian sparsity from the model for each equation
      */
@@ -226,6 +282,12 @@ protected:
      * Maps each atomic function ID to information regarding how the atomic function is used
      */
     std::map<size_t, AtomicUseInfo<Base> >* _atomicsInfo;
+    /**
+     * Atomic functions which are called directly through C functions
+     * provided by the model library (maps atomic function names to the
+     * prefix of those C functions)
+     */
+    std::map<std::string, std::string> _atomicDirectCalls;
     /**
      * A string cache for code generation
      */
@@ -234,10 +296,60 @@ protected:
      * maximum number of assignments per function (~ lines)
      */
     size_t _maxAssignPerFunc;
+    /**
+     * whether or not to use the dependencies between variables to decide
+     * where to split the source code into several functions
+     */
+    bool _funcSplitByDeps;
+    /**
+     * whether or not to evaluate local functions of the zero order model,
+     * dense Jacobian, and dense Hessian as parallel tasks
+     */
+    bool _localFuncTasks;
     /**
      * the maximum number of operations per variable assignment
      */
     size_t _maxOperationsPerAssignment;
+    /**
+     * whether or not to reorder operations to reduce the number of
+     * temporary variables alive at the same time
+     */
+    bool _minimizeLiveTemps;
+    /**
+     * whether or not to determine the sparsity patterns from the operation
+     * graph instead of using the CppAD sparsity methods
+     */
+    bool _sparsityFromGraph;
+    /**
+     * used to determine the sparsity patterns from the operation graph
+     * (created once it is first needed)
+     */
+    std::unique_ptr<GraphSparsity<Base> > _graphSparsity;
+    /**
+     * the file used to save the sparsity patterns (empty if not used)
+     */
+    std::string _sparsityCacheFile;
+    /**
+     * the sparsity patterns saved for the current tape
+     * (loaded once it is first needed)
+     */
+    std::unique_ptr<SparsityCache> _sparsityCache;
+    /**
+     * the number of temporary variables used by each generated
+     * source (maps job names to the number of temporaries)
+     */
+    std::map<std::string, size_t> _temporaryVariableCount;
+    /**
+     * the names of the generated multithreaded functions which also
+     * define functions to export and import their job timing information
+     */
+    std::set<std::string> _profileFunctions;
+    /**
+     * an estimate of the number of operations in each generated function
+     * which can be evaluated by a different thread (maps function names to
+     * the number of operations)
+     */
+    std::map<std::string, size_t> _functionOperationCount;
     /**
      *
      */
@@ -303,16 +415,29 @@ public:
         _hessian(false),
         _sparseJacobian(false),
         _sparseHessian(false),
+        _sparseJacobianFloat(false),
+        _sparseHessianFloat(false),
         _hessianByEquation(false),
         _forwardOne(false),
         _reverseOne(false),
         _reverseTwo(false),
+        _forwardOneMultiDirections(0),
+        _reverseOneMultiDirections(0),
+        _forwardTaylorOrder(0),
+        _hessianVectorProducts(0),
         _sparseJacobianReusesOne(true),
         _sparseHessianReusesRev2(true),
         _jacMode(JacobianADMode::Automatic),
+        _jacLayout(SparseMatrixLayout::Coordinate),
+        _hessLayout(SparseMatrixLayout::Coordinate),
+        _hessTriangle(MatrixTriangle::Full),
         _atomicsInfo(nullptr),
         _maxAssignPerFunc(20000),
+        _funcSplitByDeps(false),
+        _localFuncTasks(false),
         _maxOperationsPerAssignment(1000),
+        _minimizeLiveTemps(false),
+        _sparsityFromGraph(false),
         _jobTimer(nullptr) {
 
         CPPADCG_ASSERT_KNOWN(!_name.empty(), "Model name cannot be empty");
@@ -655,6 +780,62 @@ public:
         _sparseJacobianReusesOne = reuse;
     }
 
+    /**
+     * Determines whether or not to generate source-code for a single
+     * precision (float) version of the sparse Jacobian.
+     *
+     * @return true if source-code for a single precision sparse Jacobian
+     *         should be created, false otherwise
+     */
+    inline bool isCreateSparseJacobianFloat() const {
+        return _sparseJacobianFloat;
+    }
+
+    /**
+     * Defines whether or not to generate source-code for a single precision
+     * (float) version of the sparse Jacobian.
+     * It is created from the same operation graph as the sparse Jacobian
+     * (always evaluated directly, without reusing the forward/reverse one
+     * functions) and uses the same sparsity pattern.
+     * Models with atomic functions or loops are not supported.
+     *
+     * @see GenericModel::SparseJacobianFloat()
+     *
+     * @param create true if source-code for a single precision sparse
+     *               Jacobian should be created, false otherwise
+     */
+    inline void setCreateSparseJacobianFloat(bool create) {
+        _sparseJacobianFloat = create;
+    }
+
+    /**
+     * Determines whether or not to generate source-code for a single
+     * precision (float) version of the sparse Hessian.
+     *
+     * @return true if source-code for a single precision sparse Hessian
+     *         should be created, false otherwise
+     */
+    inline bool isCreateSparseHessianFloat() const {
+        return _sparseHessianFloat;
+    }
+
+    /**
+     * Defines whether or not to generate source-code for a single precision
+     * (float) version of the sparse Hessian.
+     * It is created from the same operation graph as the sparse Hessian
+     * (always evaluated directly, without reusing the reverse two
+     * functions) and uses the same sparsity pattern.
+     * Models with atomic functions or loops are not supported.
+     *
+     * @see GenericModel::SparseHessianFloat()
+     *
+     * @param create true if source-code for a single precision sparse
+     *               Hessian should be created, false otherwise
+     */
+    inline void setCreateSparseHessianFloat(bool create) {
+        _sparseHessianFloat = create;
+    }
+
     /**
      * Determines whether or not to generate source-code for a function
      * that evaluates the original model.
@@ -789,6 +970,132 @@ public:
         _reverseTwo = create;
     }
 
+    /**
+     * Provides the number of directions of the generated first order
+     * forward mode function which evaluates multiple directions in a
+     * single call.
+     *
+     * @return the number of directions (zero if the function is not
+     *         generated)
+     */
+    inline size_t getForwardOneMultiMaxDirections() const {
+        return _forwardOneMultiDirections;
+    }
+
+    /**
+     * Defines whether or not to generate source-code for a first order
+     * forward mode function which evaluates several directions
+     * (Jacobian-matrix product) in a single call.
+     * The zero order values are only determined once for all directions.
+     * Models may request any number of directions: they are evaluated in
+     * groups of up to maxDirections directions.
+     *
+     * @see GenericModel::ForwardOneMulti()
+     *
+     * @param maxDirections the number of directions evaluated by each call
+     *                      of the generated function (zero to disable)
+     */
+    inline void setCreateForwardOneMulti(size_t maxDirections) {
+        _forwardOneMultiDirections = maxDirections;
+    }
+
+    /**
+     * Provides the number of directions of the generated first order
+     * reverse mode function which evaluates multiple directions in a
+     * single call.
+     *
+     * @return the number of directions (zero if the function is not
+     *         generated)
+     */
+    inline size_t getReverseOneMultiMaxDirections() const {
+        return _reverseOneMultiDirections;
+    }
+
+    /**
+     * Defines whether or not to generate source-code for a first order
+     * reverse mode function which evaluates several weight vectors
+     * (matrix-Jacobian product) in a single call.
+     * The zero order values are only determined once for all directions.
+     * Models may request any number of directions: they are evaluated in
+     * groups of up to maxDirections directions.
+     *
+     * @see GenericModel::ReverseOneMulti()
+     *
+     * @param maxDirections the number of directions evaluated by each call
+     *                      of the generated function (zero to disable)
+     */
+    inline void setCreateReverseOneMulti(size_t maxDirections) {
+        _reverseOneMultiDirections = maxDirections;
+    }
+
+    /**
+     * Provides the highest order of the Taylor coefficients determined by
+     * the generated forward mode function for Taylor coefficients.
+     *
+     * @return the order (zero if the function is not generated)
+     */
+    inline size_t getForwardTaylorOrder() const {
+        return _forwardTaylorOrder;
+    }
+
+    /**
+     * Defines whether or not to generate source-code for a forward mode
+     * function which propagates the Taylor coefficients of the
+     * independent variables up to a given order (e.g. for Taylor series
+     * methods in ODE integration).
+     * Models may request any order up to the one defined here.
+     * Models with atomic functions are limited to the first order.
+     *
+     * @see GenericModel::ForwardTaylor()
+     *
+     * @param order the highest order of the Taylor coefficients
+     *              (zero to disable)
+     */
+    inline void setCreateForwardTaylor(size_t order) {
+        _forwardTaylorOrder = order;
+    }
+
+    /**
+     * Determines whether or not the source-code for the Hessian-vector
+     * product function will be created.
+     */
+    inline bool isCreateHessianVectorProduct() const {
+        return _hessianVectorProducts > 0;
+    }
+
+    /**
+     * Provides the number of vectors multiplied by each call to the
+     * generated Hessian-vector product function.
+     *
+     * @return the number of vectors (zero if the function is not generated)
+     */
+    inline size_t getHessianVectorProductMaxVectors() const {
+        return _hessianVectorProducts;
+    }
+
+    /**
+     * Defines whether or not to generate source-code for a function which
+     * computes the product of the Hessian of the Lagrangian with one or more
+     * vectors (e.g. for Newton-Krylov methods) without determining the
+     * Hessian:
+     *   \f[ hv = \sum_i w_i \nabla^2 F_i( x ) v \f]
+     * Each vector is processed with a forward sweep followed by a second
+     * order reverse sweep while the zero order values are shared by all
+     * vectors.
+     *
+     * @see GenericModel::HessianVectorProduct()
+     *
+     * @param create whether or not to generate the function
+     * @param maxVectors the number of vectors multiplied by each call to
+     *                   the compiled function (models can multiply any
+     *                   number of vectors)
+     */
+    inline void setCreateHessianVectorProduct(bool create,
+                                              size_t maxVectors = 1) {
+        CPPADCG_ASSERT_KNOWN(!create || maxVectors > 0, "Invalid number of vectors")
+        _hessianVectorProducts = create ? maxVectors : 0;
+    }
+
     /**
      * Specifies a user defined Jacobian sparsity to be computed.
      * The elements can be provided in any order as long as they are a subset
@@ -851,6 +1158,70 @@ public:
         _custom_hess = Position(elements);
     }
 
+    /**
+     * Provides the order of the elements in the sparse Jacobian.
+     */
+    inline SparseMatrixLayout getSparseJacobianLayout() const {
+        return _jacLayout;
+    }
+
+    /**
+     * Defines the order of the elements in the sparse Jacobian.
+     * With a compressed row (CSR) or column (CSC) layout the generated
+     * functions write the non-zeros directly in that order (e.g. for sparse
+     * linear solvers) and an additional function provides the row or column
+     * pointers.
+     * This order replaces the order of the custom Jacobian elements.
+     *
+     * @see GenericModel::JacobianSparsityPointers()
+     */
+    inline void setSparseJacobianLayout(SparseMatrixLayout layout) {
+        _jacLayout = layout;
+    }
+
+    /**
+     * Provides the order of the elements in the sparse Hessian.
+     */
+    inline SparseMatrixLayout getSparseHessianLayout() const {
+        return _hessLayout;
+    }
+
+    /**
+     * Defines the order of the elements in the sparse Hessian.
+     * With a compressed row (CSR) or column (CSC) layout the generated
+     * functions write the non-zeros directly in that order and an additional
+     * function provides the row or column pointers.
+     * This order replaces the order of the custom Hessian elements.
+     *
+     * @see GenericModel::HessianSparsityPointers()
+     */
+    inline void setSparseHessianLayout(SparseMatrixLayout layout) {
+        _hessLayout = layout;
+    }
+
+    /**
+     * Provides which elements of the symmetric sparse Hessian are
+     * determined.
+     */
+    inline MatrixTriangle getSparseHessianTriangle() const {
+        return _hessTriangle;
+    }
+
+    /**
+     * Defines which elements of the symmetric sparse Hessian are determined
+     * (the sparse Hessian sparsity only contains those elements).
+     * With a lower or upper triangle each symmetric pair of elements is
+     * evaluated and written only once.
+     * It is ignored when custom Hessian elements are defined.
+     * The second order reverse mode still provides all the elements of
+     * each row.
+     *
+     * @see GenericModel::getSparseHessianTriangle()
+     */
+    inline void setSparseHessianTriangle(MatrixTriangle triangle) {
+        _hessTriangle = triangle;
+    }
+
     /**
      * The maximum number of assignment per generated function.
      * Zero means it is disabled (no limit).
@@ -877,6 +1248,58 @@ public:
         _maxAssignPerFunc = maxAssignPerFunc;
     }
 
+    /**
+     * Whether or not the dependencies between variables are used to decide
+     * where to split the source code into several functions.
+     */
+    inline bool isFunctionSplitByDependencies() const {
+        return _funcSplitByDeps;
+    }
+
+    /**
+     * Defines whether or not to use the dependencies between variables to
+     * decide where to split the source code into several functions
+     * (see setMaxAssignmentsPerFunc()).
+     * New functions will start where fewer temporary variables have to be
+     * shared between functions.
+     *
+     * @param split whether or not to split functions using the dependencies
+     *              between variables
+     * @see LanguageC::setFunctionSplitByDependencies()
+     */
+    inline void setFunctionSplitByDependencies(bool split) {
+        _funcSplitByDeps = split;
+    }
+
+    /**
+     * Whether or not the local functions of a large model, dense Jacobian,
+     * or dense Hessian are evaluated as parallel tasks.
+     */
+    inline bool isLocalFunctionTasks() const {
+        return _localFuncTasks;
+    }
+
+    /**
+     * Defines whether or not the local functions created for the zero order
+     * model, the dense Jacobian, and the dense Hessian (see
+     * setMaxAssignmentsPerFunc()) can be evaluated as parallel tasks.
+     * Local functions which do not depend on each other are evaluated
+     * concurrently using the multithreading type of the model library.
+     * Temporary variables are not reused in these functions so that more
+     * local functions can run at the same time, which increases the memory
+     * required for temporary variables.
+     *
+     * @param tasks whether or not to evaluate local functions as tasks
+     * @see LanguageC::setLocalFunctionTasks()
+     */
+    inline void setLocalFunctionTasks(bool tasks) {
+        _localFuncTasks = tasks;
+    }
+
+    inline bool isLocalFunctionTasksEnabled() const {
+        return _multiThreading && _localFuncTasks && _maxAssignPerFunc > 0 && (_zero || _jacobian || _hessian);
+    }
+
     /**
      * The maximum number of operations per variable assignment.
      *
@@ -896,6 +1319,97 @@ public:
         _maxOperationsPerAssignment = maxOperationsPerAssignment;
     }
 
+    /**
+     * Whether or not operations are reordered so that the number of
+     * temporary variables alive at the same time is reduced.
+     */
+    inline bool isMinimizeLiveTemporaries() const {
+        return _minimizeLiveTemps;
+    }
+
+    /**
+     * Defines whether or not to reorder operations so that the number of
+     * temporary variables alive at the same time (and therefore the size
+     * of the temporary variable arrays) is reduced.
+     *
+     * @param minimize whether or not to reorder operations
+     * @see CodeHandler::setMinimizeLiveTemporaries()
+     */
+    inline void setMinimizeLiveTemporaries(bool minimize) {
+        _minimizeLiveTemps = minimize;
+    }
+
+    /**
+     * Whether or not the Jacobian and Hessian sparsity patterns are
+     * determined from the operation graph of the model.
+     */
+    inline bool isSparsityFromGraph() const {
+        return _sparsityFromGraph;
+    }
+
+    /**
+     * Defines whether or not to determine the Jacobian and Hessian sparsity
+     * patterns by walking the operation graph of the model once (see
+     * GraphSparsity) instead of using the CppAD sparsity methods, which
+     * require a reverse sweep for each group of equations when the Hessian
+     * sparsity of each equation is needed.
+     * The CppAD methods are still used for models with atomic functions or
+     * loops.
+     *
+     * @param graph whether or not to use the operation graph
+     */
+    inline void setSparsityFromGraph(bool graph) {
+        _sparsityFromGraph = graph;
+    }
+
+    /**
+     * The file used to save the Jacobian and Hessian sparsity patterns.
+     *
+     * @return the file path (empty if the sparsity patterns are not saved)
+     */
+    inline const std::string& getSparsityCacheFile() const {
+        return _sparsityCacheFile;
+    }
+
+    /**
+     * Defines a file used to save the Jacobian and Hessian sparsity
+     * patterns of the model so that they do not have to be determined
+     * again when source code is generated later for the same model (e.g.
+     * with a different Jacobian mode or multithreading type).
+     * The patterns in an existing file are only used if the file was
+     * created for the same tape (see tapeFingerprint()) and failures to
+     * write the file do not prevent the generation of the sources.
+     *
+     * @param file the file path (an empty string disables the cache)
+     * @see SparsityCache
+     */
+    inline void setSparsityCacheFile(const std::string& file) {
+        _sparsityCacheFile = file;
+        _sparsityCache.reset();
+    }
+
+    /**
+     * Provides the number of temporary variables used by each of the
+     * previously generated sources.
+     *
+     * @return maps the names of the source generation jobs to the number of
+     *         temporary variables
+     */
+    inline const std::map<std::string, size_t>& getTemporaryVariableCount() const {
+        return _temporaryVariableCount;
+    }
+
+    /**
+     * Provides the names of the previously generated multithreaded
+     * functions which are accompanied by the functions
+     * <function>_profile_get and <function>_profile_set.
+     *
+     * @return the names of the multithreaded functions
+     */
+    inline const std::set<std::string>& getThreadPoolProfileFunctions() const {
+        return _profileFunctions;
+    }
+
     inline virtual ~ModelCSourceGen() {
         delete _funNoLoops;
         delete _atomicsInfo;
@@ -938,11 +1452,26 @@ protected:
 
     virtual const std::map<size_t, AtomicUseInfo<Base> >& getAtomicsInfo();
 
+    /**
+     * Generates a single precision (float) function from an operation graph.
+     *
+     * @param handler the operation graph
+     * @param dependent the dependent variables
+     * @param nameGen the variable name generator
+     * @param function the function name
+     * @param jobName the job name
+     */
+    virtual void generateFloatSource(CodeHandler<Base>& handler,
+                                     std::vector<CGBase>& dependent,
+                                     VariableNameGenerator<Base>& nameGen,
+                                     const std::string& function,
+                                     const std::string& jobName);
+
     /***********************************************************************
      * zero order (the original model)
      **********************************************************************/
 
-    virtual void generateZeroSource();
+    virtual void generateZeroSource(MultiThreadingType multiThreadingType);
 
     /**
      * Generates the operation graph for the zero order model with loops
@@ -954,11 +1483,22 @@ protected:
      * Jacobian
      **********************************************************************/
 
-    virtual void generateJacobianSource();
+    virtual void generateJacobianSource(MultiThreadingType multiThreadingType);
 
     virtual void generateSparseJacobianSource(MultiThreadingType multiThreadingType);
 
-    virtual void generateSparseJacobianSource(bool forward);
+    /**
+     * Generates the sparse Jacobian directly from the model tape.
+     *
+     * @param forward whether or not to use the forward mode
+     * @param createBase whether or not to generate the function which
+     *                   uses the Base type
+     * @param createFloat whether or not to generate the single precision
+     *                    function
+     */
+    virtual void generateSparseJacobianSource(bool forward,
+                                              bool createBase = true,
+                                              bool createFloat = false);
 
     virtual void generateSparseJacobianForRevSource(bool forward,
                                                     MultiThreadingType multiThreadingType);
@@ -1055,11 +1595,34 @@ protected:
      * Hessian
      **********************************************************************/
 
-    virtual void generateHessianSource();
+    virtual void generateHessianSource(MultiThreadingType multiThreadingType);
+
+    /**
+     * Prepares the evaluation of the local functions of the zero order
+     * model, the dense Jacobian, or the dense Hessian as parallel tasks
+     * (if requested).
+     */
+    inline void prepareLocalFunctionTasks(CodeHandler<Base>& handler,
+                                          LanguageC<Base>& langC,
+                                          MultiThreadingType multiThreadingType) {
+        if (isLocalFunctionTasksEnabled() && multiThreadingType != MultiThreadingType::NONE) {
+            handler.setReuseVariableIDs(false);
+            langC.setLocalFunctionTasks(multiThreadingType);
+        }
+    }
 
     virtual void generateSparseHessianSource(MultiThreadingType multiThreadingType);
 
-    virtual void generateSparseHessianSourceDirectly();
+    /**
+     * Generates the sparse Hessian directly from the model tape.
+     *
+     * @param createBase whether or not to generate the function which
+     *                   uses the Base type
+     * @param createFloat whether or not to generate the single precision
+     *                    function
+     */
+    virtual void generateSparseHessianSourceDirectly(bool createBase = true,
+                                                     bool createFloat = false);
 
     virtual void generateSparseHessianSourceFromRev2(MultiThreadingType multiThreadingType);
 
@@ -1076,8 +1639,19 @@ protected:
                                                                    const std::string& rev2Suffix,
                                                                    MultiThreadingType multiThreadingType);
 
+    /**
+     * Determines the second order elements which are evaluated.
+     *
+     * @param userRows the row indexes of the elements
+     * @param userCols the column indexes of the elements
+     * @param fullRows whether or not to provide all the elements of each
+     *                 row even if the sparse Hessian only contains one of
+     *                 the triangles (required by the second order reverse
+     *                 mode)
+     */
     virtual void determineSecondOrderElements4Eval(std::vector<size_t>& userRows,
-                                                   std::vector<size_t>& userCols);
+                                                   std::vector<size_t>& userCols,
+                                                   bool fullRows = false);
 
     /**
      * Loops
@@ -1162,6 +1736,33 @@ protected:
 
     virtual void generateForwardOneSources();
 
+    /**
+     * Generates the first order forward mode for multiple directions
+     */
+    virtual void generateForwardOneMultiSource();
+
+    /**
+     * Generates a function which provides a constant value related with
+     * another generated function (e.g. the number of directions)
+     *
+     * @param function the function name
+     * @param value the value provided by the function
+     */
+    virtual void generateFunctionInfoValueSource(const std::string& function,
+                                                 size_t value);
+
+    /***********************************************************************
+     * Forward mode for Taylor coefficients
+     **********************************************************************/
+
+    virtual void generateForwardTaylorSource();
+
+    /***********************************************************************
+     * Hessian-vector product
+     **********************************************************************/
+
+    virtual void generateHessianVectorProductSource();
+
     virtual void prepareSparseForwardOneWithLoops(const std::map<size_t, std::vector<size_t> >& elements);
 
     virtual void createForwardOneWithLoopsNL(CodeHandler<Base>& handler,
@@ -1187,6 +1788,11 @@ protected:
 
     virtual void generateReverseOneSources();
 
+    /**
+     * Generates the first order reverse mode for multiple directions
+     */
+    virtual void generateReverseOneMultiSource();
+
     virtual void prepareSparseReverseOneWithLoops(const std::map<size_t, std::vector<size_t> >& elements);
 
     virtual void createReverseOneWithLoopsNL(CodeHandler<Base>& handler,
@@ -1227,6 +1833,66 @@ protected:
      * Sparsities
      **********************************************************************/
 
+    /**
+     * Provides the object used to determine the sparsity patterns from the
+     * operation graph.
+     *
+     * @return nullptr if the sparsity patterns should be determined using
+     *         the CppAD sparsity methods
+     */
+    inline GraphSparsity<Base>* getGraphSparsity() {
+        if (!_sparsityFromGraph)
+            return nullptr;
+
+        if (_graphSparsity == nullptr) {
+            _graphSparsity.reset(new GraphSparsity<Base>(_fun, _hessianByEquation || _reverseTwo));
+        }
+
+        return _graphSparsity->isSupported() ? _graphSparsity.get() : nullptr;
+    }
+
+    /**
+     * Provides the sparsity patterns saved for the current tape.
+     * The cache file is read the first time this method is called and it
+     * is ignored if it was created for a different tape.
+     *
+     * @return nullptr if no sparsity cache file was defined
+     */
+    inline SparsityCache* getSparsityCache() {
+        if (_sparsityCacheFile.empty())
+            return nullptr;
+
+        if (_sparsityCache == nullptr) {
+            _sparsityCache.reset(new SparsityCache());
+
+            uint64_t fingerprint = tapeFingerprint(_fun);
+            size_t m = _fun.Range();
+            size_t n = _fun.Domain();
+            try {
+                if (!_sparsityCache->load(_sparsityCacheFile, fingerprint, n, m)) {
+                    _sparsityCache->reset(fingerprint, n, m);
+                }
+            } catch (const CGException&) {
+                // invalid file or created for another tape which will be replaced
+                _sparsityCache->reset(fingerprint, n, m);
+            }
+        }
+
+        return _sparsityCache.get();
+    }
+
+    /**
+     * Saves the sparsity patterns in the cache to the sparsity cache file.
+     * Failures are ignored since the cache is only an optimization.
+     */
+    inline void saveSparsityCache() {
+        try {
+            _sparsityCache->save(_sparsityCacheFile);
+        } catch (const CGException&) {
+            // the patterns will be determined again next time
+        }
+    }
+
     virtual void determineJacobianSparsity();
 
     virtual void generateJacobianSparsitySource();
@@ -1247,6 +1913,33 @@ protected:
 
     virtual void generateHessianSparsitySource();
 
+    /**
+     * Reorders the elements of a sparsity pattern according to a layout
+     *
+     * @param sparsity the sparsity pattern elements to reorder
+     * @param layout the new order
+     */
+    static inline void orderSparsity(LocalSparsityInfo& sparsity,
+                                     SparseMatrixLayout layout);
+
+    /**
+     * Generates the functions with the row/column pointers of a compressed
+     * sparse matrix and its layout
+     *
+     * @param functionPtr the name of the function for the pointers
+     * @param functionLayout the name of the function for the layout
+     * @param sparsity the elements ordered according to the layout
+     * @param layout the layout (compressed rows or columns)
+     * @param rows the number of rows
+     * @param cols the number of columns
+     */
+    virtual void generateSparsityPointersSource(const std::string& functionPtr,
+                                                const std::string& functionLayout,
+                                                const LocalSparsityInfo& sparsity,
+                                                SparseMatrixLayout layout,
+                                                size_t rows,
+                                                size_t cols);
+
 
     static inline std::map<size_t, std::vector<std::set<size_t> > > determineOrderByCol(const std::map<size_t, std::vector<size_t> >& elements,
                                                                                         const LocalSparsityInfo& sparsity);
@@ -1282,9 +1975,27 @@ protected:
     static void printFileStartPThreads(std::ostringstream& cache,
                                        const std::string& baseTypeName);
 
+    /**
+     * Prints the file level variables holding the job timing information
+     * of a multithreaded function.
+     *
+     * @param cost an estimate of the cost of each job (e.g. the number of
+     *             operations) used until time measurements are available
+     */
+    static void printFileStatePThreads(std::ostringstream& cache,
+                                       const std::vector<size_t>& cost);
+
     static void printFunctionStartPThreads(std::ostringstream& cache,
                                            size_t size);
 
+    /**
+     * Prints the functions used to export and import the job timing
+     * information of a multithreaded function.
+     */
+    static void printFunctionProfilePThreads(std::ostringstream& cache,
+                                             const std::string& functionName,
+                                             size_t size);
+
     static void printFunctionEndPThreads(std::ostringstream& cache,
                                          size_t size);
 
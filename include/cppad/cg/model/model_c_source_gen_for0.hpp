@@ -19,13 +19,14 @@ namespace CppAD {
 namespace cg {
 
 template<class Base>
-void ModelCSourceGen<Base>::generateZeroSource() {
+void ModelCSourceGen<Base>::generateZeroSource(MultiThreadingType multiThreadingType) {
     const std::string jobName = "model (zero-order forward)";
 
     startingJob("'" + jobName + "'", JobTimer::GRAPH);
 
     CodeHandler<Base> handler;
     handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
     std::vector<CGBase> indVars(_fun.Domain());
     handler.makeVariables(indVars);
@@ -50,14 +51,19 @@ void ModelCSourceGen<Base>::generateZeroSource() {
 
     LanguageC<Base> langC(_baseTypeName);
     langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setFunctionSplitByDependencies(_funcSplitByDeps);
     langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
     langC.setParameterPrecision(_parameterPrecision);
+    langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
     langC.setGenerateFunction(_name + "_" + FUNCTION_FORWAD_ZERO);
+    prepareLocalFunctionTasks(handler, langC, multiThreadingType);
 
     std::ostringstream code;
     std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator());
 
     handler.generateCode(code, langC, dep, *nameGen, _atomicFunctions, jobName);
+
+    _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
 }
 
 
@@ -84,6 +84,7 @@ void ModelCSourceGen<Base>::generateSparseForwardOneSourcesWithAtomics(const std
 
         CodeHandler<Base> handler;
         handler.setJobTimer(_jobTimer);
+        handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
         vector<CGBase> indVars(n);
         handler.makeVariables(indVars);
@@ -115,8 +116,10 @@ void ModelCSourceGen<Base>::generateSparseForwardOneSourcesWithAtomics(const std
 
         LanguageC<Base> langC(_baseTypeName);
         langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+        langC.setFunctionSplitByDependencies(_funcSplitByDeps);
         langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
         langC.setParameterPrecision(_parameterPrecision);
+        langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
         _cache.str("");
         _cache << _name << "_" << FUNCTION_SPARSE_FORWARD_ONE << "_indep" << j;
         langC.setGenerateFunction(_cache.str());
@@ -126,6 +129,9 @@ void ModelCSourceGen<Base>::generateSparseForwardOneSourcesWithAtomics(const std
         LangCDefaultHessianVarNameGenerator<Base> nameGenHess(nameGen.get(), "dx", n);
 
         handler.generateCode(code, langC, dyCustom, nameGenHess, _atomicFunctions, subJobName);
+
+        _temporaryVariableCount[subJobName] = handler.getTemporaryVariableCount();
+        _functionOperationCount[langC.getGenerateFunction()] = handler.getOperationCount();
     }
 }
 
@@ -140,6 +146,7 @@ void ModelCSourceGen<Base>::generateSparseForwardOneSourcesNoAtomics(const std::
 
     CodeHandler<Base> handler;
     handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
     vector<CGBase> x(n);
     handler.makeVariables(x);
@@ -202,8 +209,10 @@ void ModelCSourceGen<Base>::generateSparseForwardOneSourcesNoAtomics(const std::
 
         LanguageC<Base> langC(_baseTypeName);
         langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+        langC.setFunctionSplitByDependencies(_funcSplitByDeps);
         langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
         langC.setParameterPrecision(_parameterPrecision);
+        langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
         _cache.str("");
         _cache << _name << "_" << FUNCTION_SPARSE_FORWARD_ONE << "_indep" << j;
         langC.setGenerateFunction(_cache.str());
@@ -213,6 +222,9 @@ void ModelCSourceGen<Base>::generateSparseForwardOneSourcesNoAtomics(const std::
         LangCDefaultHessianVarNameGenerator<Base> nameGenHess(nameGen.get(), "dx", n);
 
         handler.generateCode(code, langC, dyCustom, nameGenHess, _atomicFunctions, subJobName);
+
+        _temporaryVariableCount[subJobName] = handler.getTemporaryVariableCount();
+        _functionOperationCount[langC.getGenerateFunction()] = handler.getOperationCount();
     }
 }
 
@@ -320,6 +332,71 @@ void ModelCSourceGen<Base>::generateForwardOneSources() {
     _cache.str("");
 }
 
+template<class Base>
+void ModelCSourceGen<Base>::generateForwardOneMultiSource() {
+    using std::vector;
+
+    const std::string jobName = "model (forward one, multiple directions)";
+    const size_t m = _fun.Range();
+    const size_t n = _fun.Domain();
+    const size_t k = _forwardOneMultiDirections;
+
+    startingJob("'" + jobName + "'", JobTimer::GRAPH);
+
+    CodeHandler<Base> handler;
+    handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
+
+    // independent variables
+    vector<CGBase> indVars(n);
+    handler.makeVariables(indVars);
+    if (_x.size() > 0) {
+        for (size_t j = 0; j < n; j++) {
+            indVars[j].setValue(_x[j]);
+        }
+    }
+
+    // directions (one after the other)
+    vector<CGBase> tx1(n * k);
+    handler.makeVariables(tx1);
+    if (_x.size() > 0) {
+        for (size_t j = 0; j < tx1.size(); j++) {
+            tx1[j].setValue(Base(0));
+        }
+    }
+
+    // the zero order values are shared by all directions
+    _fun.Forward(0, indVars);
+
+    vector<CGBase> ty1(m * k);
+    vector<CGBase> dx(n);
+    for (size_t d = 0; d < k; d++) {
+        std::copy(tx1.begin() + d * n, tx1.begin() + (d + 1) * n, dx.begin());
+        vector<CGBase> dy = _fun.Forward(1, dx);
+        std::copy(dy.begin(), dy.end(), ty1.begin() + d * m);
+    }
+
+    finishedJob();
+
+    LanguageC<Base> langC(_baseTypeName);
+    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setFunctionSplitByDependencies(_funcSplitByDeps);
+    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+    langC.setParameterPrecision(_parameterPrecision);
+    langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
+    langC.setGenerateFunction(_name + "_" + FUNCTION_FORWARD_ONE_MULTI);
+
+    std::ostringstream code;
+    std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("ty1"));
+    LangCDefaultHessianVarNameGenerator<Base> nameGenMulti(nameGen.get(), "tx1", n);
+
+    handler.generateCode(code, langC, ty1, nameGenMulti, _atomicFunctions, jobName);
+
+    _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
+
+    generateFunctionInfoValueSource(_name + "_" + FUNCTION_FORWARD_ONE_MULTI_DIRECTIONS, k);
+}
+
 } // END cg namespace
 } // END CppAD namespace
 
@@ -0,0 +1,108 @@
+#ifndef CPPAD_CG_MODEL_C_SOURCE_GEN_FOR_TAYLOR_INCLUDED
+#define CPPAD_CG_MODEL_C_SOURCE_GEN_FOR_TAYLOR_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Generates a function which propagates the Taylor coefficients of the
+ * independent variables up to a fixed order.
+ *
+ * The generated function has two inputs:
+ *  - in[0]: the zero order coefficients (x) with n elements
+ *  - in[1]: the coefficients of orders 1 to q, ordered by order
+ *           (element j of order k is at (k-1) * n + j)
+ * The output contains the coefficients of orders 0 to q of the dependent
+ * variables, ordered by order (element i of order k is at k * m + i).
+ *
+ * Atomic functions called from compiled models only provide zero and
+ * first order coefficients and, therefore, q must not be higher than one
+ * for models with atomic functions.
+ */
+template<class Base>
+void ModelCSourceGen<Base>::generateForwardTaylorSource() {
+    using std::vector;
+
+    const std::string jobName = "model (forward Taylor)";
+    const size_t m = _fun.Range();
+    const size_t n = _fun.Domain();
+    const size_t q = _forwardTaylorOrder;
+
+    CPPADCG_ASSERT_KNOWN(q <= 1 || !isAtomicsUsed(),
+                         "Forward mode functions for Taylor coefficients of order higher than one cannot be generated for models with atomic functions")
+
+    startingJob("'" + jobName + "'", JobTimer::GRAPH);
+
+    CodeHandler<Base> handler;
+    handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
+
+    // zero order
+    vector<CGBase> indVars(n);
+    handler.makeVariables(indVars);
+    if (_x.size() > 0) {
+        for (size_t j = 0; j < n; j++) {
+            indVars[j].setValue(_x[j]);
+        }
+    }
+
+    // higher orders (one after the other)
+    vector<CGBase> txk(n * q);
+    handler.makeVariables(txk);
+    if (_x.size() > 0) {
+        for (size_t j = 0; j < txk.size(); j++) {
+            txk[j].setValue(Base(0));
+        }
+    }
+
+    vector<CGBase> ty(m * (q + 1));
+
+    vector<CGBase> y0 = _fun.Forward(0, indVars);
+    std::copy(y0.begin(), y0.end(), ty.begin());
+
+    vector<CGBase> xk(n);
+    for (size_t k = 1; k <= q; k++) {
+        std::copy(txk.begin() + (k - 1) * n, txk.begin() + k * n, xk.begin());
+        vector<CGBase> yk = _fun.Forward(k, xk);
+        std::copy(yk.begin(), yk.end(), ty.begin() + k * m);
+    }
+
+    finishedJob();
+
+    LanguageC<Base> langC(_baseTypeName);
+    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setFunctionSplitByDependencies(_funcSplitByDeps);
+    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+    langC.setParameterPrecision(_parameterPrecision);
+    langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
+    langC.setGenerateFunction(_name + "_" + FUNCTION_FORWARD_TAYLOR);
+
+    std::ostringstream code;
+    std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("ty"));
+    LangCDefaultHessianVarNameGenerator<Base> nameGenTaylor(nameGen.get(), "txk", n);
+
+    handler.generateCode(code, langC, ty, nameGenTaylor, _atomicFunctions, jobName);
+
+    _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
+
+    generateFunctionInfoValueSource(_name + "_" + FUNCTION_FORWARD_TAYLOR_ORDER, q);
+}
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
@@ -19,7 +19,7 @@ namespace CppAD {
 namespace cg {
 
 template<class Base>
-void ModelCSourceGen<Base>::generateHessianSource() {
+void ModelCSourceGen<Base>::generateHessianSource(MultiThreadingType multiThreadingType) {
     using std::vector;
 
     const std::string jobName = "Hessian";
@@ -28,6 +28,7 @@ void ModelCSourceGen<Base>::generateHessianSource() {
 
     CodeHandler<Base> handler;
     handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
     size_t m = _fun.Range();
     size_t n = _fun.Domain();
@@ -64,15 +65,20 @@ void ModelCSourceGen<Base>::generateHessianSource() {
 
     LanguageC<Base> langC(_baseTypeName);
     langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setFunctionSplitByDependencies(_funcSplitByDeps);
     langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
     langC.setParameterPrecision(_parameterPrecision);
+    langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
     langC.setGenerateFunction(_name + "_" + FUNCTION_HESSIAN);
+    prepareLocalFunctionTasks(handler, langC, multiThreadingType);
 
     std::ostringstream code;
     std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("hess"));
     LangCDefaultHessianVarNameGenerator<Base> nameGenHess(nameGen.get(), n);
 
     handler.generateCode(code, langC, hess, nameGenHess, _atomicFunctions, jobName);
+
+    _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
 }
 
 template<class Base>
@@ -82,15 +88,22 @@ void ModelCSourceGen<Base>::generateSparseHessianSource(MultiThreadingType multi
      */
     determineHessianSparsity();
 
-    if (_sparseHessianReusesRev2 && _reverseTwo) {
+    if (!_sparseHessian) {
+        generateSparseHessianSourceDirectly(false, true);
+    } else if (_sparseHessianReusesRev2 && _reverseTwo) {
         generateSparseHessianSourceFromRev2(multiThreadingType);
+        if (_sparseHessianFloat) {
+            // the single precision version is always evaluated directly
+            generateSparseHessianSourceDirectly(false, true);
+        }
     } else {
-        generateSparseHessianSourceDirectly();
+        generateSparseHessianSourceDirectly(true, _sparseHessianFloat);
     }
 }
 
 template<class Base>
-void ModelCSourceGen<Base>::generateSparseHessianSourceDirectly() {
+void ModelCSourceGen<Base>::generateSparseHessianSourceDirectly(bool createBase,
+                                                                bool createFloat) {
     using std::vector;
 
     const std::string jobName = "sparse Hessian";
@@ -162,6 +175,7 @@ void ModelCSourceGen<Base>::generateSparseHessianSourceDirectly() {
 
     CodeHandler<Base> handler;
     handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
     // independent variables
     vector<CGBase> indVars(n);
@@ -210,17 +224,32 @@ void ModelCSourceGen<Base>::generateSparseHessianSourceDirectly() {
 
     finishedJob();
 
-    LanguageC<Base> langC(_baseTypeName);
-    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
-    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
-    langC.setParameterPrecision(_parameterPrecision);
-    langC.setGenerateFunction(_name + "_" + FUNCTION_SPARSE_HESSIAN);
+    if (createBase) {
+        LanguageC<Base> langC(_baseTypeName);
+        langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+        langC.setFunctionSplitByDependencies(_funcSplitByDeps);
+        langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+        langC.setParameterPrecision(_parameterPrecision);
+        langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
+        langC.setGenerateFunction(_name + "_" + FUNCTION_SPARSE_HESSIAN);
 
-    std::ostringstream code;
-    std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("hess"));
-    LangCDefaultHessianVarNameGenerator<Base> nameGenHess(nameGen.get(), n);
+        std::ostringstream code;
+        std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("hess"));
+        LangCDefaultHessianVarNameGenerator<Base> nameGenHess(nameGen.get(), n);
 
-    handler.generateCode(code, langC, hess, nameGenHess, _atomicFunctions, jobName);
+        handler.generateCode(code, langC, hess, nameGenHess, _atomicFunctions, jobName);
+
+        _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
+    }
+
+    if (createFloat) {
+        std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("hess"));
+        LangCDefaultHessianVarNameGenerator<Base> nameGenHess(nameGen.get(), n);
+
+        generateFloatSource(handler, hess, nameGenHess,
+                            _name + "_" + FUNCTION_SPARSE_HESSIAN_FLOAT,
+                            jobName + " (float)");
+    }
 }
 
 template<class Base>
@@ -234,16 +263,35 @@ void ModelCSourceGen<Base>::generateSparseHessianSourceFromRev2(MultiThreadingTy
     std::vector<size_t> evalRows, evalCols;
     determineSecondOrderElements4Eval(evalRows, evalCols);
 
+    // the reverse two functions provide every element of each row
+    std::vector<size_t> rev2Rows, rev2Cols;
+    determineSecondOrderElements4Eval(rev2Rows, rev2Cols, true);
+
     std::map<size_t, CompressedVectorInfo> hessInfo;
 
     // elements[var]{var}
-    for (size_t e = 0; e < evalRows.size(); e++) {
-        hessInfo[evalRows[e]].indexes.push_back(evalCols[e]);
+    for (size_t e = 0; e < rev2Rows.size(); e++) {
+        hessInfo[rev2Rows[e]].indexes.push_back(rev2Cols[e]);
     }
 
     // maps each element to its position in the user hessian
-    for (auto& it : hessInfo) {
-        it.second.locations = determineOrderByRow(it.first, it.second.indexes, evalRows, evalCols);
+    // (elements outside the triangle of a triangular Hessian have no position)
+    for (auto it = hessInfo.begin(); it != hessInfo.end();) {
+        it->second.locations = determineOrderByRow(it->first, it->second.indexes, evalRows, evalCols);
+
+        bool used = false;
+        for (const std::set<size_t>& l : it->second.locations) {
+            if (!l.empty()) {
+                used = true;
+                break;
+            }
+        }
+
+        if (used) {
+            ++it;
+        } else {
+            it = hessInfo.erase(it); // no need to evaluate this row
+        }
     }
 
     /**
@@ -257,10 +305,10 @@ void ModelCSourceGen<Base>::generateSparseHessianSourceFromRev2(MultiThreadingTy
         CPPADCG_ASSERT_UNKNOWN(els.size() > 0);
 
         bool passed = true;
-        size_t hessRowStart = *location[0].begin();
+        size_t hessRowStart = location[0].empty() ? 0 : *location[0].begin();
         for (size_t e = 0; e < els.size(); e++) {
-            if (location[e].size() > 1) {
-                passed = false; // too many elements
+            if (location[e].size() != 1) {
+                passed = false; // too many or missing elements
                 break;
             }
             if (*location[e].begin() != hessRowStart + e) {
@@ -285,6 +333,8 @@ void ModelCSourceGen<Base>::generateSparseHessianSourceFromRev2(MultiThreadingTy
         /**
          * with loops
          */
+        CPPADCG_ASSERT_KNOWN(_hessTriangle == MatrixTriangle::Full || _custom_hess.defined,
+                             "A triangular sparse Hessian cannot be created from the second order reverse mode for models with loops")
         generateSparseHessianWithLoopsSourceFromRev2(hessInfo, maxCompressedSize);
         return;
     }
@@ -354,6 +404,8 @@ std::string ModelCSourceGen<Base>::generateSparseHessianRev2SingleThreadSource(c
         _cache << "   " << functionRev2 << "_" << rev2Suffix << index << "(" << argsLocal << ");\n";
         if (compressed) {
             for (size_t e = 0; e < els.size(); e++) {
+                if (location[e].empty())
+                    continue; // not in the sparse Hessian
                 _cache << "   ";
                 for (size_t itl : location[e]) {
                     _cache << "hess[" << itl << "] = ";
@@ -423,6 +475,8 @@ std::string ModelCSourceGen<Base>::generateSparseHessianRev2MultiThreadSource(co
                 "   outLocal[0] = compressed;\n";
         _cache << "   " << functionRev2 << "_" << rev2Suffix << index << "(" << argsLocal << ");\n";
         for (size_t e = 0; e < els.size(); e++) {
+            if (location[e].empty())
+                continue; // not in the sparse Hessian
             _cache << "   ";
             for (size_t itl : location[e]) {
                 _cache << "hess[" << itl << "] = ";
@@ -448,6 +502,14 @@ std::string ModelCSourceGen<Base>::generateSparseHessianRev2MultiThreadSource(co
         assert(multiThreadingType == MultiThreadingType::PTHREADS);
 
         printFileStartPThreads(_cache, _baseTypeName);
+
+        std::vector<size_t> cost;
+        cost.reserve(hessInfo.size());
+        for (const auto& it : hessInfo) {
+            auto itOp = _functionOperationCount.find(functionRev2 + "_" + rev2Suffix + std::to_string(it.first));
+            cost.push_back(itOp != _functionOperationCount.end() ? itOp->second + it.second.indexes.size() : 0);
+        }
+        printFileStatePThreads(_cache, cost);
     }
 
     /**
@@ -510,23 +572,40 @@ std::string ModelCSourceGen<Base>::generateSparseHessianRev2MultiThreadSource(co
 
     _cache << "\n"
             "}\n";
+
+    if (multiThreadingType == MultiThreadingType::PTHREADS) {
+        printFunctionProfilePThreads(_cache, functionName, hessInfo.size());
+        _profileFunctions.insert(functionName);
+    }
     return _cache.str();
 }
 
 template<class Base>
 void ModelCSourceGen<Base>::determineSecondOrderElements4Eval(std::vector<size_t>& evalRows,
-                                                              std::vector<size_t>& evalCols) {
+                                                              std::vector<size_t>& evalCols,
+                                                              bool fullRows) {
+    const std::vector<size_t>* rows = &_hessSparsity.rows;
+    const std::vector<size_t>* cols = &_hessSparsity.cols;
+
+    std::vector<size_t> fullRowsIdx, fullColsIdx;
+    if (fullRows && _hessTriangle != MatrixTriangle::Full && !_custom_hess.defined) {
+        // the sparsity pattern was not filtered
+        generateSparsityIndexes(_hessSparsity.sparsity, fullRowsIdx, fullColsIdx);
+        rows = &fullRowsIdx;
+        cols = &fullColsIdx;
+    }
+
     /**
      * Atomic functions migth not have all the elements and thus there may 
      * be no symmetry. This will explore symmetry in order to provide the
      * second order elements requested by the user.
      */
-    evalRows.reserve(_hessSparsity.rows.size());
-    evalCols.reserve(_hessSparsity.cols.size());
+    evalRows.reserve(rows->size());
+    evalCols.reserve(cols->size());
 
-    for (size_t e = 0; e < _hessSparsity.rows.size(); e++) {
-        size_t i = _hessSparsity.rows[e];
-        size_t j = _hessSparsity.cols[e];
+    for (size_t e = 0; e < rows->size(); e++) {
+        size_t i = (*rows)[e];
+        size_t j = (*cols)[e];
         if (_hessSparsity.sparsity[i].find(j) == _hessSparsity.sparsity[i].end() &&
                 _hessSparsity.sparsity[j].find(i) != _hessSparsity.sparsity[j].end()) {
             // only the symmetric value is available
@@ -549,84 +628,135 @@ void ModelCSourceGen<Base>::determineHessianSparsity() {
     size_t m = _fun.Range();
     size_t n = _fun.Domain();
 
-    /**
-     * sparsity for the sum of the hessians of all equations
-     */
-    SparsitySetType r(n); // identity matrix
-    for (size_t j = 0; j < n; j++)
-        r[j].insert(j);
-    SparsitySetType jac = _fun.ForSparseJac(n, r);
+    bool byEquation = _hessianByEquation || _reverseTwo;
 
-    SparsitySetType s(1);
-    for (size_t i = 0; i < m; i++) {
-        s[0].insert(i);
-    }
-    _hessSparsity.sparsity = _fun.RevSparseHes(n, s, false);
-    //printSparsityPattern(_hessSparsity.sparsity, "hessian");
-
-    if (_hessianByEquation || _reverseTwo) {
-        /**
-         * sparsity for the hessian of each equations
-         */
+    SparsityCache* cache = getSparsityCache();
+    bool cached = cache != nullptr && cache->hasHessian && (!byEquation || cache->hasHessians);
 
-        std::set<size_t> customVarsInHess;
-        if (_custom_hess.defined) {
-            customVarsInHess.insert(_custom_hess.row.begin(), _custom_hess.row.end());
-            customVarsInHess.insert(_custom_hess.col.begin(), _custom_hess.col.end());
+    GraphSparsity<Base>* graph = cached ? nullptr : getGraphSparsity();
+    if (cached) {
+        _hessSparsity.sparsity = cache->hessian;
 
-            r = SparsitySetType(n); //clear r
-            for (size_t j : customVarsInHess) {
-                r[j].insert(j);
+        if (byEquation) {
+            _hessSparsities.resize(m);
+            for (size_t i = 0; i < m; i++) {
+                _hessSparsities[i].sparsity = cache->hessians[i];
             }
-            jac = _fun.ForSparseJac(n, r);
         }
 
+    } else if (graph != nullptr) {
         /**
-         * Coloring
+         * sparsity for the sum of the hessians of all equations and
+         * for the hessian of each equation
          */
-        const std::vector<Color> colors = colorByRow(customVarsInHess, jac);
+        _hessSparsity.sparsity = graph->getHessianSparsity();
 
+        if (byEquation) {
+            const std::vector<SparsitySetType>& hessians = graph->getHessianSparsities();
+            _hessSparsities.resize(m);
+            for (size_t i = 0; i < m; i++) {
+                _hessSparsities[i].sparsity = hessians[i];
+            }
+        }
+
+    } else {
         /**
-         * For each individual equation
+         * sparsity for the sum of the hessians of all equations
          */
-        _hessSparsities.resize(m);
+        SparsitySetType r(n); // identity matrix
+        for (size_t j = 0; j < n; j++)
+            r[j].insert(j);
+        SparsitySetType jac = _fun.ForSparseJac(n, r);
+
+        SparsitySetType s(1);
         for (size_t i = 0; i < m; i++) {
-            _hessSparsities[i].sparsity.resize(n);
+            s[0].insert(i);
         }
+        _hessSparsity.sparsity = _fun.RevSparseHes(n, s, false);
+        //printSparsityPattern(_hessSparsity.sparsity, "hessian");
 
-        for (size_t c = 0; c < colors.size(); c++) {
-            const Color& color = colors[c];
+        if (byEquation) {
+            /**
+             * sparsity for the hessian of each equations
+             */
 
-            // first-order
-            r = SparsitySetType(n); //clear r
-            for (size_t j : color.forbiddenRows) {
-                r[j].insert(j);
-            }
-            _fun.ForSparseJac(n, r);
+            std::set<size_t> customVarsInHess;
+            if (_custom_hess.defined) {
+                customVarsInHess.insert(_custom_hess.row.begin(), _custom_hess.row.end());
+                customVarsInHess.insert(_custom_hess.col.begin(), _custom_hess.col.end());
 
-            // second-order
-            s[0].clear();
-            const std::set<size_t>& equations = color.rows;
-            for (size_t i : equations) {
-                s[0].insert(i);
+                r = SparsitySetType(n); //clear r
+                for (size_t j : customVarsInHess) {
+                    r[j].insert(j);
+                }
+                jac = _fun.ForSparseJac(n, r);
             }
 
-            SparsitySetType sparsityc = _fun.RevSparseHes(n, s, false);
+            /**
+             * Coloring
+             */
+            const std::vector<Color> colors = colorByRow(customVarsInHess, jac);
 
             /**
-             * Retrieve the individual hessians for each equation
+             * For each individual equation
              */
-            const std::map<size_t, size_t>& var2Eq = color.column2Row;
-            for (size_t j : color.forbiddenRows) { //used variables
-                if (sparsityc[j].size() > 0) {
-                    size_t i = var2Eq.at(j);
-                    _hessSparsities[i].sparsity[j].insert(sparsityc[j].begin(),
-                                                          sparsityc[j].end());
+            _hessSparsities.resize(m);
+            for (size_t i = 0; i < m; i++) {
+                _hessSparsities[i].sparsity.resize(n);
+            }
+
+            for (size_t c = 0; c < colors.size(); c++) {
+                const Color& color = colors[c];
+
+                // first-order
+                r = SparsitySetType(n); //clear r
+                for (size_t j : color.forbiddenRows) {
+                    r[j].insert(j);
+                }
+                _fun.ForSparseJac(n, r);
+
+                // second-order
+                s[0].clear();
+                const std::set<size_t>& equations = color.rows;
+                for (size_t i : equations) {
+                    s[0].insert(i);
+                }
+
+                SparsitySetType sparsityc = _fun.RevSparseHes(n, s, false);
+
+                /**
+                 * Retrieve the individual hessians for each equation
+                 */
+                const std::map<size_t, size_t>& var2Eq = color.column2Row;
+                for (size_t j : color.forbiddenRows) { //used variables
+                    if (sparsityc[j].size() > 0) {
+                        size_t i = var2Eq.at(j);
+                        _hessSparsities[i].sparsity[j].insert(sparsityc[j].begin(),
+                                                              sparsityc[j].end());
+                    }
                 }
+
             }
+        }
+    }
 
+    if (cache != nullptr && !cached) {
+        cache->hessian = _hessSparsity.sparsity;
+        cache->hasHessian = true;
+
+        if (byEquation && (!_custom_hess.defined || graph != nullptr)) {
+            // the CppAD methods only determine the custom elements of each equation when a custom sparsity is used
+            cache->hessians.resize(m);
+            for (size_t i = 0; i < m; i++) {
+                cache->hessians[i] = _hessSparsities[i].sparsity;
+            }
+            cache->hasHessians = true;
         }
 
+        saveSparsityCache();
+    }
+
+    if (byEquation) {
         for (size_t i = 0; i < m; i++) {
             LocalSparsityInfo& hessSparsitiesi = _hessSparsities[i];
 
@@ -653,10 +783,30 @@ void ModelCSourceGen<Base>::determineHessianSparsity() {
         generateSparsityIndexes(_hessSparsity.sparsity,
                                 _hessSparsity.rows, _hessSparsity.cols);
 
+        if (_hessTriangle != MatrixTriangle::Full) {
+            // only one element of each symmetric pair
+            // (the second order reverse mode uses the complete sparsity pattern)
+            bool lower = _hessTriangle == MatrixTriangle::Lower;
+            size_t nnz = 0;
+            for (size_t e = 0; e < _hessSparsity.rows.size(); e++) {
+                size_t i = _hessSparsity.rows[e];
+                size_t j = _hessSparsity.cols[e];
+                if (lower ? i >= j : i <= j) {
+                    _hessSparsity.rows[nnz] = i;
+                    _hessSparsity.cols[nnz] = j;
+                    nnz++;
+                }
+            }
+            _hessSparsity.rows.resize(nnz);
+            _hessSparsity.cols.resize(nnz);
+        }
+
     } else {
         _hessSparsity.rows = _custom_hess.row;
         _hessSparsity.cols = _custom_hess.col;
     }
+
+    orderSparsity(_hessSparsity, _hessLayout);
 }
 
 template<class Base>
@@ -667,6 +817,20 @@ void ModelCSourceGen<Base>::generateHessianSparsitySource() {
     _sources[_name + "_" + FUNCTION_HESSIAN_SPARSITY + ".c"] = _cache.str();
     _cache.str("");
 
+    if (_hessTriangle != MatrixTriangle::Full && !_custom_hess.defined) {
+        generateFunctionInfoValueSource(_name + "_" + FUNCTION_HESSIAN_SPARSITY_TRIANGLE, size_t(_hessTriangle));
+        _cache.str("");
+    }
+
+    if (_hessLayout != SparseMatrixLayout::Coordinate) {
+        size_t n = _fun.Domain();
+        generateSparsityPointersSource(_name + "_" + FUNCTION_HESSIAN_SPARSITY_PTR,
+                                       _name + "_" + FUNCTION_HESSIAN_SPARSITY_LAYOUT,
+                                       _hessSparsity, _hessLayout,
+                                       n, n);
+        _cache.str("");
+    }
+
     if (_hessianByEquation || _reverseTwo) {
         generateSparsity2DSource2(_name + "_" + FUNCTION_HESSIAN_SPARSITY2, _hessSparsities);
         _sources[_name + "_" + FUNCTION_HESSIAN_SPARSITY2 + ".c"] = _cache.str();
@@ -44,12 +44,69 @@ const std::string ModelCSourceGen<Base>::FUNCTION_SPARSE_JACOBIAN = "sparse_jaco
 template<class Base>
 const std::string ModelCSourceGen<Base>::FUNCTION_SPARSE_HESSIAN = "sparse_hessian";
 
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_SPARSE_JACOBIAN_FLOAT = "sparse_jacobian_float";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_SPARSE_HESSIAN_FLOAT = "sparse_hessian_float";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_SPARSE_JACOBIAN_PROFILE_GET = "sparse_jacobian_profile_get";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_SPARSE_JACOBIAN_PROFILE_SET = "sparse_jacobian_profile_set";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_SPARSE_HESSIAN_PROFILE_GET = "sparse_hessian_profile_get";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_SPARSE_HESSIAN_PROFILE_SET = "sparse_hessian_profile_set";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_FORWARD_ONE_MULTI = "forward_one_multi";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_REVERSE_ONE_MULTI = "reverse_one_multi";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_FORWARD_ONE_MULTI_DIRECTIONS = "forward_one_multi_directions";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_REVERSE_ONE_MULTI_DIRECTIONS = "reverse_one_multi_directions";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_FORWARD_TAYLOR = "forward_taylor";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_FORWARD_TAYLOR_ORDER = "forward_taylor_order";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_HESSIAN_VECTOR_PRODUCT = "hessian_vector_product";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_HESSIAN_VECTOR_PRODUCT_VECTORS = "hessian_vector_product_vectors";
+
 template<class Base>
 const std::string ModelCSourceGen<Base>::FUNCTION_JACOBIAN_SPARSITY = "jacobian_sparsity";
 
 template<class Base>
 const std::string ModelCSourceGen<Base>::FUNCTION_HESSIAN_SPARSITY = "hessian_sparsity";
 
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_JACOBIAN_SPARSITY_PTR = "jacobian_sparsity_ptr";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_HESSIAN_SPARSITY_PTR = "hessian_sparsity_ptr";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_JACOBIAN_SPARSITY_LAYOUT = "jacobian_sparsity_layout";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_HESSIAN_SPARSITY_LAYOUT = "hessian_sparsity_layout";
+
+template<class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_HESSIAN_SPARSITY_TRIANGLE = "hessian_sparsity_triangle";
+
 template<class Base>
 const std::string ModelCSourceGen<Base>::FUNCTION_HESSIAN_SPARSITY2 = "hessian_sparsity2";
 
@@ -107,16 +164,16 @@ void ModelCSourceGen<Base>::generateSources(MultiThreadingType multiThreadingTyp
     startingJob("'" + _name + "'", JobTimer::SOURCE_FOR_MODEL);
 
     if (_zero) {
-        generateZeroSource();
+        generateZeroSource(multiThreadingType);
         _zeroEvaluated = true;
     }
 
     if (_jacobian) {
-        generateJacobianSource();
+        generateJacobianSource(multiThreadingType);
     }
 
     if (_hessian) {
-        generateHessianSource();
+        generateHessianSource(multiThreadingType);
     }
 
     if (_forwardOne) {
@@ -134,19 +191,35 @@ void ModelCSourceGen<Base>::generateSources(MultiThreadingType multiThreadingTyp
         generateReverseTwoSources();
     }
 
-    if (_sparseJacobian) {
+    if (_forwardOneMultiDirections > 0) {
+        generateForwardOneMultiSource();
+    }
+
+    if (_reverseOneMultiDirections > 0) {
+        generateReverseOneMultiSource();
+    }
+
+    if (_forwardTaylorOrder > 0) {
+        generateForwardTaylorSource();
+    }
+
+    if (_hessianVectorProducts > 0) {
+        generateHessianVectorProductSource();
+    }
+
+    if (_sparseJacobian || _sparseJacobianFloat) {
         generateSparseJacobianSource(multiThreadingType);
     }
 
-    if (_sparseHessian) {
+    if (_sparseHessian || _sparseHessianFloat) {
         generateSparseHessianSource(multiThreadingType);
     }
 
-    if (_sparseJacobian || _forwardOne || _reverseOne) {
+    if (_sparseJacobian || _sparseJacobianFloat || _forwardOne || _reverseOne) {
         generateJacobianSparsitySource();
     }
 
-    if (_sparseHessian || _reverseTwo) {
+    if (_sparseHessian || _sparseHessianFloat || _reverseTwo) {
         generateHessianSparsitySource();
     }
 
@@ -167,6 +240,7 @@ void ModelCSourceGen<Base>::generateLoops() {
 
     CodeHandler<Base> handler;
     handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
     std::vector<CGBase> xx(_fun.Domain());
     handler.makeVariables(xx);
@@ -213,6 +287,18 @@ void ModelCSourceGen<Base>::generateInfoSource() {
     _sources[funcName + ".c"] = _cache.str();
 }
 
+template<class Base>
+void ModelCSourceGen<Base>::generateFunctionInfoValueSource(const std::string& function,
+                                                            size_t value) {
+    _cache.str("");
+    LanguageC<Base>::printFunctionDeclaration(_cache, "void", function, {"unsigned long* value"});
+    _cache << " {\n"
+            "   *value = " << value << ";\n"
+            "}\n\n";
+
+    _sources[function + ".c"] = _cache.str();
+}
+
 template<class Base>
 void ModelCSourceGen<Base>::generateAtomicFuncNames() {
     std::string funcName = _name + "_" + FUNCTION_ATOMIC_FUNC_NAMES;
@@ -252,6 +338,28 @@ const std::map<size_t, AtomicUseInfo<Base> >& ModelCSourceGen<Base>::getAtomicsI
     return *_atomicsInfo;
 }
 
+template<class Base>
+void ModelCSourceGen<Base>::generateFloatSource(CodeHandler<Base>& handler,
+                                                std::vector<CGBase>& dependent,
+                                                VariableNameGenerator<Base>& nameGen,
+                                                const std::string& function,
+                                                const std::string& jobName) {
+    CPPADCG_ASSERT_KNOWN(!isAtomicsUsed(), "Single precision functions cannot be generated for models with atomic functions")
+    CPPADCG_ASSERT_KNOWN(_loopTapes.empty(), "Single precision functions cannot be generated for models with loops")
+
+    LanguageCSinglePrecision<Base> langC;
+    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setFunctionSplitByDependencies(_funcSplitByDeps);
+    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+    langC.setGenerateFunction(function);
+
+    std::ostringstream code;
+
+    handler.generateCode(code, langC, dependent, nameGen, _atomicFunctions, jobName);
+
+    _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
+}
+
 template<class Base>
 std::vector<typename ModelCSourceGen<Base>::Color> ModelCSourceGen<Base>::colorByRow(const std::set<size_t>& columns,
                                                                                      const SparsitySetType& sparsity) {
@@ -385,6 +493,60 @@ void ModelCSourceGen<Base>::generateSparsity1DSource(const std::string& function
             "}\n";
 }
 
+template<class Base>
+inline void ModelCSourceGen<Base>::orderSparsity(LocalSparsityInfo& sparsity,
+                                                 SparseMatrixLayout layout) {
+    if (layout == SparseMatrixLayout::Coordinate)
+        return;
+
+    const std::vector<size_t>& outer = layout == SparseMatrixLayout::CompressedRow ? sparsity.rows : sparsity.cols;
+    const std::vector<size_t>& inner = layout == SparseMatrixLayout::CompressedRow ? sparsity.cols : sparsity.rows;
+
+    size_t nnz = sparsity.rows.size();
+    std::vector<size_t> order(nnz);
+    for (size_t e = 0; e < nnz; e++)
+        order[e] = e;
+
+    std::stable_sort(order.begin(), order.end(), [&](size_t e1, size_t e2) {
+        return outer[e1] < outer[e2] || (outer[e1] == outer[e2] && inner[e1] < inner[e2]);
+    });
+
+    std::vector<size_t> rows(nnz), cols(nnz);
+    for (size_t e = 0; e < nnz; e++) {
+        rows[e] = sparsity.rows[order[e]];
+        cols[e] = sparsity.cols[order[e]];
+    }
+    sparsity.rows.swap(rows);
+    sparsity.cols.swap(cols);
+}
+
+template<class Base>
+void ModelCSourceGen<Base>::generateSparsityPointersSource(const std::string& functionPtr,
+                                                           const std::string& functionLayout,
+                                                           const LocalSparsityInfo& sparsity,
+                                                           SparseMatrixLayout layout,
+                                                           size_t rows,
+                                                           size_t cols) {
+    CPPADCG_ASSERT_UNKNOWN(layout != SparseMatrixLayout::Coordinate)
+
+    bool byRow = layout == SparseMatrixLayout::CompressedRow;
+    const std::vector<size_t>& outer = byRow ? sparsity.rows : sparsity.cols;
+
+    // the position of the first element of each row/column
+    std::vector<size_t> ptr((byRow ? rows : cols) + 1, 0);
+    for (size_t o : outer)
+        ptr[o + 1]++;
+    for (size_t k = 1; k < ptr.size(); k++)
+        ptr[k] += ptr[k - 1];
+
+    _cache.str("");
+    generateSparsity1DSource(functionPtr, ptr);
+    _sources[functionPtr + ".c"] = _cache.str();
+    _cache.str("");
+
+    generateFunctionInfoValueSource(functionLayout, size_t(layout));
+}
+
 template<class Base>
 void ModelCSourceGen<Base>::generateSparsity2DSource(const std::string& function,
                                                      const LocalSparsityInfo& sparsity) {
@@ -662,8 +824,10 @@ void ModelCSourceGen<Base>::printFileStartPThreads(std::ostringstream& cache,
 }
 
 template<class Base>
-void ModelCSourceGen<Base>::printFunctionStartPThreads(std::ostringstream& cache,
-                                                       size_t size) {
+void ModelCSourceGen<Base>::printFileStatePThreads(std::ostringstream& cache,
+                                                   const std::vector<size_t>& cost) {
+    size_t size = cost.size();
+
     auto repeatFill = [&](const std::string& txt){
         cache << "{";
         for (size_t i = 0; i < size; ++i) {
@@ -673,28 +837,74 @@ void ModelCSourceGen<Base>::printFunctionStartPThreads(std::ostringstream& cache
         cache << "};";
     };
 
-    cache << "   ExecArgStruct* args[" << size << "];\n";
-    cache << "   static cppadcg_thpool_function_type execute_functions[" << size << "] = ";
-    repeatFill("exec_func");
-    cache << "\n";
-    cache << "   static float ref_elapsed[" << size << "] = ";
-    repeatFill("0");
-    cache << "\n";
-    cache << "   static float elapsed[" << size << "] = ";
+    /**
+     * the initial reference times are estimated from the number of
+     * operations (~1ns each) and they are replaced by the first time
+     * measurements; only their relative values matter for scheduling
+     */
+    std::vector<float> refElapsed(size);
+    std::vector<size_t> order(size);
+    for (size_t i = 0; i < size; ++i) {
+        refElapsed[i] = float(cost[i]) * 1e-9f;
+        order[i] = i;
+    }
+
+    if (std::find_if(cost.begin(), cost.end(), [](size_t c) { return c == 0; }) == cost.end()) {
+        // same order as the one from cppadcg_thpool_update_order()
+        std::vector<size_t> sorted(order);
+        std::stable_sort(sorted.begin(), sorted.end(), [&](size_t a, size_t b) {
+            return refElapsed[a] < refElapsed[b];
+        });
+        for (size_t i = 0; i < size; ++i) {
+            order[sorted[i]] = size - i - 1; // descending order
+        }
+    } else {
+        // incomplete estimates
+        std::fill(refElapsed.begin(), refElapsed.end(), 0.0f);
+    }
+
+    cache << "\n"
+            "static float ref_elapsed[" << size << "] = {";
+    for (size_t i = 0; i < size; ++i) {
+        if (i != 0) cache << ", ";
+        std::ostringstream number;
+        number << std::scientific << std::setprecision(std::numeric_limits<float>::digits10) << refElapsed[i];
+        cache << number.str() << "f";
+    }
+    cache << "};\n"
+            "static float elapsed[" << size << "] = ";
     repeatFill("0");
     cache << "\n"
-            "   static int order[" << size << "] = {";
+            "static int order[" << size << "] = {";
     for (size_t i = 0; i < size; ++i) {
         if (i != 0) cache << ", ";
-        cache << i;
+        cache << order[i];
     }
     cache << "};\n"
-            "   static int job2Thread[" << size << "] = ";
+            "static int job2Thread[" << size << "] = ";
     repeatFill("-1");
     cache << "\n"
-            "   static int last_elapsed_changed = 1;\n"
+            "static int last_elapsed_changed = 1;\n"
+            "static unsigned int n_meas = 0;\n";
+}
+
+template<class Base>
+void ModelCSourceGen<Base>::printFunctionStartPThreads(std::ostringstream& cache,
+                                                       size_t size) {
+    auto repeatFill = [&](const std::string& txt){
+        cache << "{";
+        for (size_t i = 0; i < size; ++i) {
+            if (i != 0) cache << ", ";
+            cache << txt;
+        }
+        cache << "};";
+    };
+
+    cache << "   ExecArgStruct* args[" << size << "];\n";
+    cache << "   static cppadcg_thpool_function_type execute_functions[" << size << "] = ";
+    repeatFill("exec_func");
+    cache << "\n"
             "   unsigned int nBench = cppadcg_thpool_get_n_time_meas();\n"
-            "   static unsigned int n_meas = 0;\n"
             "   int do_benchmark = " << (size > 0 ? "(n_meas < nBench && !cppadcg_thpool_is_disabled())" : "0") << ";\n"
             "   float* elapsed_p = do_benchmark ? elapsed : NULL;\n";
 }
@@ -718,6 +928,34 @@ void ModelCSourceGen<Base>::printFunctionEndPThreads(std::ostringstream& cache,
             "   }\n";
 }
 
+template<class Base>
+void ModelCSourceGen<Base>::printFunctionProfilePThreads(std::ostringstream& cache,
+                                                         const std::string& functionName,
+                                                         size_t size) {
+    cache << "\n"
+            "unsigned long " << functionName << "_profile_get(float* ref, unsigned int* nMeas) {\n"
+            "   unsigned long i;\n"
+            "   if(ref != NULL) {\n"
+            "      for(i = 0; i < " << size << "; ++i) {\n"
+            "         ref[i] = ref_elapsed[i];\n"
+            "      }\n"
+            "   }\n"
+            "   if(nMeas != NULL) {\n"
+            "      *nMeas = n_meas;\n"
+            "   }\n"
+            "   return " << size << ";\n"
+            "}\n"
+            "\n"
+            "void " << functionName << "_profile_set(const float* ref, unsigned long n, unsigned int nMeas) {\n"
+            "   if(n != " << size << " || ref == NULL) {\n"
+            "      return;\n"
+            "   }\n"
+            "   cppadcg_thpool_update_order(ref_elapsed, 0, ref, order, " << size << ");\n"
+            "   n_meas = nMeas;\n"
+            "   last_elapsed_changed = 1;\n"
+            "}\n";
+}
+
 template<class Base>
 void ModelCSourceGen<Base>::printFileStartOpenMP(std::ostringstream& cache) {
     cache << CPPADCG_OPENMP_H_FILE << "\n"
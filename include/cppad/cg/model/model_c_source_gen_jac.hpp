@@ -19,7 +19,7 @@ namespace CppAD {
 namespace cg {
 
 template<class Base>
-void ModelCSourceGen<Base>::generateJacobianSource() {
+void ModelCSourceGen<Base>::generateJacobianSource(MultiThreadingType multiThreadingType) {
     using std::vector;
 
     const std::string jobName = "Jacobian";
@@ -28,6 +28,7 @@ void ModelCSourceGen<Base>::generateJacobianSource() {
 
     CodeHandler<Base> handler;
     handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
     vector<CGBase> indVars(_fun.Domain());
     handler.makeVariables(indVars);
@@ -53,14 +54,19 @@ void ModelCSourceGen<Base>::generateJacobianSource() {
 
     LanguageC<Base> langC(_baseTypeName);
     langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setFunctionSplitByDependencies(_funcSplitByDeps);
     langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
     langC.setParameterPrecision(_parameterPrecision);
+    langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
     langC.setGenerateFunction(_name + "_" + FUNCTION_JACOBIAN);
+    prepareLocalFunctionTasks(handler, langC, multiThreadingType);
 
     std::ostringstream code;
     std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("jac"));
 
     handler.generateCode(code, langC, jac, *nameGen, _atomicFunctions, jobName);
+
+    _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
 }
 
 template<class Base>
@@ -88,17 +94,23 @@ void ModelCSourceGen<Base>::generateSparseJacobianSource(MultiThreadingType mult
     /**
      * call the appropriate method for source code generation
      */
-    if (_sparseJacobianReusesOne && _forwardOne && forwardMode) {
-        generateSparseJacobianForRevSource(true, multiThreadingType);
-    } else if (_sparseJacobianReusesOne && _reverseOne && !forwardMode) {
-        generateSparseJacobianForRevSource(false, multiThreadingType);
+    if (!_sparseJacobian) {
+        generateSparseJacobianSource(forwardMode, false, true);
+    } else if (_sparseJacobianReusesOne && ((_forwardOne && forwardMode) || (_reverseOne && !forwardMode))) {
+        generateSparseJacobianForRevSource(forwardMode, multiThreadingType);
+        if (_sparseJacobianFloat) {
+            // the single precision version is always evaluated directly
+            generateSparseJacobianSource(forwardMode, false, true);
+        }
     } else {
-        generateSparseJacobianSource(forwardMode);
+        generateSparseJacobianSource(forwardMode, true, _sparseJacobianFloat);
     }
 }
 
 template<class Base>
-void ModelCSourceGen<Base>::generateSparseJacobianSource(bool forward) {
+void ModelCSourceGen<Base>::generateSparseJacobianSource(bool forward,
+                                                         bool createBase,
+                                                         bool createFloat) {
     using std::vector;
 
     const std::string jobName = "sparse Jacobian";
@@ -110,6 +122,7 @@ void ModelCSourceGen<Base>::generateSparseJacobianSource(bool forward) {
 
     CodeHandler<Base> handler;
     handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
     vector<CGBase> indVars(n);
     handler.makeVariables(indVars);
@@ -135,16 +148,30 @@ void ModelCSourceGen<Base>::generateSparseJacobianSource(bool forward) {
 
     finishedJob();
 
-    LanguageC<Base> langC(_baseTypeName);
-    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
-    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
-    langC.setParameterPrecision(_parameterPrecision);
-    langC.setGenerateFunction(_name + "_" + FUNCTION_SPARSE_JACOBIAN);
+    if (createBase) {
+        LanguageC<Base> langC(_baseTypeName);
+        langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+        langC.setFunctionSplitByDependencies(_funcSplitByDeps);
+        langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+        langC.setParameterPrecision(_parameterPrecision);
+        langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
+        langC.setGenerateFunction(_name + "_" + FUNCTION_SPARSE_JACOBIAN);
 
-    std::ostringstream code;
-    std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("jac"));
+        std::ostringstream code;
+        std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("jac"));
 
-    handler.generateCode(code, langC, jac, *nameGen, _atomicFunctions, jobName);
+        handler.generateCode(code, langC, jac, *nameGen, _atomicFunctions, jobName);
+
+        _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
+    }
+
+    if (createFloat) {
+        std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("jac"));
+
+        generateFloatSource(handler, jac, *nameGen,
+                            _name + "_" + FUNCTION_SPARSE_JACOBIAN_FLOAT,
+                            jobName + " (float)");
+    }
 }
 
 template<class Base>
@@ -391,6 +418,14 @@ std::string ModelCSourceGen<Base>::generateSparseJacobianForRevMultiThreadSource
         assert(multiThreadingType == MultiThreadingType::PTHREADS);
 
         printFileStartPThreads(_cache, _baseTypeName);
+
+        std::vector<size_t> cost;
+        cost.reserve(jacInfo.size());
+        for (const auto& it : jacInfo) {
+            auto itOp = _functionOperationCount.find(functionRevFor + "_" + revForSuffix + std::to_string(it.first));
+            cost.push_back(itOp != _functionOperationCount.end() ? itOp->second + it.second.indexes.size() : 0);
+        }
+        printFileStatePThreads(_cache, cost);
     }
 
     /**
@@ -454,6 +489,11 @@ std::string ModelCSourceGen<Base>::generateSparseJacobianForRevMultiThreadSource
     _cache << "\n"
             "}\n";
 
+    if (multiThreadingType == MultiThreadingType::PTHREADS) {
+        printFunctionProfilePThreads(_cache, functionName, jacInfo.size());
+        _profileFunctions.insert(functionName);
+    }
+
     return _cache.str();
 }
 
@@ -466,7 +506,23 @@ void ModelCSourceGen<Base>::determineJacobianSparsity() {
     /**
      * Determine the sparsity pattern
      */
-    _jacSparsity.sparsity = jacobianSparsitySet<SparsitySetType, CGBase> (_fun);
+    SparsityCache* cache = getSparsityCache();
+    if (cache != nullptr && cache->hasJacobian) {
+        _jacSparsity.sparsity = cache->jacobian;
+    } else {
+        GraphSparsity<Base>* graph = getGraphSparsity();
+        if (graph != nullptr) {
+            _jacSparsity.sparsity = graph->getJacobianSparsity();
+        } else {
+            _jacSparsity.sparsity = jacobianSparsitySet<SparsitySetType, CGBase> (_fun);
+        }
+
+        if (cache != nullptr) {
+            cache->jacobian = _jacSparsity.sparsity;
+            cache->hasJacobian = true;
+            saveSparsityCache();
+        }
+    }
 
     if (!_custom_jac.defined) {
         generateSparsityIndexes(_jacSparsity.sparsity, _jacSparsity.rows, _jacSparsity.cols);
@@ -475,6 +531,8 @@ void ModelCSourceGen<Base>::determineJacobianSparsity() {
         _jacSparsity.rows = _custom_jac.row;
         _jacSparsity.cols = _custom_jac.col;
     }
+
+    orderSparsity(_jacSparsity, _jacLayout);
 }
 
 template<class Base>
@@ -484,6 +542,14 @@ void ModelCSourceGen<Base>::generateJacobianSparsitySource() {
     generateSparsity2DSource(_name + "_" + FUNCTION_JACOBIAN_SPARSITY, _jacSparsity);
     _sources[_name + "_" + FUNCTION_JACOBIAN_SPARSITY + ".c"] = _cache.str();
     _cache.str("");
+
+    if (_jacLayout != SparseMatrixLayout::Coordinate) {
+        generateSparsityPointersSource(_name + "_" + FUNCTION_JACOBIAN_SPARSITY_PTR,
+                                       _name + "_" + FUNCTION_JACOBIAN_SPARSITY_LAYOUT,
+                                       _jacSparsity, _jacLayout,
+                                       _fun.Range(), _fun.Domain());
+        _cache.str("");
+    }
 }
 
 } // END cg namespace
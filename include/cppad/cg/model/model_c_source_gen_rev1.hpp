@@ -88,6 +88,7 @@ void ModelCSourceGen<Base>::generateSparseReverseOneSourcesWithAtomics(const std
 
         CodeHandler<Base> handler;
         handler.setJobTimer(_jobTimer);
+        handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
         vector<CGBase> indVars(_fun.Domain());
         handler.makeVariables(indVars);
@@ -120,8 +121,10 @@ void ModelCSourceGen<Base>::generateSparseReverseOneSourcesWithAtomics(const std
 
         LanguageC<Base> langC(_baseTypeName);
         langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+        langC.setFunctionSplitByDependencies(_funcSplitByDeps);
         langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
         langC.setParameterPrecision(_parameterPrecision);
+        langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
         _cache.str("");
         _cache << _name << "_" << FUNCTION_SPARSE_REVERSE_ONE << "_dep" << i;
         langC.setGenerateFunction(_cache.str());
@@ -131,6 +134,9 @@ void ModelCSourceGen<Base>::generateSparseReverseOneSourcesWithAtomics(const std
         LangCDefaultHessianVarNameGenerator<Base> nameGenHess(nameGen.get(), "py", n);
 
         handler.generateCode(code, langC, dwCustom, nameGenHess, _atomicFunctions, subJobName);
+
+        _temporaryVariableCount[subJobName] = handler.getTemporaryVariableCount();
+        _functionOperationCount[langC.getGenerateFunction()] = handler.getOperationCount();
     }
 }
 
@@ -146,6 +152,7 @@ void ModelCSourceGen<Base>::generateSparseReverseOneSourcesNoAtomics(const std::
 
     CodeHandler<Base> handler;
     handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
     vector<CGBase> x(n);
     handler.makeVariables(x);
@@ -208,8 +215,10 @@ void ModelCSourceGen<Base>::generateSparseReverseOneSourcesNoAtomics(const std::
 
         LanguageC<Base> langC(_baseTypeName);
         langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+        langC.setFunctionSplitByDependencies(_funcSplitByDeps);
         langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
         langC.setParameterPrecision(_parameterPrecision);
+        langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
         _cache.str("");
         _cache << _name << "_" << FUNCTION_SPARSE_REVERSE_ONE << "_dep" << i;
         langC.setGenerateFunction(_cache.str());
@@ -219,6 +228,9 @@ void ModelCSourceGen<Base>::generateSparseReverseOneSourcesNoAtomics(const std::
         LangCDefaultHessianVarNameGenerator<Base> nameGenHess(nameGen.get(), "py", n);
 
         handler.generateCode(code, langC, dwCustom, nameGenHess, _atomicFunctions, subJobName);
+
+        _temporaryVariableCount[subJobName] = handler.getTemporaryVariableCount();
+        _functionOperationCount[langC.getGenerateFunction()] = handler.getOperationCount();
     }
 }
 
@@ -323,6 +335,71 @@ void ModelCSourceGen<Base>::generateReverseOneSources() {
     _cache.str("");
 }
 
+template<class Base>
+void ModelCSourceGen<Base>::generateReverseOneMultiSource() {
+    using std::vector;
+
+    const std::string jobName = "model (reverse one, multiple directions)";
+    const size_t m = _fun.Range();
+    const size_t n = _fun.Domain();
+    const size_t k = _reverseOneMultiDirections;
+
+    startingJob("'" + jobName + "'", JobTimer::GRAPH);
+
+    CodeHandler<Base> handler;
+    handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
+
+    // independent variables
+    vector<CGBase> indVars(n);
+    handler.makeVariables(indVars);
+    if (_x.size() > 0) {
+        for (size_t j = 0; j < n; j++) {
+            indVars[j].setValue(_x[j]);
+        }
+    }
+
+    // weights for each direction (one after the other)
+    vector<CGBase> py(m * k);
+    handler.makeVariables(py);
+    if (_x.size() > 0) {
+        for (size_t i = 0; i < py.size(); i++) {
+            py[i].setValue(Base(1.0));
+        }
+    }
+
+    // the zero order values are shared by all directions
+    _fun.Forward(0, indVars);
+
+    vector<CGBase> px(n * k);
+    vector<CGBase> w(m);
+    for (size_t d = 0; d < k; d++) {
+        std::copy(py.begin() + d * m, py.begin() + (d + 1) * m, w.begin());
+        vector<CGBase> dw = _fun.Reverse(1, w);
+        std::copy(dw.begin(), dw.end(), px.begin() + d * n);
+    }
+
+    finishedJob();
+
+    LanguageC<Base> langC(_baseTypeName);
+    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setFunctionSplitByDependencies(_funcSplitByDeps);
+    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+    langC.setParameterPrecision(_parameterPrecision);
+    langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
+    langC.setGenerateFunction(_name + "_" + FUNCTION_REVERSE_ONE_MULTI);
+
+    std::ostringstream code;
+    std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("px"));
+    LangCDefaultHessianVarNameGenerator<Base> nameGenMulti(nameGen.get(), "py", n);
+
+    handler.generateCode(code, langC, px, nameGenMulti, _atomicFunctions, jobName);
+
+    _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
+
+    generateFunctionInfoValueSource(_name + "_" + FUNCTION_REVERSE_ONE_MULTI_DIRECTIONS, k);
+}
+
 } // END cg namespace
 } // END CppAD namespace
 
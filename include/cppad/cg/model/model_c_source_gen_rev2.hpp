@@ -28,7 +28,7 @@ void ModelCSourceGen<Base>::generateSparseReverseTwoSources() {
      * specified by the user according to the available elements in the sparsity
      */
     std::vector<size_t> evalRows, evalCols;
-    determineSecondOrderElements4Eval(evalRows, evalCols);
+    determineSecondOrderElements4Eval(evalRows, evalCols, true);
 
     // elements[var]{vars}
     std::map<size_t, std::vector<size_t> > elements;
@@ -88,6 +88,7 @@ void ModelCSourceGen<Base>::generateSparseReverseTwoSourcesWithAtomics(const std
 
         CodeHandler<Base> handler;
         handler.setJobTimer(_jobTimer);
+        handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
         vector<CGBase> tx0(n);
         handler.makeVariables(tx0);
@@ -128,8 +129,10 @@ void ModelCSourceGen<Base>::generateSparseReverseTwoSourcesWithAtomics(const std
 
         LanguageC<Base> langC(_baseTypeName);
         langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+        langC.setFunctionSplitByDependencies(_funcSplitByDeps);
         langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
         langC.setParameterPrecision(_parameterPrecision);
+        langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
         _cache.str("");
         _cache << _name << "_" << FUNCTION_SPARSE_REVERSE_TWO << "_indep" << j;
         langC.setGenerateFunction(_cache.str());
@@ -139,6 +142,9 @@ void ModelCSourceGen<Base>::generateSparseReverseTwoSourcesWithAtomics(const std
         LangCDefaultReverse2VarNameGenerator<Base> nameGenRev2(nameGen.get(), n, 1);
 
         handler.generateCode(code, langC, pxCustom, nameGenRev2, _atomicFunctions, subJobName);
+
+        _temporaryVariableCount[subJobName] = handler.getTemporaryVariableCount();
+        _functionOperationCount[langC.getGenerateFunction()] = handler.getOperationCount();
     }
 }
 
@@ -167,6 +173,7 @@ void ModelCSourceGen<Base>::generateSparseReverseTwoSourcesNoAtomics(const std::
     // we can use a new handler to reduce memory usage
     CodeHandler<Base> handler;
     handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
     vector<CGBase> tx0(n);
     handler.makeVariables(tx0);
@@ -231,8 +238,10 @@ void ModelCSourceGen<Base>::generateSparseReverseTwoSourcesNoAtomics(const std::
 
         LanguageC<Base> langC(_baseTypeName);
         langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+        langC.setFunctionSplitByDependencies(_funcSplitByDeps);
         langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
         langC.setParameterPrecision(_parameterPrecision);
+        langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
         _cache.str("");
         _cache << _name << "_" << FUNCTION_SPARSE_REVERSE_TWO << "_indep" << j;
         langC.setGenerateFunction(_cache.str());
@@ -242,6 +251,9 @@ void ModelCSourceGen<Base>::generateSparseReverseTwoSourcesNoAtomics(const std::
         LangCDefaultReverse2VarNameGenerator<Base> nameGenRev2(nameGen.get(), n, 1);
 
         handler.generateCode(code, langC, pxCustom, nameGenRev2, _atomicFunctions, subJobName);
+
+        _temporaryVariableCount[subJobName] = handler.getTemporaryVariableCount();
+        _functionOperationCount[langC.getGenerateFunction()] = handler.getOperationCount();
     }
 }
 
@@ -367,6 +379,93 @@ void ModelCSourceGen<Base>::generateReverseTwoSources() {
     _cache.str("");
 }
 
+/**
+ * Generates a function which computes Hessian-vector products.
+ *
+ * The generated function has three inputs:
+ *  - in[0]: the independent variables (x) with n elements
+ *  - in[1]: the multipliers (w) with m elements
+ *  - in[2]: the vectors (v), one after the other
+ * The output contains the products, one after the other.
+ */
+template<class Base>
+void ModelCSourceGen<Base>::generateHessianVectorProductSource() {
+    using std::vector;
+
+    const std::string jobName = "model (Hessian-vector product)";
+    const size_t m = _fun.Range();
+    const size_t n = _fun.Domain();
+    const size_t k = _hessianVectorProducts;
+
+    startingJob("'" + jobName + "'", JobTimer::GRAPH);
+
+    CodeHandler<Base> handler;
+    handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
+
+    // independent variables
+    vector<CGBase> indVars(n);
+    handler.makeVariables(indVars);
+    if (_x.size() > 0) {
+        for (size_t j = 0; j < n; j++) {
+            indVars[j].setValue(_x[j]);
+        }
+    }
+
+    // multipliers
+    vector<CGBase> w(m);
+    handler.makeVariables(w);
+    if (_x.size() > 0) {
+        for (size_t i = 0; i < m; i++) {
+            w[i].setValue(Base(1.0));
+        }
+    }
+
+    // vectors (one after the other)
+    vector<CGBase> v(n * k);
+    handler.makeVariables(v);
+    if (_x.size() > 0) {
+        for (size_t j = 0; j < v.size(); j++) {
+            v[j].setValue(Base(0));
+        }
+    }
+
+    // the zero order values are shared by all vectors
+    _fun.Forward(0, indVars);
+
+    vector<CGBase> hv(n * k);
+    vector<CGBase> dx(n);
+    for (size_t d = 0; d < k; d++) {
+        std::copy(v.begin() + d * n, v.begin() + (d + 1) * n, dx.begin());
+        _fun.Forward(1, dx);
+        vector<CGBase> px = _fun.Reverse(2, w);
+        for (size_t j = 0; j < n; j++) {
+            hv[d * n + j] = px[j * 2 + 1];
+        }
+    }
+
+    finishedJob();
+
+    LanguageC<Base> langC(_baseTypeName);
+    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setFunctionSplitByDependencies(_funcSplitByDeps);
+    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+    langC.setParameterPrecision(_parameterPrecision);
+    langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
+    langC.setGenerateFunction(_name + "_" + FUNCTION_HESSIAN_VECTOR_PRODUCT);
+
+    std::ostringstream code;
+    std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("hv"));
+    LangCDefaultHessianVarNameGenerator<Base> nameGenW(nameGen.get(), "w", n);
+    LangCDefaultHessianVarNameGenerator<Base> nameGenV(&nameGenW, "v", n + m);
+
+    handler.generateCode(code, langC, hv, nameGenV, _atomicFunctions, jobName);
+
+    _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
+
+    generateFunctionInfoValueSource(_name + "_" + FUNCTION_HESSIAN_VECTOR_PRODUCT_VECTORS, k);
+}
+
 } // END cg namespace
 } // END CppAD namespace
 
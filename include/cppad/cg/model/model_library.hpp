@@ -134,6 +134,110 @@ public:
      */
     virtual unsigned int getThreadPoolNumberOfTimeMeas() const = 0;
 
+    /**
+     * Defines how the threads used to determine sparse Jacobians and sparse
+     * Hessians for the models in this library are placed in the CPUs.
+     * Threads are bound to a CPU before they start working so that the
+     * memory they use (e.g. their stack) is allocated in the same NUMA node.
+     * This value is only used by the models if they were compiled with
+     * pthreads multithreading support.
+     * It should be defined before using the models.
+     *
+     * @param a the thread affinity strategy
+     */
+    virtual void setThreadPoolAffinity(ThreadPoolAffinity a) = 0;
+
+    /**
+     * Provides how the threads used to determine sparse Jacobians and sparse
+     * Hessians for the models in this library are placed in the CPUs.
+     *
+     * @return the thread affinity strategy
+     */
+    virtual ThreadPoolAffinity getThreadPoolAffinity() const = 0;
+
+    /**
+     * Defines the CPUs used by the threads when the affinity strategy is
+     * ThreadPoolAffinity::EXPLICIT.
+     * The i-th thread is bound to cpus[i % cpus.size()].
+     * It should be defined before using the models.
+     *
+     * @param cpus the CPU indexes
+     */
+    virtual void setThreadPoolAffinityCpus(const std::vector<int>& cpus) = 0;
+
+    /**
+     * Provides the CPUs used by the threads when the affinity strategy is
+     * ThreadPoolAffinity::EXPLICIT.
+     *
+     * @return the CPU indexes
+     */
+    virtual std::vector<int> getThreadPoolAffinityCpus() const = 0;
+
+    /**
+     * Defines for how long the threads used to determine sparse Jacobians
+     * and sparse Hessians busy wait for new work, and for how long the
+     * calling thread busy waits for the work to complete, before they are
+     * blocked.
+     * A short time (e.g. 50e-6 seconds) avoids the latency of blocking
+     * and waking up threads for models which are evaluated very quickly,
+     * but it should only be used when each thread has a dedicated CPU.
+     * This value is only used by the models if they were compiled with
+     * pthreads multithreading support.
+     *
+     * @param seconds the busy wait time (0 to always block immediately)
+     */
+    virtual void setThreadPoolSpinTime(float seconds) = 0;
+
+    /**
+     * Provides for how long the threads used to determine sparse Jacobians
+     * and sparse Hessians busy wait before they are blocked.
+     *
+     * @return the busy wait time in seconds
+     */
+    virtual float getThreadPoolSpinTime() const = 0;
+
+    /**
+     * Defines the minimum expected work of a multithreaded evaluation (e.g.
+     * of a sparse Jacobian) for its jobs to be distributed among the
+     * threads.
+     * The expected work is the sum of the reference execution times of the
+     * jobs of the evaluated function (see GenericModel::getThreadPoolProfile())
+     * and evaluations with less work are performed by the calling thread.
+     * The execution times continue to be measured while the number of time
+     * measurements (setThreadPoolNumberOfTimeMeas()) is not reached.
+     * This value is only used by the models if they were compiled with
+     * pthreads multithreading support.
+     *
+     * @param seconds the minimum expected work (0 to always use the
+     *                thread pool)
+     */
+    virtual void setThreadPoolSequentialThreshold(float seconds) = 0;
+
+    /**
+     * Provides the minimum expected work of a multithreaded evaluation for
+     * its jobs to be distributed among the threads.
+     *
+     * @return the minimum expected work in seconds
+     */
+    virtual float getThreadPoolSequentialThreshold() const = 0;
+
+    /**
+     * Defines a thread pool owned by the host application which is used to
+     * run the jobs of multithreaded model evaluations instead of the
+     * thread pool created by this library.
+     * The same executor can be used by several model libraries so that
+     * they all share the same worker threads.
+     * The executor callbacks (and its data) must remain valid while the
+     * models are used or until a different executor is defined.
+     * It should not be changed while models are being evaluated.
+     * This value is only used by the models if they were compiled with
+     * pthreads multithreading support.
+     *
+     * @param executor the host executor (its contents are copied) or
+     *                 nullptr to use the thread pool of the library
+     */
+    virtual void setThreadPoolExecutor(const CppADCGThPoolExecutor* executor) = 0;
+
     inline virtual ~ModelLibrary() {
     }
 
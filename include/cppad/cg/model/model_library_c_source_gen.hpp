@@ -41,6 +41,17 @@ public:
     static const std::string FUNCTION_GETTHREADPOOLGUIDEDMAXGROUPWORK;
     static const std::string FUNCTION_SETTHREADPOOLNUMBEROFTIMEMEAS;
     static const std::string FUNCTION_GETTHREADPOOLNUMBEROFTIMEMEAS;
+    static const std::string FUNCTION_SETTHREADPOOLEXECUTOR;
+    static const std::string FUNCTION_SETTHREADPOOLAFFINITY;
+    static const std::string FUNCTION_GETTHREADPOOLAFFINITY;
+    static const std::string FUNCTION_SETTHREADPOOLAFFINITYCPUS;
+    static const std::string FUNCTION_GETTHREADPOOLAFFINITYCPUS;
+    static const std::string FUNCTION_RUNTHREADPOOLJOBS;
+    static const std::string FUNCTION_SETTHREADPOOLSPINTIME;
+    static const std::string FUNCTION_GETTHREADPOOLSPINTIME;
+    static const std::string FUNCTION_SETTHREADPOOLSEQUENTIALTHRESHOLD;
+    static const std::string FUNCTION_GETTHREADPOOLSEQUENTIALTHRESHOLD;
+    static const std::string FUNCTION_ATOMIC_DIRECT;
     static const unsigned long API_VERSION;
 protected:
     static const std::string CONST;
@@ -63,6 +74,12 @@ protected:
      * Parallelization can be disabled locally for each model.
      */
     MultiThreadingType _multiThreading;
+    /**
+     * Whether or not models in this library which are used by other models
+     * in this library as atomic functions should be called directly
+     * instead of through the LangCAtomicFun function pointers.
+     */
+    bool _directAtomicCalls;
     /**
      * temporary stream to generate source code
      */
@@ -77,7 +94,8 @@ public:
      *              this object)
      */
     inline ModelLibraryCSourceGen(ModelCSourceGen<Base>& model):
-        _multiThreading(MultiThreadingType::NONE) {
+        _multiThreading(MultiThreadingType::NONE),
+        _directAtomicCalls(false) {
         CPPADCG_ASSERT_KNOWN(_models.find(model.getName()) == _models.end(),
                              "Another model with the same name was already registered");
 
@@ -158,6 +176,40 @@ public:
         _multiThreading = multiThreading;
     }
 
+    /**
+     * Whether or not models used by other models of this library (through
+     * addExternalModel() / asAtomic()) are called directly in the generated
+     * source code.
+     *
+     * @return true if calls between models in the same library are resolved
+     *         when the source code is generated
+     */
+    inline bool isDirectAtomicCalls() const {
+        return _directAtomicCalls;
+    }
+
+    /**
+     * Defines whether or not models used by other models of this library
+     * (through addExternalModel() / asAtomic()) are called directly in the
+     * generated source code.
+     * Direct calls avoid the LangCAtomicFun function pointers, the
+     * conversion of arrays in the runtime wrappers, and allow the C compiler
+     * to optimize across models.
+     * Only models which do not use atomic functions themselves can be called
+     * directly.
+     * The called model must still be registered in the calling model
+     * (addExternalModel()) since it is used for any derivative order which
+     * was not generated for the called model.
+     * This option must be defined before the source code for the models is
+     * generated.
+     *
+     * @param directCalls whether or not to resolve calls between models in
+     *                    the same library when the source code is generated
+     */
+    inline void setDirectAtomicCalls(bool directCalls) {
+        _directAtomicCalls = directCalls;
+    }
+
     /**
      * Saves the generated C source code into several files.
      * 
@@ -186,6 +238,26 @@ protected:
 
     virtual void generateThreadPoolSources(std::map<std::string, std::string>& sources);
 
+    /**
+     * Determines the models which can be called directly from other models
+     * in this library.
+     *
+     * @return maps model names to the prefix of the C functions used to
+     *         call them directly
+     */
+    virtual std::map<std::string, std::string> determineDirectAtomicCalls();
+
+    virtual void generateAtomicDirectCallSources(std::map<std::string, std::string>& sources);
+
+    /**
+     * Provides the sources of a model of this library generated with the
+     * options of this library (e.g. direct calls to other models).
+     *
+     * @param model the model
+     * @return the model sources
+     */
+    virtual const std::map<std::string, std::string>& getModelSources(ModelCSourceGen<Base>& model);
+
     static void saveSources(const std::string& sourcesFolder,
                             const std::map<std::string, std::string>& sources);
 
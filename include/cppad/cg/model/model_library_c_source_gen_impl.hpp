@@ -68,6 +68,39 @@ const std::string ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLNUMBEROFTI
 template<class Base>
 const std::string ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLNUMBEROFTIMEMEAS = "cppad_cg_thpool_get_number_of_time_meas";
 
+template<class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLEXECUTOR = "cppad_cg_thpool_set_executor";
+
+template<class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLAFFINITY = "cppad_cg_thpool_set_affinity";
+
+template<class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLAFFINITY = "cppad_cg_thpool_get_affinity";
+
+template<class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLAFFINITYCPUS = "cppad_cg_thpool_set_affinity_cpus";
+
+template<class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLAFFINITYCPUS = "cppad_cg_thpool_get_affinity_cpus";
+
+template<class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_RUNTHREADPOOLJOBS = "cppad_cg_thpool_run_jobs";
+
+template<class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLSPINTIME = "cppad_cg_thpool_set_spin_time";
+
+template<class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLSPINTIME = "cppad_cg_thpool_get_spin_time";
+
+template<class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLSEQUENTIALTHRESHOLD = "cppad_cg_thpool_set_sequential_threshold";
+
+template<class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLSEQUENTIALTHRESHOLD = "cppad_cg_thpool_get_sequential_threshold";
+
+template<class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_ATOMIC_DIRECT = "atomic_direct";
+
 template<class Base>
 const std::string ModelLibraryCSourceGen<Base>::CONST = "const";
 
@@ -79,7 +112,7 @@ void ModelLibraryCSourceGen<Base>::saveSources(const std::string& sourcesFolder)
 
     // save/generate model sources
     for (const auto& it : _models) {
-        saveSources(sourcesFolder, it.second->getSources());
+        saveSources(sourcesFolder, getModelSources(*it.second));
     }
 
     // save/generate library sources
@@ -110,10 +143,15 @@ const std::map<std::string, std::string>& ModelLibraryCSourceGen<Base>::getLibra
         generateOnCloseSource(_libSources);
         generateThreadPoolSources(_libSources);
 
+        if (_directAtomicCalls) {
+            generateAtomicDirectCallSources(_libSources);
+        }
+
         if(_multiThreading != MultiThreadingType::NONE) {
             bool usingMultiThreading = false;
             for (const auto& it : _models) {
-                if (it.second->isJacobianMultiThreadingEnabled() || it.second->isHessianMultiThreadingEnabled()) {
+                if (it.second->isJacobianMultiThreadingEnabled() || it.second->isHessianMultiThreadingEnabled() ||
+                    it.second->isLocalFunctionTasksEnabled()) {
                     usingMultiThreading = true;
                     break;
                 }
@@ -170,7 +208,8 @@ void ModelLibraryCSourceGen<Base>::generateOnCloseSource(std::map<std::string, s
     bool pthreads = false;
     if(_multiThreading == MultiThreadingType::PTHREADS) {
         for (const auto& it : _models) {
-            if (it.second->isJacobianMultiThreadingEnabled() || it.second->isHessianMultiThreadingEnabled()) {
+            if (it.second->isJacobianMultiThreadingEnabled() || it.second->isHessianMultiThreadingEnabled() ||
+                it.second->isLocalFunctionTasksEnabled()) {
                 pthreads = true;
                 break;
             }
@@ -196,7 +235,8 @@ void ModelLibraryCSourceGen<Base>::generateThreadPoolSources(std::map<std::strin
     bool usingMultiThreading = false;
     if(_multiThreading != MultiThreadingType::NONE) {
         for (const auto& it : _models) {
-            if (it.second->isJacobianMultiThreadingEnabled() || it.second->isHessianMultiThreadingEnabled()) {
+            if (it.second->isJacobianMultiThreadingEnabled() || it.second->isHessianMultiThreadingEnabled() ||
+                it.second->isLocalFunctionTasksEnabled()) {
                 usingMultiThreading = true;
                 break;
             }
@@ -255,12 +295,53 @@ void ModelLibraryCSourceGen<Base>::generateThreadPoolSources(std::map<std::strin
         _cache << "   return cppadcg_thpool_get_n_time_meas();\n";
         _cache << "}\n\n";
 
+        _cache << "void " << FUNCTION_SETTHREADPOOLEXECUTOR << "(const CppADCGThPoolExecutor* executor) {\n";
+        _cache << "   cppadcg_thpool_set_executor(executor);\n";
+        _cache << "}\n\n";
+
+        _cache << "void " << FUNCTION_SETTHREADPOOLAFFINITY << "(int a) {\n";
+        _cache << "   cppadcg_thpool_set_affinity((enum ThreadAffinity) a);\n";
+        _cache << "}\n\n";
+
+        _cache << "int " << FUNCTION_GETTHREADPOOLAFFINITY << "() {\n";
+        _cache << "   return (int) cppadcg_thpool_get_affinity();\n";
+        _cache << "}\n\n";
+
+        _cache << "void " << FUNCTION_SETTHREADPOOLAFFINITYCPUS << "(const int* cpus, int n) {\n";
+        _cache << "   cppadcg_thpool_set_affinity_cpus(cpus, n);\n";
+        _cache << "}\n\n";
+
+        _cache << "int " << FUNCTION_GETTHREADPOOLAFFINITYCPUS << "(int* cpus, int n) {\n";
+        _cache << "   return cppadcg_thpool_get_affinity_cpus(cpus, n);\n";
+        _cache << "}\n\n";
+
+        _cache << "void " << FUNCTION_RUNTHREADPOOLJOBS << "(void (*function)(void*), void** args, unsigned long n) {\n";
+        _cache << "void " << FUNCTION_SETTHREADPOOLSEQUENTIALTHRESHOLD << "(float seconds) {\n";
+        _cache << "   cppadcg_thpool_set_sequential_threshold(seconds);\n";
+        _cache << "}\n\n";
+
+        _cache << "float " << FUNCTION_GETTHREADPOOLSEQUENTIALTHRESHOLD << "() {\n";
+        _cache << "   return cppadcg_thpool_get_sequential_threshold();\n";
+        _cache << "}\n\n";
+
+        _cache << "void " << FUNCTION_SETTHREADPOOLSPINTIME << "(float seconds) {\n";
+        _cache << "   cppadcg_thpool_set_spin_time(seconds);\n";
+        _cache << "}\n\n";
+
+        _cache << "float " << FUNCTION_GETTHREADPOOLSPINTIME << "() {\n";
+        _cache << "   return cppadcg_thpool_get_spin_time();\n";
+        _cache << "}\n\n";
+
+        _cache << "   cppadcg_thpool_run_jobs(function, args, (int) n);\n";
+        _cache << "}\n\n";
+
         sources["thread_pool_access.c"] = _cache.str();
 
     } else if(usingMultiThreading && _multiThreading == MultiThreadingType::OPENMP) {
         _cache.str("");
         _cache << "#include <omp.h>\n";
         _cache << CPPADCG_OPENMP_H_FILE << "\n\n";
+        _cache << "struct CppADCGThPoolExecutor;\n\n";
 
         _cache << "void " << FUNCTION_SETTHREADPOOLDISABLED << "(int disabled) {\n";
         _cache << "   cppadcg_openmp_set_disabled(disabled);\n";
@@ -308,11 +389,53 @@ void ModelLibraryCSourceGen<Base>::generateThreadPoolSources(std::map<std::strin
         _cache << "   return 0;\n";
         _cache << "}\n\n";
 
+        _cache << "void " << FUNCTION_SETTHREADPOOLEXECUTOR << "(const struct CppADCGThPoolExecutor* executor) {\n";
+        _cache << "}\n\n";
+
+        _cache << "void " << FUNCTION_SETTHREADPOOLAFFINITY << "(int a) {\n";
+        _cache << "}\n\n";
+
+        _cache << "int " << FUNCTION_GETTHREADPOOLAFFINITY << "() {\n";
+        _cache << "   return 0;\n";
+        _cache << "}\n\n";
+
+        _cache << "void " << FUNCTION_SETTHREADPOOLAFFINITYCPUS << "(const int* cpus, int n) {\n";
+        _cache << "}\n\n";
+
+        _cache << "int " << FUNCTION_GETTHREADPOOLAFFINITYCPUS << "(int* cpus, int n) {\n";
+        _cache << "   return 0;\n";
+        _cache << "}\n\n";
+
+        _cache << "void " << FUNCTION_RUNTHREADPOOLJOBS << "(void (*function)(void*), void** args, unsigned long n) {\n";
+        _cache << "void " << FUNCTION_SETTHREADPOOLSEQUENTIALTHRESHOLD << "(float seconds) {\n";
+        _cache << "}\n\n";
+
+        _cache << "float " << FUNCTION_GETTHREADPOOLSEQUENTIALTHRESHOLD << "() {\n";
+        _cache << "   return 0;\n";
+        _cache << "}\n\n";
+
+        _cache << "void " << FUNCTION_SETTHREADPOOLSPINTIME << "(float seconds) {\n";
+        _cache << "}\n\n";
+
+        _cache << "float " << FUNCTION_GETTHREADPOOLSPINTIME << "() {\n";
+        _cache << "   return 0;\n";
+        _cache << "}\n\n";
+
+        _cache << "   long i;\n";
+        _cache << "   int enabled = !cppadcg_openmp_is_disabled();\n";
+        _cache << "#pragma omp parallel for schedule(dynamic, 1) if(enabled && n > 1) num_threads(cppadcg_openmp_get_threads())\n";
+        _cache << "   for (i = 0; i < (long) n; ++i) {\n";
+        _cache << "      (*function)(args[i]);\n";
+        _cache << "   }\n";
+        _cache << "}\n\n";
+
         sources["thread_pool_access.c"] = _cache.str();
 
     } else {
         _cache.str("");
         _cache << "enum ScheduleStrategy {SCHED_STATIC = 1, SCHED_DYNAMIC = 2, SCHED_GUIDED = 3};\n"
+                "\n"
+                "struct CppADCGThPoolExecutor;\n"
                 "\n";
         _cache << "void " << FUNCTION_SETTHREADPOOLDISABLED << "(int disabled) {\n";
         _cache << "}\n\n";
@@ -356,10 +479,217 @@ void ModelLibraryCSourceGen<Base>::generateThreadPoolSources(std::map<std::strin
         _cache << "   return 0;\n";
         _cache << "}\n\n";
 
+        _cache << "void " << FUNCTION_SETTHREADPOOLEXECUTOR << "(const struct CppADCGThPoolExecutor* executor) {\n";
+        _cache << "}\n\n";
+
+        _cache << "void " << FUNCTION_SETTHREADPOOLAFFINITY << "(int a) {\n";
+        _cache << "}\n\n";
+
+        _cache << "int " << FUNCTION_GETTHREADPOOLAFFINITY << "() {\n";
+        _cache << "   return 0;\n";
+        _cache << "}\n\n";
+
+        _cache << "void " << FUNCTION_SETTHREADPOOLAFFINITYCPUS << "(const int* cpus, int n) {\n";
+        _cache << "}\n\n";
+
+        _cache << "int " << FUNCTION_GETTHREADPOOLAFFINITYCPUS << "(int* cpus, int n) {\n";
+        _cache << "   return 0;\n";
+        _cache << "}\n\n";
+
+        _cache << "void " << FUNCTION_RUNTHREADPOOLJOBS << "(void (*function)(void*), void** args, unsigned long n) {\n";
+        _cache << "void " << FUNCTION_SETTHREADPOOLSEQUENTIALTHRESHOLD << "(float seconds) {\n";
+        _cache << "}\n\n";
+
+        _cache << "float " << FUNCTION_GETTHREADPOOLSEQUENTIALTHRESHOLD << "() {\n";
+        _cache << "   return 0;\n";
+        _cache << "}\n\n";
+
+        _cache << "void " << FUNCTION_SETTHREADPOOLSPINTIME << "(float seconds) {\n";
+        _cache << "}\n\n";
+
+        _cache << "float " << FUNCTION_GETTHREADPOOLSPINTIME << "() {\n";
+        _cache << "   return 0;\n";
+        _cache << "}\n\n";
+
+        _cache << "   unsigned long i;\n";
+        _cache << "   for (i = 0; i < n; ++i) {\n";
+        _cache << "      (*function)(args[i]);\n";
+        _cache << "   }\n";
+        _cache << "}\n\n";
+
         sources["thread_pool_access.c"] = _cache.str();
     }
 }
 
+template<class Base>
+std::map<std::string, std::string> ModelLibraryCSourceGen<Base>::determineDirectAtomicCalls() {
+    std::map<std::string, std::string> directCalls;
+    if (!_directAtomicCalls)
+        return directCalls;
+
+    for (const auto& it : _models) {
+        ModelCSourceGen<Base>& model = *it.second;
+        // the atomic functions of the called model could not be reached
+        if (!model.isAtomicsUsed()) {
+            directCalls[model.getName()] = model.getName() + "_" + FUNCTION_ATOMIC_DIRECT;
+        }
+    }
+
+    return directCalls;
+}
+
+template<class Base>
+const std::map<std::string, std::string>& ModelLibraryCSourceGen<Base>::getModelSources(ModelCSourceGen<Base>& model) {
+    if (model._sources.empty()) {
+        model._atomicDirectCalls = determineDirectAtomicCalls();
+    }
+    return model.getSources(_multiThreading, this);
+}
+
+template<class Base>
+void ModelLibraryCSourceGen<Base>::generateAtomicDirectCallSources(std::map<std::string, std::string>& sources) {
+    const std::map<std::string, std::string> directCalls = determineDirectAtomicCalls();
+
+    for (const auto& itCall : directCalls) {
+        ModelCSourceGen<Base>& model = *_models.at(itCall.first);
+        const std::string& modelName = model.getName();
+        const std::string& baseType = model._baseTypeName;
+        const std::string& prefix = itCall.second;
+        size_t m = model._fun.Range();
+        size_t n = model._fun.Domain();
+
+        LanguageC<Base> langC(baseType);
+        std::string argsDcl = langC.generateDefaultFunctionArgumentsDcl();
+
+        _cache.str("");
+        _cache << LanguageC<Base>::ATOMICFUN_STRUCT_DEFINITION << "\n\n";
+
+        /**
+         * declarations of the functions of the called model
+         */
+        if (model._zero) {
+            _cache << "void " << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_FORWAD_ZERO << "(" << argsDcl << ");\n";
+        }
+        if (model._forwardOne) {
+            _cache << "int " << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_SPARSE_FORWARD_ONE << "(unsigned long pos, " << argsDcl << ");\n"
+                    "void " << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_FORWARD_ONE_SPARSITY << "(unsigned long pos, unsigned long const** elements, unsigned long* nnz);\n";
+        }
+        if (model._reverseOne) {
+            _cache << "int " << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_SPARSE_REVERSE_ONE << "(unsigned long pos, " << argsDcl << ");\n"
+                    "void " << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_REVERSE_ONE_SPARSITY << "(unsigned long pos, unsigned long const** elements, unsigned long* nnz);\n";
+        }
+        if (model._reverseTwo) {
+            _cache << "int " << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_SPARSE_REVERSE_TWO << "(unsigned long pos, " << argsDcl << ");\n"
+                    "void " << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_REVERSE_TWO_SPARSITY << "(unsigned long pos, unsigned long const** elements, unsigned long* nnz);\n";
+        }
+        _cache << "\n";
+
+        /**
+         * forward mode
+         *  (the called model does not use atomic functions, thus the
+         *   atomicFun argument is just passed along)
+         */
+        _cache << "int " << prefix << "_forward(struct LangCAtomicFun atomicFun, int atomicIndex, int q, int p, const Array tx[], Array* ty) {\n";
+        if (model._zero || model._forwardOne) {
+            _cache << "   " << baseType << " const* in[2];\n"
+                    "   " << baseType << "* out[1];\n";
+        }
+        if (model._forwardOne) {
+            _cache << "   " << baseType << " compressed[" << std::max<size_t>(m, 1) << "];\n"
+                    "   " << baseType << "* y;\n"
+                    "   const " << baseType << "* tx1;\n"
+                    "   unsigned long const* pos;\n"
+                    "   unsigned long nnz, e, ePos, i;\n";
+        }
+        _cache << "\n";
+        if (model._zero) {
+            _cache << "   if (p == 0 && !tx[0].sparse && !ty->sparse) {\n"
+                    "      in[0] = (" << baseType << " const*) tx[0].data;\n"
+                    "      out[0] = (" << baseType << "*) ty->data;\n"
+                    "      " << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_FORWAD_ZERO << "(in, out, atomicFun);\n"
+                    "      return 1;\n"
+                    "   }\n";
+        }
+        if (model._forwardOne) {
+            _cache << "   if (p == 1 && !tx[0].sparse && tx[1].sparse && !ty->sparse) {\n"
+                    "      y = (" << baseType << "*) ty->data;\n"
+                    "      tx1 = (const " << baseType << "*) tx[1].data;\n"
+                    "      for (i = 0; i < " << m << "; i++) y[i] = 0;\n"
+                    "      in[0] = (" << baseType << " const*) tx[0].data;\n"
+                    "      out[0] = compressed;\n"
+                    "      for (e = 0; e < tx[1].nnz; e++) {\n"
+                    "         " << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_FORWARD_ONE_SPARSITY << "(tx[1].idx[e], &pos, &nnz);\n"
+                    "         if (nnz == 0) continue;\n"
+                    "         in[1] = &tx1[e];\n"
+                    "         if (" << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_SPARSE_FORWARD_ONE << "(tx[1].idx[e], in, out, atomicFun) != 0) return 0;\n"
+                    "         for (ePos = 0; ePos < nnz; ePos++) y[pos[ePos]] += compressed[ePos];\n"
+                    "      }\n"
+                    "      return 1;\n"
+                    "   }\n";
+        }
+        _cache << "\n"
+                "   // not available in the library\n"
+                "   return (*atomicFun.forward)(atomicFun.libModel, atomicIndex, q, p, tx, ty);\n"
+                "}\n\n";
+
+        /**
+         * reverse mode
+         */
+        _cache << "int " << prefix << "_reverse(struct LangCAtomicFun atomicFun, int atomicIndex, int p, const Array tx[], Array* px, const Array py[]) {\n";
+        if (model._reverseOne || model._reverseTwo) {
+            _cache << "   " << baseType << " const* in[3];\n"
+                    "   " << baseType << "* out[1];\n"
+                    "   " << baseType << " compressed[" << std::max<size_t>(n, 1) << "];\n"
+                    "   " << baseType << "* pxb;\n"
+                    "   const " << baseType << "* v;\n"
+                    "   unsigned long const* pos;\n"
+                    "   unsigned long nnz, e, ePos, j;\n"
+                    "\n";
+        }
+        if (model._reverseOne) {
+            _cache << "   if (p == 0 && !tx[0].sparse && py[0].sparse && !px->sparse) {\n"
+                    "      pxb = (" << baseType << "*) px->data;\n"
+                    "      v = (const " << baseType << "*) py[0].data;\n"
+                    "      for (j = 0; j < " << n << "; j++) pxb[j] = 0;\n"
+                    "      in[0] = (" << baseType << " const*) tx[0].data;\n"
+                    "      out[0] = compressed;\n"
+                    "      for (e = 0; e < py[0].nnz; e++) {\n"
+                    "         " << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_REVERSE_ONE_SPARSITY << "(py[0].idx[e], &pos, &nnz);\n"
+                    "         if (nnz == 0) continue;\n"
+                    "         in[1] = &v[e];\n"
+                    "         if (" << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_SPARSE_REVERSE_ONE << "(py[0].idx[e], in, out, atomicFun) != 0) return 0;\n"
+                    "         for (ePos = 0; ePos < nnz; ePos++) pxb[pos[ePos]] += compressed[ePos];\n"
+                    "      }\n"
+                    "      return 1;\n"
+                    "   }\n";
+        }
+        if (model._reverseTwo) {
+            _cache << "   if (p == 1 && !tx[0].sparse && tx[1].sparse && py[0].sparse && py[0].nnz == 0 && !py[1].sparse && !px->sparse) {\n"
+                    "      pxb = (" << baseType << "*) px->data;\n"
+                    "      v = (const " << baseType << "*) tx[1].data;\n"
+                    "      for (j = 0; j < " << n << "; j++) pxb[j] = 0;\n"
+                    "      in[0] = (" << baseType << " const*) tx[0].data;\n"
+                    "      in[2] = (" << baseType << " const*) py[1].data;\n"
+                    "      out[0] = compressed;\n"
+                    "      for (e = 0; e < tx[1].nnz; e++) {\n"
+                    "         " << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_REVERSE_TWO_SPARSITY << "(tx[1].idx[e], &pos, &nnz);\n"
+                    "         if (nnz == 0) continue;\n"
+                    "         in[1] = &v[e];\n"
+                    "         if (" << modelName << "_" << ModelCSourceGen<Base>::FUNCTION_SPARSE_REVERSE_TWO << "(tx[1].idx[e], in, out, atomicFun) != 0) return 0;\n"
+                    "         for (ePos = 0; ePos < nnz; ePos++) pxb[pos[ePos]] += compressed[ePos];\n"
+                    "      }\n"
+                    "      return 1;\n"
+                    "   }\n";
+        }
+        _cache << "\n"
+                "   // not available in the library\n"
+                "   return (*atomicFun.reverse)(atomicFun.libModel, atomicIndex, p, tx, px, py);\n"
+                "}\n\n";
+
+        sources[prefix + ".c"] = _cache.str();
+    }
+}
+
 } // END cg namespace
 } // END CppAD namespace
 
@@ -32,6 +32,7 @@ void ModelCSourceGen<Base>::prepareSparseForwardOneWithLoops(const std::map<size
     
     CodeHandler<Base> handler;
     handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
     handler.setZeroDependents(false);
 
     auto& indexJcolDcl = *handler.makeIndexDclrNode("jcol");
@@ -347,6 +348,7 @@ void ModelCSourceGen<Base>::prepareSparseForwardOneWithLoops(const std::map<size
             LanguageC<Base> langC(_baseTypeName);
             langC.setFunctionIndexArgument(indexJcolDcl);
             langC.setParameterPrecision(_parameterPrecision);
+            langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
 
             _cache.str("");
             std::ostringstream code;
@@ -360,6 +362,7 @@ void ModelCSourceGen<Base>::prepareSparseForwardOneWithLoops(const std::map<size
             _cache << "model (forward one, loop " << lModel.getLoopId() << ", group " << g << ")";
             string jobName = _cache.str();
             handler.generateCode(code, langC, pxCustom, nameGenHess, _atomicFunctions, jobName);
+            _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
 
             _cache.str("");
             generateFunctionNameLoopFor1(_cache, lModel, g);
@@ -430,7 +433,9 @@ void ModelCSourceGen<Base>::createForwardOneWithLoopsNL(CodeHandler<Base>& handl
 
     LanguageC<Base> langC(_baseTypeName);
     langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setFunctionSplitByDependencies(_funcSplitByDeps);
     langC.setParameterPrecision(_parameterPrecision);
+    langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
     _cache.str("");
     _cache << _name << "_" << FUNCTION_SPARSE_FORWARD_ONE << "_noloop_indep" << j;
     langC.setGenerateFunction(_cache.str());
@@ -441,6 +446,8 @@ void ModelCSourceGen<Base>::createForwardOneWithLoopsNL(CodeHandler<Base>& handl
 
     handler.generateCode(code, langC, jacCol, nameGenHess, _atomicFunctions, jobName);
 
+    _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
+
     handler.resetNodes();
 }
 
@@ -38,6 +38,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseOneWithLoops(const std::map<size
 
     CodeHandler<Base> handler;
     handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
     handler.setZeroDependents(false);
 
     auto& indexJrowDcl = *handler.makeIndexDclrNode("jrow");
@@ -282,6 +283,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseOneWithLoops(const std::map<size
             LanguageC<Base> langC(_baseTypeName);
             langC.setFunctionIndexArgument(indexJrowDcl);
             langC.setParameterPrecision(_parameterPrecision);
+            langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
 
             _cache.str("");
             std::ostringstream code;
@@ -295,6 +297,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseOneWithLoops(const std::map<size
             _cache << "model (reverse one, loop " << lModel.getLoopId() << ", group " << tapeI << ")";
             string jobName = _cache.str();
             handler.generateCode(code, langC, pxCustom, nameGenHess, _atomicFunctions, jobName);
+            _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
 
             _cache.str("");
             generateFunctionNameLoopRev1(_cache, lModel, tapeI);
@@ -365,7 +368,9 @@ void ModelCSourceGen<Base>::createReverseOneWithLoopsNL(CodeHandler<Base>& handl
 
     LanguageC<Base> langC(_baseTypeName);
     langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setFunctionSplitByDependencies(_funcSplitByDeps);
     langC.setParameterPrecision(_parameterPrecision);
+    langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
     _cache.str("");
     _cache << _name << "_" << FUNCTION_SPARSE_REVERSE_ONE << "_noloop_dep" << i;
     langC.setGenerateFunction(_cache.str());
@@ -376,6 +381,8 @@ void ModelCSourceGen<Base>::createReverseOneWithLoopsNL(CodeHandler<Base>& handl
 
     handler.generateCode(code, langC, jacRow, nameGenHess, _atomicFunctions, jobName);
 
+    _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
+
     handler.resetNodes();
 }
 
@@ -68,6 +68,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseTwoWithLoops(const std::map<size
     
     CodeHandler<Base> handler;
     handler.setJobTimer(_jobTimer);
+    handler.setMinimizeLiveTemporaries(_minimizeLiveTemps);
     handler.setZeroDependents(false);
     
     auto& indexJrowDcl = *handler.makeIndexDclrNode("jrow");
@@ -383,6 +384,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseTwoWithLoops(const std::map<size
             LanguageC<Base> langC(_baseTypeName);
             langC.setFunctionIndexArgument(indexJrowDcl);
             langC.setParameterPrecision(_parameterPrecision);
+            langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
 
             std::ostringstream code;
             std::unique_ptr<VariableNameGenerator<Base> > nameGen(createVariableNameGenerator("px"));
@@ -395,6 +397,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseTwoWithLoops(const std::map<size
             _cache << "model (reverse two, loop " << lModel.getLoopId() << ", group " << g << ")";
             string jobName = _cache.str();
             handler.generateCode(code, langC, pxCustom, nameGenRev2, _atomicFunctions, jobName);
+            _temporaryVariableCount[jobName] = handler.getTemporaryVariableCount();
 
             _cache.str("");
             generateFunctionNameLoopRev2(_cache, lModel, g);
@@ -455,6 +458,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseTwoWithLoops(const std::map<size
             // we can use a new handler to reduce memory usage
             CodeHandler<Base> handlerNL;
             handlerNL.setJobTimer(_jobTimer);
+            handlerNL.setMinimizeLiveTemporaries(_minimizeLiveTemps);
 
             std::vector<CGBase> tx0(n);
             handlerNL.makeVariables(tx0);
@@ -524,8 +528,10 @@ void ModelCSourceGen<Base>::prepareSparseReverseTwoWithLoops(const std::map<size
 
                 LanguageC<Base> langC(_baseTypeName);
                 langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+                langC.setFunctionSplitByDependencies(_funcSplitByDeps);
                 langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
                 langC.setParameterPrecision(_parameterPrecision);
+                langC.setAtomicFunctionDirectCalls(_atomicDirectCalls);
                 _cache.str("");
                 _cache << _name << "_" << FUNCTION_SPARSE_REVERSE_TWO << "_noloop_indep" << j;
                 string functionName = _cache.str();
@@ -536,6 +542,8 @@ void ModelCSourceGen<Base>::prepareSparseReverseTwoWithLoops(const std::map<size
                 LangCDefaultReverse2VarNameGenerator<Base> nameGenRev2(nameGen.get(), n, 1);
 
                 handlerNL.generateCode(code, langC, pxCustom, nameGenRev2, _atomicFunctions, subJobName);
+
+                _temporaryVariableCount[subJobName] = handlerNL.getTemporaryVariableCount();
             }
 
             finishedJob();
@@ -0,0 +1,328 @@
+#ifndef CPPAD_CG_SPARSITY_CACHE_INCLUDED
+#define CPPAD_CG_SPARSITY_CACHE_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * The Jacobian and Hessian sparsity patterns determined for a model tape
+ * which can be saved to a file and used again when source code is
+ * generated for the same tape (e.g. after changing options such as the
+ * Jacobian mode or the multithreading type).
+ *
+ * The patterns are stored in a compact binary format (delta encoded
+ * variable length integers) together with a fingerprint of the tape
+ * (see tapeFingerprint()).
+ */
+class SparsityCache {
+public:
+    using SparsitySetType = std::vector<std::set<size_t> >;
+public:
+    /// identifies the tape used to determine the sparsity patterns
+    uint64_t fingerprint = 0;
+    /// number of independent variables
+    size_t domain = 0;
+    /// number of dependent variables
+    size_t range = 0;
+    /// whether or not the Jacobian sparsity is available
+    bool hasJacobian = false;
+    SparsitySetType jacobian;
+    /// whether or not the sparsity for the sum of the Hessians is available
+    bool hasHessian = false;
+    SparsitySetType hessian;
+    /// whether or not the Hessian sparsity of each equation is available
+    bool hasHessians = false;
+    std::vector<SparsitySetType> hessians;
+public:
+
+    /**
+     * Discards all the sparsity patterns and defines a new tape.
+     */
+    inline void reset(uint64_t fingerprint,
+                      size_t domain,
+                      size_t range) {
+        this->fingerprint = fingerprint;
+        this->domain = domain;
+        this->range = range;
+        hasJacobian = false;
+        jacobian.clear();
+        hasHessian = false;
+        hessian.clear();
+        hasHessians = false;
+        hessians.clear();
+    }
+
+    /**
+     * Whether or not this cache was created for a given tape.
+     */
+    inline bool matches(uint64_t fingerprint,
+                        size_t domain,
+                        size_t range) const {
+        return this->fingerprint == fingerprint && this->domain == domain && this->range == range;
+    }
+
+    /**
+     * Saves the sparsity patterns using a binary format.
+     *
+     * @param out the output stream
+     */
+    inline void write(std::ostream& out) const {
+        out.write("cppadcgsp", 9);
+        writeNumber(out, 1); // version
+        writeNumber(out, fingerprint);
+        writeNumber(out, domain);
+        writeNumber(out, range);
+        writeNumber(out, (hasJacobian ? 1 : 0) | (hasHessian ? 2 : 0) | (hasHessians ? 4 : 0));
+
+        if (hasJacobian)
+            writeSparsity(out, jacobian);
+        if (hasHessian)
+            writeSparsity(out, hessian);
+        if (hasHessians) {
+            writeNumber(out, hessians.size());
+            for (const SparsitySetType& h : hessians)
+                writeSparsity(out, h);
+        }
+    }
+
+    /**
+     * Loads the sparsity patterns saved with write().
+     * The tape of the saved patterns is validated before any pattern is
+     * read so that the dimensions in the stream are never used to
+     * allocate memory.
+     *
+     * @param in the input stream
+     * @param fingerprint the fingerprint of the expected tape
+     * @param domain the number of independent variables of the expected tape
+     * @param range the number of dependent variables of the expected tape
+     * @throws CGException if the sparsity patterns could not be read or
+     *                     if they were created for a different tape
+     */
+    inline void read(std::istream& in,
+                     uint64_t fingerprint,
+                     size_t domain,
+                     size_t range) {
+        char header[9];
+        in.read(header, 9);
+        if (!in || std::string(header, 9) != "cppadcgsp" || readNumber(in) != 1) {
+            throw CGException("Invalid sparsity cache");
+        }
+
+        SparsityCache c;
+        c.fingerprint = readNumber(in);
+        c.domain = readNumber(in);
+        c.range = readNumber(in);
+        if (!c.matches(fingerprint, domain, range)) {
+            throw CGException("The sparsity cache was created for a different tape");
+        }
+        uint64_t flags = readNumber(in);
+
+        c.hasJacobian = (flags & 1) != 0;
+        if (c.hasJacobian)
+            readSparsity(in, c.jacobian, c.range, c.domain);
+        c.hasHessian = (flags & 2) != 0;
+        if (c.hasHessian)
+            readSparsity(in, c.hessian, c.domain, c.domain);
+        c.hasHessians = (flags & 4) != 0;
+        if (c.hasHessians) {
+            if (readNumber(in) != c.range) {
+                throw CGException("Invalid number of Hessians in the sparsity cache");
+            }
+            c.hessians.resize(c.range);
+            for (SparsitySetType& h : c.hessians)
+                readSparsity(in, h, c.domain, c.domain);
+        }
+
+        if (!in) {
+            throw CGException("Failed to read the sparsity cache");
+        }
+
+        *this = std::move(c);
+    }
+
+    /**
+     * Saves the sparsity patterns to a file.
+     *
+     * @param fileName the file path
+     * @throws CGException if the file could not be written
+     */
+    inline void save(const std::string& fileName) const {
+        std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+        write(out);
+        out.close();
+        if (!out) {
+            throw CGException("Failed to save the sparsity cache to '", fileName, "'");
+        }
+    }
+
+    /**
+     * Loads the sparsity patterns from a file.
+     *
+     * @param fileName the file path
+     * @param fingerprint the fingerprint of the expected tape
+     * @param domain the number of independent variables of the expected tape
+     * @param range the number of dependent variables of the expected tape
+     * @return false if the file does not exist
+     * @throws CGException if the file is not a valid sparsity cache for
+     *                     the expected tape
+     */
+    inline bool load(const std::string& fileName,
+                     uint64_t fingerprint,
+                     size_t domain,
+                     size_t range) {
+        std::ifstream in(fileName, std::ios::binary);
+        if (!in.is_open()) {
+            return false;
+        }
+        read(in, fingerprint, domain, range);
+        return true;
+    }
+
+private:
+
+    static inline void writeNumber(std::ostream& out,
+                                   uint64_t v) {
+        while (v >= 0x80) {
+            out.put(char((v & 0x7F) | 0x80));
+            v >>= 7;
+        }
+        out.put(char(v));
+    }
+
+    static inline uint64_t readNumber(std::istream& in) {
+        uint64_t v = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            int c = in.get();
+            if (c == std::char_traits<char>::eof()) {
+                throw CGException("Unexpected end of the sparsity cache");
+            }
+            v |= uint64_t(c & 0x7F) << shift;
+            if ((c & 0x80) == 0)
+                return v;
+        }
+        throw CGException("Invalid number in the sparsity cache");
+    }
+
+    static inline void writeSparsity(std::ostream& out,
+                                     const SparsitySetType& sparsity) {
+        writeNumber(out, sparsity.size());
+        for (const std::set<size_t>& row : sparsity) {
+            writeNumber(out, row.size());
+            size_t last = 0;
+            for (size_t j : row) {
+                writeNumber(out, j - last); // elements are sorted
+                last = j;
+            }
+        }
+    }
+
+    static inline void readSparsity(std::istream& in,
+                                    SparsitySetType& sparsity,
+                                    size_t nRows,
+                                    size_t nCols) {
+        if (readNumber(in) != nRows) {
+            throw CGException("Invalid number of rows in the sparsity cache");
+        }
+        sparsity.resize(nRows);
+        for (std::set<size_t>& row : sparsity) {
+            size_t nnz = readNumber(in);
+            size_t j = 0;
+            for (size_t e = 0; e < nnz; ++e) {
+                j += readNumber(in);
+                if (j >= nCols) {
+                    throw CGException("Invalid column index in the sparsity cache");
+                }
+                row.insert(row.end(), j);
+            }
+        }
+    }
+};
+
+/**
+ * Determines a fingerprint of a model tape which changes when the
+ * operations of the model change.
+ * The operation graph of the model is recorded and hashed, including the
+ * values of the constants.
+ * Changes inside atomic functions are not detected.
+ *
+ * @param fun the model tape
+ * @return the fingerprint (a 64-bit FNV-1a hash)
+ */
+template<class Base>
+inline uint64_t tapeFingerprint(ADFun<CG<Base> >& fun) {
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](uint64_t v) {
+        for (size_t b = 0; b < 8; ++b) {
+            hash ^= (v >> (8 * b)) & 0xFF;
+            hash *= 1099511628211ull;
+        }
+    };
+
+    std::ostringstream value;
+    value << std::setprecision(std::numeric_limits<Base>::max_digits10);
+    auto mixParameter = [&](const Base& p) {
+        value.str("");
+        value << p;
+        for (char c : value.str())
+            mix(uint64_t(c));
+    };
+
+    size_t n = fun.Domain();
+    size_t m = fun.Range();
+    mix(n);
+    mix(m);
+
+    CodeHandler<Base> handler;
+    std::vector<CG<Base> > x(n);
+    handler.makeVariables(x);
+
+    std::vector<CG<Base> > y = fun.Forward(0, x);
+
+    for (const OperationNode<Base>* node : handler.getManagedNodes()) {
+        mix(size_t(node->getOperationType()));
+
+        mix(node->getInfo().size());
+        for (size_t i : node->getInfo())
+            mix(i);
+
+        mix(node->getArguments().size());
+        for (const Argument<Base>& a : node->getArguments()) {
+            if (a.getOperation() != nullptr) {
+                mix(a.getOperation()->getHandlerPosition());
+            } else {
+                mix(uint64_t(-1));
+                mixParameter(*a.getParameter());
+            }
+        }
+    }
+
+    for (const CG<Base>& yi : y) {
+        if (yi.getOperationNode() != nullptr) {
+            mix(yi.getOperationNode()->getHandlerPosition());
+        } else {
+            mix(uint64_t(-1));
+            mixParameter(yi.getValue());
+        }
+    }
+
+    return hash;
+}
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef CPPAD_CG_STATIC_LIB_INCLUDED
+#define CPPAD_CG_STATIC_LIB_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Provides access to the models of a library which was linked into the
+ * current executable, either as a static library or by compiling its
+ * sources together with the application (see StaticModelLibraryProcessor).
+ *
+ * The functions are obtained from a registration table generated together
+ * with the model sources and therefore no dlopen/dlsym is required.
+ *
+ * Usage example:
+ * @code
+ * #include "cppad_cg_functions.h"
+ *
+ * StaticLib<double> lib(&cppad_cg_functions);
+ * std::unique_ptr<GenericModel<double>> model = lib.model("model");
+ * @endcode
+ */
+template<class Base>
+class StaticLib : public FunctorModelLibrary<Base> {
+public:
+    /**
+     * The type of the generated registration function which provides the
+     * names of all available functions and the respective function pointers.
+     */
+    using RegistryFunction = void (*)(char const* const** names,
+                                      void (* const** functions)(),
+                                      unsigned long* n);
+protected:
+    /// the functions in the library (by name)
+    std::map<std::string, void*> _functions;
+    std::set<StaticLibModel<Base>*> _models;
+public:
+
+    /**
+     * Creates a new model library object.
+     *
+     * @param registry The registration function generated for the library
+     */
+    explicit StaticLib(RegistryFunction registry) {
+        CPPADCG_ASSERT_KNOWN(registry != nullptr, "Invalid registration function for a static model library");
+
+        char const* const* names = nullptr;
+        void (* const* functions)() = nullptr;
+        unsigned long n = 0;
+        (*registry)(&names, &functions, &n);
+
+        for (unsigned long i = 0; i < n; i++) {
+            _functions[names[i]] = reinterpret_cast<void*> (functions[i]);
+        }
+
+        // validate the library
+        this->validate();
+    }
+
+    StaticLib(const StaticLib&) = delete;
+    StaticLib& operator=(const StaticLib&) = delete;
+
+    virtual std::unique_ptr<StaticLibModel<Base>> modelStatic(const std::string& modelName) {
+        std::unique_ptr<StaticLibModel<Base>> m;
+        std::set<std::string>::const_iterator it = this->_modelNames.find(modelName);
+        if (it == this->_modelNames.end()) {
+            return m;
+        }
+        m.reset(new StaticLibModel<Base> (this, modelName));
+        _models.insert(m.get());
+        return m;
+    }
+
+    std::unique_ptr<FunctorGenericModel<Base>> modelFunctor(const std::string& modelName) override final {
+        return std::unique_ptr<FunctorGenericModel<Base>>(modelStatic(modelName).release());
+    }
+
+    void* loadFunction(const std::string& functionName, bool required = true) override {
+        auto it = _functions.find(functionName);
+        if (it == _functions.end()) {
+            if (required)
+                throw CGException("Failed to load function '", functionName, "': not registered in the static model library");
+            return nullptr;
+        }
+
+        return it->second;
+    }
+
+    virtual ~StaticLib() {
+        for (StaticLibModel<Base>* model : _models) {
+            model->modelLibraryClosed();
+        }
+
+        if (this->_onClose != nullptr) {
+            (*this->_onClose)();
+        }
+    }
+
+protected:
+
+    virtual void destroyed(StaticLibModel<Base>* model) {
+        _models.erase(model);
+    }
+
+    friend class StaticLibModel<Base>;
+
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef CPPAD_CG_STATIC_LIB_MODEL_INCLUDED
+#define CPPAD_CG_STATIC_LIB_MODEL_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Useful class to call a compiled model which was linked into the current
+ * executable (see StaticLib).
+ */
+template<class Base>
+class StaticLibModel : public FunctorGenericModel<Base> {
+protected:
+    /// the static library
+    StaticLib<Base>* _staticLib;
+
+public:
+
+    virtual ~StaticLibModel() {
+        if (_staticLib != nullptr) {
+            _staticLib->destroyed(this);
+        }
+    }
+
+protected:
+
+    /**
+     * Creates a new model
+     *
+     * @param name The model name
+     */
+    StaticLibModel(StaticLib<Base>* staticLib, const std::string& name) :
+        FunctorGenericModel<Base>(name),
+        _staticLib(staticLib) {
+
+        CPPADCG_ASSERT_UNKNOWN(_staticLib != nullptr);
+
+        this->init();
+    }
+
+    StaticLibModel(const StaticLibModel&) = delete;
+    StaticLibModel& operator=(const StaticLibModel&) = delete;
+
+    void* loadFunction(const std::string& functionName, bool required = true) override {
+        return _staticLib->loadFunction(functionName, required);
+    }
+
+    void modelLibraryClosed() override {
+        _staticLib = nullptr;
+        FunctorGenericModel<Base>::modelLibraryClosed();
+    }
+
+    friend class StaticLib<Base>;
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
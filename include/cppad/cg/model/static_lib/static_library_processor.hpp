@@ -0,0 +1,419 @@
+#ifndef CPPAD_CG_STATIC_LIBRARY_PROCESSOR_INCLUDED
+#define CPPAD_CG_STATIC_LIBRARY_PROCESSOR_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Creates a model library which is meant to be linked directly into an
+ * application (no dlopen/dlsym).
+ *
+ * Besides the usual model and library sources, a registration function is
+ * generated which provides the pointers to all the functions in the library.
+ * This function is declared in a generated C header and must be provided to
+ * a StaticLib object in order to evaluate the models.
+ *
+ * The sources can either be compiled into a static library
+ * (createStaticLibrary()) or saved to a folder (saveSourcesTo()) so that
+ * they can be compiled by the application's own build system (e.g. using
+ * link time optimization across the models and the caller).
+ *
+ * The library level functions (e.g. cppad_cg_version) do not depend on the
+ * library name, thus only one of these libraries can be linked into the
+ * same executable. Several models can be placed in the same library.
+ */
+template<class Base>
+class StaticModelLibraryProcessor : public ModelLibraryProcessor<Base> {
+protected:
+    /**
+     * the path of the static library to be created
+     */
+    std::string _libraryName;
+    /**
+     * the name of the generated registration function
+     */
+    std::string _registryName;
+    /**
+     * the source code of the registration function
+     */
+    std::map<std::string, std::string> _registrySources;
+public:
+
+    /**
+     * Creates a new helper class for the generation of model libraries
+     * which are linked into the application.
+     *
+     * @param modelLibGen
+     * @param libraryName The path of the static library to be created
+     *                    (without the extension)
+     * @param registryName The name of the generated registration function
+     *                     (also used for the header file name)
+     */
+    inline StaticModelLibraryProcessor(ModelLibraryCSourceGen<Base>& modelLibGen,
+                                       const std::string& libraryName = "cppad_cg_model",
+                                       const std::string& registryName = "cppad_cg_functions") :
+        ModelLibraryProcessor<Base>(modelLibGen),
+        _libraryName(libraryName),
+        _registryName(registryName) {
+    }
+
+    inline virtual ~StaticModelLibraryProcessor() = default;
+
+    inline const std::string& getLibraryName() const {
+        return _libraryName;
+    }
+
+    inline void setLibraryName(const std::string& libraryName) {
+        CPPADCG_ASSERT_KNOWN(!libraryName.empty(), "Library name cannot be empty");
+
+        _libraryName = libraryName;
+    }
+
+    inline const std::string& getRegistryName() const {
+        return _registryName;
+    }
+
+    /**
+     * Defines the name of the generated registration function.
+     *
+     * @param registryName a valid C function name
+     */
+    inline void setRegistryName(const std::string& registryName) {
+        CPPADCG_ASSERT_KNOWN(!registryName.empty(), "Registration function name cannot be empty");
+
+        _registryName = registryName;
+        _registrySources.clear();
+    }
+
+    /**
+     * Provides the source code of the registration function.
+     */
+    inline const std::map<std::string, std::string>& getRegistrySources() {
+        if (_registrySources.empty()) {
+            generateRegistrySource(_registrySources);
+        }
+        return _registrySources;
+    }
+
+    /**
+     * Provides the C header file content with the declaration of the
+     * registration function.
+     */
+    inline std::string getRegistryHeader() const {
+        std::string guard = _registryName + "_h_included";
+
+        std::ostringstream out;
+        out << "#ifndef " << guard << "\n"
+                "#define " << guard << "\n"
+                "\n"
+                "#ifdef __cplusplus\n"
+                "extern \"C\" {\n"
+                "#endif\n"
+                "\n";
+        printRegistryDeclaration(out);
+        out << ";\n"
+                "\n"
+                "#ifdef __cplusplus\n"
+                "}\n"
+                "#endif\n"
+                "\n"
+                "#endif\n";
+
+        return out.str();
+    }
+
+    /**
+     * Saves all the sources of the library and the header file with the
+     * declaration of the registration function to a folder.
+     *
+     * @param sourcesFolder the folder where the files should be placed
+     */
+    inline void saveSourcesTo(const std::string& sourcesFolder) {
+        auto saveFile = [&](const std::string& filename, const std::string& source) {
+            std::ofstream sourceFile;
+            std::string file = system::createPath(sourcesFolder, filename);
+            sourceFile.open(file.c_str());
+            sourceFile << source;
+            sourceFile.close();
+        };
+
+        system::createFolder(sourcesFolder);
+
+        const std::map<std::string, ModelCSourceGen<Base>*>& models = this->modelLibraryHelper_->getModels();
+
+        for (const auto& p : models) {
+            for (const auto& it : this->getSources(*p.second)) {
+                saveFile(it.first, it.second);
+            }
+        }
+
+        for (const auto& it : this->getLibrarySources()) {
+            saveFile(it.first, it.second);
+        }
+
+        for (const auto& it : this->modelLibraryHelper_->getCustomSources()) {
+            saveFile(it.first, it.second);
+        }
+
+        for (const auto& it : getRegistrySources()) {
+            saveFile(it.first, it.second);
+        }
+
+        saveFile(_registryName + ".h", getRegistryHeader());
+    }
+
+    /**
+     * Compiles all models and generates a static library.
+     * The header file with the declaration of the registration function is
+     * saved in the same folder as the library.
+     *
+     * @param compiler The compiler used to compile the sources
+     * @param ar The archiver used to assemble the compiled source into a
+     *           static library
+     * @param posIndepCode Whether or not to compile the source
+     *                     with position independent code (required if the
+     *                     library is to be linked into a dynamic library)
+     */
+    void createStaticLibrary(CCompiler<Base>& compiler,
+                             Archiver& ar,
+                             bool posIndepCode = false) {
+        // backup output format so that it can be restored
+        OStreamConfigRestore coutb(std::cout);
+
+        this->modelLibraryHelper_->startingJob("", JobTimer::STATIC_MODEL_LIBRARY);
+
+        const std::map<std::string, ModelCSourceGen<Base>*>& models = this->modelLibraryHelper_->getModels();
+        try {
+            for (const auto& p : models) {
+                const std::map<std::string, std::string>& modelSources = this->getSources(*p.second);
+
+                this->modelLibraryHelper_->startingJob("", JobTimer::COMPILING_FOR_MODEL);
+                compiler.compileSources(modelSources, posIndepCode, this->modelLibraryHelper_);
+                this->modelLibraryHelper_->finishedJob();
+            }
+
+            const std::map<std::string, std::string>& sources = this->getLibrarySources();
+            compiler.compileSources(sources, posIndepCode, this->modelLibraryHelper_);
+
+            const std::map<std::string, std::string>& customSource = this->modelLibraryHelper_->getCustomSources();
+            compiler.compileSources(customSource, posIndepCode, this->modelLibraryHelper_);
+
+            compiler.compileSources(getRegistrySources(), posIndepCode, this->modelLibraryHelper_);
+
+            std::string libname = _libraryName + system::SystemInfo<>::STATIC_LIB_EXTENSION;
+
+            ar.create(libname, compiler.getObjectFiles(), this->modelLibraryHelper_);
+        } catch (...) {
+            compiler.cleanup();
+            throw;
+        }
+        compiler.cleanup();
+
+        std::ofstream header;
+        std::string headerFile = system::createPath(system::directoryFromPath(_libraryName), _registryName + ".h");
+        header.open(headerFile.c_str());
+        header << getRegistryHeader();
+        header.close();
+
+        this->modelLibraryHelper_->finishedJob();
+    }
+
+protected:
+
+    inline void printRegistryDeclaration(std::ostringstream& out) const {
+        LanguageC<Base>::printFunctionDeclaration(out, "void", _registryName, {"char const *const** names",
+                                                                               "void (*const** functions)(void)",
+                                                                               "unsigned long* n"});
+    }
+
+    /**
+     * Generates the registration function which provides the names and
+     * the pointers of all the functions (of the library and of the models)
+     * which are looked up by FunctorModelLibrary and FunctorGenericModel.
+     * Only the functions for which there is source code are registered.
+     */
+    virtual void generateRegistrySource(std::map<std::string, std::string>& sources) {
+        using MSG = ModelCSourceGen<Base>;
+        using MLSG = ModelLibraryCSourceGen<Base>;
+
+        std::ostringstream cache;
+        std::vector<std::string> names;
+
+        auto declareFunction = [&](const std::string& function,
+                                   const std::string& returnType,
+                                   const std::string& args) {
+            cache << returnType << " " << function << "(" << args << ");\n";
+            names.push_back(function);
+        };
+
+        auto declare = [&](const std::map<std::string, std::string>& src,
+                           const std::string& function,
+                           const std::string& returnType,
+                           const std::string& args) {
+            if (src.find(function + ".c") != src.end()) {
+                declareFunction(function, returnType, args);
+            }
+        };
+
+        // for the job timing functions defined in the source file of a multithreaded function
+        auto declareProfile = [&](const ModelCSourceGen<Base>& model,
+                                  const std::string& function,
+                                  const std::string& profileFunction,
+                                  const std::string& returnType,
+                                  const std::string& args) {
+            if (model.getThreadPoolProfileFunctions().count(function) != 0) {
+                declareFunction(profileFunction, returnType, args);
+            }
+        };
+
+        cache << LanguageC<Base>::ATOMICFUN_STRUCT_DEFINITION << "\n"
+                "\n";
+
+        /**
+         * library functions
+         */
+        const std::map<std::string, std::string>& libSources = this->getLibrarySources();
+        declare(libSources, MLSG::FUNCTION_VERSION, "unsigned long", "void");
+        declare(libSources, MLSG::FUNCTION_MODELS, "void", "char const *const** names, int* count");
+        declare(libSources, MLSG::FUNCTION_ONCLOSE, "void", "void");
+
+        if (libSources.find("thread_pool_access.c") != libSources.end()) {
+            // all the thread pool access functions are in the same file
+            cache << "enum ScheduleStrategy {SCHED_STATIC = 1,\n"
+                    "                       SCHED_DYNAMIC = 2,\n"
+                    "                       SCHED_GUIDED = 3\n"
+                    "                       };\n"
+                    "\n"
+                    "struct CppADCGThPoolExecutor;\n"
+                    "\n";
+            declareFunction(MLSG::FUNCTION_SETTHREADPOOLDISABLED, "void", "int disabled");
+            declareFunction(MLSG::FUNCTION_ISTHREADPOOLDISABLED, "int", "void");
+            declareFunction(MLSG::FUNCTION_SETTHREADS, "void", "unsigned int n");
+            declareFunction(MLSG::FUNCTION_GETTHREADS, "unsigned int", "void");
+            declareFunction(MLSG::FUNCTION_SETTHREADSCHEDULERSTRAT, "void", "enum ScheduleStrategy s");
+            declareFunction(MLSG::FUNCTION_GETTHREADSCHEDULERSTRAT, "enum ScheduleStrategy", "void");
+            declareFunction(MLSG::FUNCTION_SETTHREADPOOLVERBOSE, "void", "int v");
+            declareFunction(MLSG::FUNCTION_ISTHREADPOOLVERBOSE, "int", "void");
+            declareFunction(MLSG::FUNCTION_SETTHREADPOOLGUIDEDMAXGROUPWORK, "void", "float v");
+            declareFunction(MLSG::FUNCTION_GETTHREADPOOLGUIDEDMAXGROUPWORK, "float", "void");
+            declareFunction(MLSG::FUNCTION_SETTHREADPOOLNUMBEROFTIMEMEAS, "void", "unsigned int n");
+            declareFunction(MLSG::FUNCTION_GETTHREADPOOLNUMBEROFTIMEMEAS, "unsigned int", "void");
+            declareFunction(MLSG::FUNCTION_SETTHREADPOOLEXECUTOR, "void", "const struct CppADCGThPoolExecutor* executor");
+            declareFunction(MLSG::FUNCTION_SETTHREADPOOLAFFINITY, "void", "int a");
+            declareFunction(MLSG::FUNCTION_GETTHREADPOOLAFFINITY, "int", "void");
+            declareFunction(MLSG::FUNCTION_SETTHREADPOOLAFFINITYCPUS, "void", "const int* cpus, int n");
+            declareFunction(MLSG::FUNCTION_GETTHREADPOOLAFFINITYCPUS, "int", "int* cpus, int n");
+            declareFunction(MLSG::FUNCTION_SETTHREADPOOLSPINTIME, "void", "float seconds");
+            declareFunction(MLSG::FUNCTION_GETTHREADPOOLSPINTIME, "float", "void");
+            declareFunction(MLSG::FUNCTION_SETTHREADPOOLSEQUENTIALTHRESHOLD, "void", "float seconds");
+            declareFunction(MLSG::FUNCTION_GETTHREADPOOLSEQUENTIALTHRESHOLD, "float", "void");
+            declareFunction(MLSG::FUNCTION_RUNTHREADPOOLJOBS, "void", "void (*function)(void*), void** args, unsigned long n");
+        }
+        cache << "\n";
+
+        /**
+         * model functions
+         */
+        const std::map<std::string, ModelCSourceGen<Base>*>& models = this->modelLibraryHelper_->getModels();
+        for (const auto& p : models) {
+            const std::map<std::string, std::string>& src = this->getSources(*p.second);
+            const std::string prefix = p.first + "_";
+            const std::string& baseType = MSG::baseTypeName();
+
+            LanguageC<Base> langC(baseType);
+            const std::string argsDcl = langC.generateDefaultFunctionArgumentsDcl();
+            const std::string atomicDcl = langC.generateArgumentAtomicDcl();
+            const std::string argsFloatDcl = LanguageCSinglePrecision<Base>().generateDefaultFunctionArgumentsDcl();
+            const std::string sparseArgsDcl = "unsigned long pos, " + argsDcl;
+            const std::string sparsity1DArgs = "unsigned long pos, unsigned long const** elements, unsigned long* nnz";
+            const std::string sparsity2DArgs = "unsigned long const** row, unsigned long const** col, unsigned long* nnz";
+            const std::string profileGetArgs = "float* ref, unsigned int* nMeas";
+            const std::string profileSetArgs = "const float* ref, unsigned long n, unsigned int nMeas";
+            const std::string revArgs = baseType + " const tx[], " + baseType + " const ty[], " + baseType + " px[], " + baseType + " const py[], " + atomicDcl;
+
+            declare(src, prefix + MSG::FUNCTION_FORWAD_ZERO, "void", argsDcl);
+            declare(src, prefix + MSG::FUNCTION_JACOBIAN, "void", argsDcl);
+            declare(src, prefix + MSG::FUNCTION_HESSIAN, "void", argsDcl);
+            declare(src, prefix + MSG::FUNCTION_FORWARD_ONE, "int", baseType + " const tx[], " + baseType + " ty[], " + atomicDcl);
+            declare(src, prefix + MSG::FUNCTION_REVERSE_ONE, "int", revArgs);
+            declare(src, prefix + MSG::FUNCTION_REVERSE_TWO, "int", revArgs);
+            declare(src, prefix + MSG::FUNCTION_SPARSE_FORWARD_ONE, "int", sparseArgsDcl);
+            declare(src, prefix + MSG::FUNCTION_SPARSE_REVERSE_ONE, "int", sparseArgsDcl);
+            declare(src, prefix + MSG::FUNCTION_SPARSE_REVERSE_TWO, "int", sparseArgsDcl);
+            declare(src, prefix + MSG::FUNCTION_FORWARD_ONE_SPARSITY, "void", sparsity1DArgs);
+            declare(src, prefix + MSG::FUNCTION_REVERSE_ONE_SPARSITY, "void", sparsity1DArgs);
+            declare(src, prefix + MSG::FUNCTION_REVERSE_TWO_SPARSITY, "void", sparsity1DArgs);
+            declare(src, prefix + MSG::FUNCTION_SPARSE_JACOBIAN, "void", argsDcl);
+            declare(src, prefix + MSG::FUNCTION_SPARSE_HESSIAN, "void", argsDcl);
+            declare(src, prefix + MSG::FUNCTION_SPARSE_JACOBIAN_FLOAT, "void", argsFloatDcl);
+            declare(src, prefix + MSG::FUNCTION_SPARSE_HESSIAN_FLOAT, "void", argsFloatDcl);
+            declareProfile(*p.second, prefix + MSG::FUNCTION_SPARSE_JACOBIAN, prefix + MSG::FUNCTION_SPARSE_JACOBIAN_PROFILE_GET, "unsigned long", profileGetArgs);
+            declareProfile(*p.second, prefix + MSG::FUNCTION_SPARSE_JACOBIAN, prefix + MSG::FUNCTION_SPARSE_JACOBIAN_PROFILE_SET, "void", profileSetArgs);
+            declareProfile(*p.second, prefix + MSG::FUNCTION_SPARSE_HESSIAN, prefix + MSG::FUNCTION_SPARSE_HESSIAN_PROFILE_GET, "unsigned long", profileGetArgs);
+            declareProfile(*p.second, prefix + MSG::FUNCTION_SPARSE_HESSIAN, prefix + MSG::FUNCTION_SPARSE_HESSIAN_PROFILE_SET, "void", profileSetArgs);
+            declare(src, prefix + MSG::FUNCTION_FORWARD_ONE_MULTI, "void", argsDcl);
+            declare(src, prefix + MSG::FUNCTION_REVERSE_ONE_MULTI, "void", argsDcl);
+            declare(src, prefix + MSG::FUNCTION_FORWARD_ONE_MULTI_DIRECTIONS, "void", "unsigned long* value");
+            declare(src, prefix + MSG::FUNCTION_REVERSE_ONE_MULTI_DIRECTIONS, "void", "unsigned long* value");
+            declare(src, prefix + MSG::FUNCTION_FORWARD_TAYLOR, "void", argsDcl);
+            declare(src, prefix + MSG::FUNCTION_FORWARD_TAYLOR_ORDER, "void", "unsigned long* value");
+            declare(src, prefix + MSG::FUNCTION_HESSIAN_VECTOR_PRODUCT, "void", argsDcl);
+            declare(src, prefix + MSG::FUNCTION_HESSIAN_VECTOR_PRODUCT_VECTORS, "void", "unsigned long* value");
+            declare(src, prefix + MSG::FUNCTION_JACOBIAN_SPARSITY, "void", sparsity2DArgs);
+            declare(src, prefix + MSG::FUNCTION_HESSIAN_SPARSITY, "void", sparsity2DArgs);
+            declare(src, prefix + MSG::FUNCTION_JACOBIAN_SPARSITY_PTR, "void", "unsigned long const** sparsity, unsigned long* nnz");
+            declare(src, prefix + MSG::FUNCTION_HESSIAN_SPARSITY_PTR, "void", "unsigned long const** sparsity, unsigned long* nnz");
+            declare(src, prefix + MSG::FUNCTION_JACOBIAN_SPARSITY_LAYOUT, "void", "unsigned long* value");
+            declare(src, prefix + MSG::FUNCTION_HESSIAN_SPARSITY_LAYOUT, "void", "unsigned long* value");
+            declare(src, prefix + MSG::FUNCTION_HESSIAN_SPARSITY_TRIANGLE, "void", "unsigned long* value");
+            declare(src, prefix + MSG::FUNCTION_HESSIAN_SPARSITY2, "void", "unsigned long i, " + sparsity2DArgs);
+            declare(src, prefix + MSG::FUNCTION_INFO, "void", "const char** baseName, unsigned long* m, unsigned long* n, unsigned int* indCount, unsigned int* depCount");
+            declare(src, prefix + MSG::FUNCTION_ATOMIC_FUNC_NAMES, "void", "const char*** names, unsigned long* n");
+            cache << "\n";
+        }
+
+        /**
+         * registration function
+         */
+        printRegistryDeclaration(cache);
+        cache << " {\n"
+                "   static const char* const fnames[] = {\n";
+        for (size_t i = 0; i < names.size(); i++) {
+            if (i > 0) cache << ",\n";
+            cache << "      \"" << names[i] << "\"";
+        }
+        cache << "};\n"
+                "   static void (*const fpointers[])(void) = {\n";
+        for (size_t i = 0; i < names.size(); i++) {
+            if (i > 0) cache << ",\n";
+            cache << "      (void (*)(void)) &" << names[i];
+        }
+        cache << "};\n"
+                "   *names = fnames;\n"
+                "   *functions = fpointers;\n"
+                "   *n = " << names.size() << ";\n"
+                "}\n\n";
+
+        sources[_registryName + ".c"] = cache.str();
+    }
+
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
@@ -30,6 +30,8 @@
 #include <sys/time.h>
 #define __USE_GNU /* required before including  resource.h */
 #include <sys/resource.h>
+#include <sys/syscall.h>
+#include <string.h>
 #endif
 
 enum ScheduleStrategy {SCHED_STATIC = 1,
@@ -40,9 +42,41 @@ enum ScheduleStrategy {SCHED_STATIC = 1,
 enum ElapsedTimeReference {ELAPSED_TIME_AVG,
                            ELAPSED_TIME_MIN};
 
+enum ThreadAffinity {AFFINITY_NONE = 0,
+                     AFFINITY_COMPACT = 1,
+                     AFFINITY_SCATTER = 2,
+                     AFFINITY_EXPLICIT = 3
+                     };
+
+#define CPPADCG_THPOOL_MAX_CPUS 1024
+#define CPPADCG_THPOOL_MAX_NODES 64
+#define CPPADCG_THPOOL_SPIN_CHECK 64 /* busy wait iterations between clock reads */
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CPPADCG_THPOOL_CPU_RELAX() __builtin_ia32_pause()
+#elif defined(__aarch64__)
+#define CPPADCG_THPOOL_CPU_RELAX() __asm__ __volatile__("yield")
+#else
+#define CPPADCG_THPOOL_CPU_RELAX()
+#endif
+
 typedef struct ThPool ThPool;
 typedef void (* thpool_function_type)(void*);
 
+#ifndef CPPADCG_THPOOL_EXECUTOR_DEFINED
+#define CPPADCG_THPOOL_EXECUTOR_DEFINED
+typedef struct CppADCGThPoolExecutor {
+    void* data;
+    void* (*begin)(void* data);
+    void (*submit)(void* data,
+                   void* group,
+                   void (*function)(void*),
+                   void* arg);
+    void (*wait)(void* data,
+                 void* group);
+} CppADCGThPoolExecutor;
+#endif
+
 static ThPool* volatile cppadcg_pool = NULL;
 static int cppadcg_pool_n_threads = 2;
 static int cppadcg_pool_disabled = 0; // false
@@ -50,11 +84,36 @@ static int cppadcg_pool_verbose = 0; // false
 static enum ElapsedTimeReference cppadcg_pool_time_update = ELAPSED_TIME_MIN;
 static unsigned int cppadcg_pool_time_meas = 10; // default number of time measurements
 static float cppadcg_pool_guided_maxgroupwork = 0.75;
+static float cppadcg_pool_spin_time = 0; // busy wait time (seconds) before blocking threads
+static float cppadcg_pool_sequential_threshold = 0; // expected work (seconds) below which jobs are not sent to the pool
 
 static enum ScheduleStrategy schedule_strategy = SCHED_DYNAMIC;
 
+static enum ThreadAffinity cppadcg_pool_affinity = AFFINITY_NONE;
+static int cppadcg_pool_affinity_cpus[CPPADCG_THPOOL_MAX_CPUS];
+static int cppadcg_pool_affinity_n_cpus = 0;
+
+static CppADCGThPoolExecutor cppadcg_pool_executor;
+static int cppadcg_pool_use_executor = 0; // false
+/**
+ * The group of jobs submitted to the host executor by the current thread
+ * (several host threads can evaluate models at the same time)
+ */
+static __thread void* cppadcg_pool_executor_group = NULL;
+static __thread int cppadcg_pool_executor_group_open = 0; // false
+/**
+ * Greater than zero while the current thread is running a job of the pool
+ * or a job started by cppadcg_thpool_run_jobs() (the pool is then used as
+ * if it was disabled so that nested evaluations do not wait for the
+ * threads which are running them)
+ */
+static __thread int cppadcg_pool_nested = 0;
+
 /* ==================== INTERNAL HIGH LEVEL API  ====================== */
 
+static float get_thread_time(struct timespec* cputime,
+                             int* info);
+
 static ThPool* thpool_init(int num_threads);
 
 static int thpool_add_job(ThPool*,
@@ -123,6 +182,7 @@ typedef struct JobQueue {
 /* Thread */
 typedef struct Thread {
     int id;                              /* friendly id                          */
+    int cpu;                             /* CPU used by the thread (-1 if any)   */
     pthread_t pthread;                   /* pointer to actual thread             */
     struct ThPool* thpool;               /* access to ThPool                     */
     WorkGroup* processed_groups;         /* processed work groups (verbose only) */
@@ -135,6 +195,7 @@ typedef struct ThPool {
     int num_threads;                     /* total number of threads   */
     volatile int num_threads_alive;      /* threads currently alive   */
     volatile int num_threads_working;    /* threads currently working */
+    int num_jobs_pending;                /* jobs added but not yet completed (atomic access) */
     pthread_mutex_t thcount_lock;        /* used for thread count etc */
     pthread_cond_t threads_all_idle;     /* signal to thpool_wait     */
     JobQueue* jobqueue;                  /* pointer to the job queue  */
@@ -180,7 +241,7 @@ void cppadcg_thpool_set_disabled(int disabled) {
 }
 
 int cppadcg_thpool_is_disabled() {
-    return cppadcg_pool_disabled;
+    return cppadcg_pool_disabled || cppadcg_pool_nested;
 }
 
 void cppadcg_thpool_set_guided_maxgroupwork(float v) {
@@ -215,6 +276,26 @@ void cppadcg_thpool_set_n_time_meas(unsigned int n) {
     cppadcg_pool_time_meas = n;
 }
 
+void cppadcg_thpool_set_spin_time(float seconds) {
+    if (seconds < 0)
+        seconds = 0;
+    cppadcg_pool_spin_time = seconds;
+}
+
+float cppadcg_thpool_get_spin_time() {
+    return cppadcg_pool_spin_time;
+}
+
+void cppadcg_thpool_set_sequential_threshold(float seconds) {
+    if (seconds < 0)
+        seconds = 0;
+    cppadcg_pool_sequential_threshold = seconds;
+}
+
+float cppadcg_thpool_get_sequential_threshold() {
+    return cppadcg_pool_sequential_threshold;
+}
+
 void cppadcg_thpool_set_verbose(int v) {
     cppadcg_pool_verbose = v;
 }
@@ -231,17 +312,71 @@ int cppadcg_thpool_is_verbose() {
     return cppadcg_pool_verbose;
 }
 
+void cppadcg_thpool_set_affinity(enum ThreadAffinity a) {
+    cppadcg_pool_affinity = a;
+}
+
+enum ThreadAffinity cppadcg_thpool_get_affinity() {
+    return cppadcg_pool_affinity;
+}
+
+void cppadcg_thpool_set_affinity_cpus(const int cpus[],
+                                      int n) {
+    int i;
+    if (n > CPPADCG_THPOOL_MAX_CPUS)
+        n = CPPADCG_THPOOL_MAX_CPUS;
+    if (cpus == NULL || n < 0)
+        n = 0;
+
+    for (i = 0; i < n; ++i) {
+        cppadcg_pool_affinity_cpus[i] = cpus[i];
+    }
+    cppadcg_pool_affinity_n_cpus = n;
+}
+
+int cppadcg_thpool_get_affinity_cpus(int cpus[],
+                                     int n) {
+    int i;
+    if (cpus != NULL) {
+        for (i = 0; i < n && i < cppadcg_pool_affinity_n_cpus; ++i) {
+            cpus[i] = cppadcg_pool_affinity_cpus[i];
+        }
+    }
+    return cppadcg_pool_affinity_n_cpus;
+}
+
 void cppadcg_thpool_prepare() {
     if(cppadcg_pool == NULL) {
         cppadcg_pool = thpool_init(cppadcg_pool_n_threads);
     }
 }
 
+/**
+ * Submits a job to the host executor (elapsed times are not measured).
+ */
+static void executor_submit(thpool_function_type function,
+                            void* arg) {
+    if (!cppadcg_pool_executor_group_open) {
+        if (cppadcg_pool_executor.begin != NULL) {
+            cppadcg_pool_executor_group = (*cppadcg_pool_executor.begin)(cppadcg_pool_executor.data);
+        } else {
+            cppadcg_pool_executor_group = NULL;
+        }
+        cppadcg_pool_executor_group_open = 1;
+    }
+
+    (*cppadcg_pool_executor.submit)(cppadcg_pool_executor.data, cppadcg_pool_executor_group, function, arg);
+}
+
 void cppadcg_thpool_add_job(thpool_function_type function,
                             void* arg,
                             float* avgElapsed,
                             float* elapsed) {
-    if (!cppadcg_pool_disabled) {
+    if (!cppadcg_pool_disabled && !cppadcg_pool_nested) {
+        if (cppadcg_pool_use_executor) {
+            executor_submit(function, arg);
+            return;
+        }
         cppadcg_thpool_prepare();
         if (cppadcg_pool != NULL) {
             thpool_add_job(cppadcg_pool, function, arg, avgElapsed, elapsed);
@@ -253,6 +388,27 @@ void cppadcg_thpool_add_job(thpool_function_type function,
     (*function)(arg);
 }
 
+/**
+ * Determines whether or not the expected work of a group of jobs is too
+ * small to compensate the overhead of using the thread pool.
+ */
+static int is_work_below_threshold(const float avgElapsed[],
+                                   int nJobs) {
+    float total = 0;
+    int i;
+
+    if (cppadcg_pool_sequential_threshold <= 0 || avgElapsed == NULL)
+        return 0;
+
+    for (i = 0; i < nJobs; ++i) {
+        total += avgElapsed[i];
+        if (total >= cppadcg_pool_sequential_threshold)
+            return 0;
+    }
+
+    return 1;
+}
+
 void cppadcg_thpool_add_jobs(thpool_function_type functions[],
                              void* args[],
                              const float avgElapsed[],
@@ -262,7 +418,18 @@ void cppadcg_thpool_add_jobs(thpool_function_type functions[],
                              int nJobs,
                              int lastElapsedChanged) {
     int i;
-    if (!cppadcg_pool_disabled) {
+    int info = 0;
+    float time;
+    struct timespec cputime;
+
+    if (!cppadcg_pool_disabled && !cppadcg_pool_nested && !is_work_below_threshold(avgElapsed, nJobs)) {
+        if (cppadcg_pool_use_executor) {
+            for (i = 0; i < nJobs; ++i) {
+                int j = order != NULL ? order[i] : i;
+                executor_submit(functions[j], args[j]);
+            }
+            return;
+        }
         cppadcg_thpool_prepare();
         if (cppadcg_pool != NULL) {
             thpool_add_jobs(cppadcg_pool, functions, args, avgElapsed, elapsed, order, job2Thread, nJobs, lastElapsedChanged);
@@ -272,16 +439,87 @@ void cppadcg_thpool_add_jobs(thpool_function_type functions[],
 
     // thread pool not used
     for (i = 0; i < nJobs; ++i) {
+        if (elapsed != NULL) {
+            // keep measuring so that the decision can change
+            time = -get_thread_time(&cputime, &info);
+        }
+
         (*functions[i])(args[i]);
+
+        if (elapsed != NULL && info == 0) {
+            time += get_thread_time(&cputime, &info);
+            if (info == 0) {
+                elapsed[i] = time;
+            }
+        }
     }
 }
 
 void cppadcg_thpool_wait() {
+    if (cppadcg_pool_nested) {
+        // jobs were executed by the calling thread
+        return;
+    }
+
+    if (cppadcg_pool_executor_group_open) {
+        cppadcg_pool_executor_group_open = 0;
+        (*cppadcg_pool_executor.wait)(cppadcg_pool_executor.data, cppadcg_pool_executor_group);
+        cppadcg_pool_executor_group = NULL;
+        return;
+    }
+
     if(cppadcg_pool != NULL) {
         thpool_wait(cppadcg_pool);
     }
 }
 
+typedef struct NestedJob {
+    thpool_function_type function;
+    void* arg;
+} NestedJob;
+
+static void run_nested_job(void* arg) {
+    NestedJob* job = (NestedJob*) arg;
+    ++cppadcg_pool_nested;
+    (*job->function)(job->arg);
+    --cppadcg_pool_nested;
+}
+
+void cppadcg_thpool_run_jobs(thpool_function_type function,
+                             void* args[],
+                             int nJobs) {
+    NestedJob* jobs;
+    int i;
+
+    if (nJobs <= 0)
+        return;
+
+    if (cppadcg_pool_disabled || cppadcg_pool_nested || nJobs == 1) {
+        for (i = 0; i < nJobs; ++i) {
+            (*function)(args[i]);
+        }
+        return;
+    }
+
+    jobs = (NestedJob*) malloc(nJobs * sizeof(NestedJob));
+    if (jobs == NULL) {
+        fprintf(stderr, "cppadcg_thpool_run_jobs(): Could not allocate memory for the jobs\n");
+        for (i = 0; i < nJobs; ++i) {
+            (*function)(args[i]);
+        }
+        return;
+    }
+
+    for (i = 0; i < nJobs; ++i) {
+        jobs[i].function = function;
+        jobs[i].arg = args[i];
+        cppadcg_thpool_add_job(&run_nested_job, &jobs[i], NULL, NULL);
+    }
+    cppadcg_thpool_wait();
+
+    free(jobs);
+}
+
 typedef struct pair_double_int {
     float val;
     int index;
@@ -360,13 +598,34 @@ void cppadcg_thpool_shutdown() {
     }
 }
 
+void cppadcg_thpool_set_executor(const CppADCGThPoolExecutor* executor) {
+    if (executor != NULL && executor->submit != NULL && executor->wait != NULL) {
+        // the threads of the internal pool are no longer required
+        cppadcg_thpool_shutdown();
+        cppadcg_pool_executor = *executor;
+        cppadcg_pool_use_executor = 1;
+    } else {
+        cppadcg_pool_use_executor = 0;
+    }
+    cppadcg_pool_executor_group = NULL;
+    cppadcg_pool_executor_group_open = 0;
+}
+
+int cppadcg_thpool_has_executor() {
+    return cppadcg_pool_use_executor;
+}
+
 /* ========================== PROTOTYPES ============================ */
 
 static void thpool_cleanup(ThPool* thpool);
 
 static int  thread_init(ThPool* thpool,
                         Thread** thread,
-                        int id);
+                        int id,
+                        int cpu);
+static void  thread_assign_cpus(int cpus[],
+                                int num_threads);
+static void  thread_bind_cpu(Thread* thread);
 static void* thread_do(Thread* thread);
 static void  thread_destroy(Thread* thread);
 
@@ -391,6 +650,8 @@ static void  bsem_reset(BSem *bsem);
 static void  bsem_post(BSem *bsem);
 static void  bsem_post_all(BSem *bsem);
 static void  bsem_wait(BSem *bsem);
+static int   spin_wait(int* value,
+                       int expected);
 
 
 /* ============================ TIME ============================== */
@@ -482,6 +743,7 @@ struct ThPool* thpool_init(int num_threads) {
     thpool->num_threads = num_threads;
     thpool->num_threads_alive = 0;
     thpool->num_threads_working = 0;
+    thpool->num_jobs_pending = 0;
     thpool->threads_keepalive = 1;
 
     /* Initialize the job queue */
@@ -506,8 +768,10 @@ struct ThPool* thpool_init(int num_threads) {
 
     /* Thread init */
     int n;
+    int cpus[num_threads];
+    thread_assign_cpus(cpus, num_threads);
     for (n = 0; n < num_threads; n++) {
-        thread_init(thpool, &thpool->threads[n], n);
+        thread_init(thpool, &thpool->threads[n], n, cpus[n]);
     }
 
     /* Wait for threads to initialize */
@@ -562,6 +826,9 @@ static int thpool_add_job(ThPool* thpool,
     newjob->avgElapsed = avgElapsed;
     newjob->elapsed = elapsed;
 
+    /* count the job before it can be completed by a thread */
+    __atomic_add_fetch(&thpool->num_jobs_pending, 1, __ATOMIC_RELEASE);
+
     /* add job to queue */
     jobqueue_push(thpool->jobqueue, newjob);
 
@@ -604,13 +871,22 @@ static int thpool_add_jobs(ThPool* thpool,
             newjobs[i]->elapsed = NULL;
     }
 
+    /* count the jobs before they can be completed by a thread */
+    __atomic_add_fetch(&thpool->num_jobs_pending, nJobs, __ATOMIC_RELEASE);
+
     /* add jobs to queue */
+    int ret = 0;
     if (schedule_strategy == SCHED_STATIC && avgElapsed != NULL && order != NULL && nJobs > 0 && avgElapsed[0] > 0) {
-        return jobqueue_push_static_jobs(thpool, newjobs, avgElapsed, job2Thread, nJobs, lastElapsedChanged);
+        ret = jobqueue_push_static_jobs(thpool, newjobs, avgElapsed, job2Thread, nJobs, lastElapsedChanged);
     } else {
         jobqueue_multipush(thpool->jobqueue, newjobs, nJobs);
-        return 0;
     }
+
+    if (ret != 0) {
+        /* the jobs were not added */
+        __atomic_sub_fetch(&thpool->num_jobs_pending, nJobs, __ATOMIC_RELEASE);
+    }
+    return ret;
 }
 
 /**
@@ -792,13 +1068,20 @@ static int jobqueue_push_static_jobs(ThPool* thpool,
  * @param threadpool     the threadpool to wait for
  */
 static void thpool_wait(ThPool* thpool) {
-    pthread_mutex_lock(&thpool->thcount_lock);
-    while (thpool->jobqueue->len || thpool->jobqueue->group_front || thpool->num_threads_working) {  //// PROBLEM HERE!!!! len is not locked!!!!
-        pthread_cond_wait(&thpool->threads_all_idle, &thpool->thcount_lock);
+    /* there is no need to block if all jobs complete while busy waiting */
+    if (cppadcg_pool_spin_time <= 0 || !spin_wait(&thpool->num_jobs_pending, 0)) {
+        pthread_mutex_lock(&thpool->thcount_lock);
+        while (thpool->jobqueue->len || thpool->jobqueue->group_front || thpool->num_threads_working) {  //// PROBLEM HERE!!!! len is not locked!!!!
+            pthread_cond_wait(&thpool->threads_all_idle, &thpool->thcount_lock);
+        }
+        pthread_mutex_unlock(&thpool->thcount_lock);
     }
+
+    /* the queue can be accessed by threads which have not yet noticed it is empty */
+    pthread_mutex_lock(&thpool->jobqueue->rwmutex);
     thpool->jobqueue->total_time = 0;
     thpool->jobqueue->highest_expected_return = 0;
-    pthread_mutex_unlock(&thpool->thcount_lock);
+    pthread_mutex_unlock(&thpool->jobqueue->rwmutex);
 
     thpool_cleanup(thpool);
 }
@@ -930,11 +1213,13 @@ static void thpool_destroy(ThPool* thpool) {
  *
  * @param thread        address to the pointer of the thread to be created
  * @param id            id to be given to the thread
+ * @param cpu           the CPU where the thread should run (-1 for any)
  * @return 0 on success, -1 otherwise.
  */
 static int thread_init(ThPool* thpool,
                        Thread** thread,
-                       int id) {
+                       int id,
+                       int cpu) {
 
     *thread = (Thread*) malloc(sizeof(Thread));
     if (*thread == NULL) {
@@ -944,6 +1229,7 @@ static int thread_init(ThPool* thpool,
 
     (*thread)->thpool = thpool;
     (*thread)->id = id;
+    (*thread)->cpu = cpu;
     (*thread)->processed_groups = NULL;
 
     pthread_create(&(*thread)->pthread, NULL, (void*) thread_do, (*thread));
@@ -969,6 +1255,7 @@ static void* thread_do(Thread* thread) {
     thpool_function_type func_buff;
     void* arg_buff;
     int i;
+    int group_size;
 
     /* Set thread name for profiling and debugging */
     char thread_name[128] = {0};
@@ -983,6 +1270,10 @@ static void* thread_do(Thread* thread) {
     fprintf(stderr, "thread_do(): pthread_setname_np is not supported on this system");
 #endif
 
+    /* Bind the thread before it touches any memory so that its stack and
+     * the buffers it allocates are placed in its NUMA node (first touch) */
+    thread_bind_cpu(thread);
+
     /* Assure all threads have been created before starting serving */
     ThPool* thpool = thread->thpool;
 
@@ -1014,6 +1305,8 @@ static void* thread_do(Thread* thread) {
             if (workGroup == NULL)
                 break;
 
+            group_size = workGroup->size;
+
             if (cppadcg_pool_verbose) {
                 get_monotonic_time2(&workGroup->startTime);
             }
@@ -1033,7 +1326,9 @@ static void* thread_do(Thread* thread) {
                 /* Execute the job */
                 func_buff = job->function;
                 arg_buff = job->arg;
+                ++cppadcg_pool_nested;
                 func_buff(arg_buff);
+                --cppadcg_pool_nested;
 
                 if (do_benchmark && info == 0) {
                     elapsed += get_thread_time(&cputime, &info);
@@ -1060,6 +1355,8 @@ static void* thread_do(Thread* thread) {
                 free(workGroup->jobs);
                 free(workGroup);
             }
+
+            __atomic_sub_fetch(&thpool->num_jobs_pending, group_size, __ATOMIC_RELEASE);
         }
 
         pthread_mutex_lock(&thpool->thcount_lock);
@@ -1083,6 +1380,188 @@ static void thread_destroy(Thread* thread) {
     free(thread);
 }
 
+/* ============================ AFFINITY ============================ */
+
+/* Determines the CPUs which the process is allowed to use
+ *
+ * @param cpus          the allowed CPUs (output)
+ * @return the number of allowed CPUs (0 if unknown)
+ */
+static int affinity_allowed_cpus(int cpus[]) {
+#if defined(__linux__)
+    unsigned long mask[CPPADCG_THPOOL_MAX_CPUS / (8 * sizeof(unsigned long))];
+    long bytes;
+    int c;
+    int n = 0;
+    const int bits = 8 * sizeof(unsigned long);
+
+    memset(mask, 0, sizeof(mask));
+    bytes = syscall(SYS_sched_getaffinity, 0, sizeof(mask), mask);
+    if (bytes <= 0)
+        return 0;
+
+    for (c = 0; c < bytes * 8 && c < CPPADCG_THPOOL_MAX_CPUS; ++c) {
+        if (mask[c / bits] & (1UL << (c % bits))) {
+            cpus[n++] = c;
+        }
+    }
+    return n;
+#else
+    return 0;
+#endif
+}
+
+/* Determines the NUMA node of each CPU (node 0 if unknown)
+ *
+ * @param cpu2node      the node of each CPU (output)
+ * @return the number of nodes
+ */
+static int affinity_cpu_nodes(int cpu2node[]) {
+    int nNodes = 1;
+    int c;
+
+    for (c = 0; c < CPPADCG_THPOOL_MAX_CPUS; ++c) {
+        cpu2node[c] = 0;
+    }
+
+#if defined(__linux__)
+    int node;
+    for (node = 0; node < CPPADCG_THPOOL_MAX_NODES; ++node) {
+        char path[128];
+        FILE* file;
+        int first, last;
+        char sep;
+
+        sprintf(path, "/sys/devices/system/node/node%d/cpulist", node);
+        file = fopen(path, "r");
+        if (file == NULL)
+            continue;
+
+        /* e.g. "0-15,32-47" */
+        while (fscanf(file, "%d", &first) == 1) {
+            last = first;
+            sep = (char) fgetc(file);
+            if (sep == '-') {
+                if (fscanf(file, "%d", &last) != 1)
+                    break;
+                sep = (char) fgetc(file);
+            }
+            for (c = first; c <= last && c < CPPADCG_THPOOL_MAX_CPUS; ++c) {
+                if (c >= 0)
+                    cpu2node[c] = node;
+            }
+            if (sep != ',')
+                break;
+        }
+        fclose(file);
+
+        if (node + 1 > nNodes)
+            nNodes = node + 1;
+    }
+#endif
+
+    return nNodes;
+}
+
+/* Determines the CPU of each thread according to the affinity strategy
+ *
+ * AFFINITY_COMPACT  fills the CPUs of a NUMA node before moving to the next
+ * AFFINITY_SCATTER  places consecutive threads in different NUMA nodes
+ * AFFINITY_EXPLICIT uses the user provided CPU list
+ *
+ * @param cpus          the CPU of each thread or -1 (output)
+ * @param num_threads   the number of threads in the pool
+ */
+static void thread_assign_cpus(int cpus[],
+                               int num_threads) {
+    int allowed[CPPADCG_THPOOL_MAX_CPUS];
+    int cpu2node[CPPADCG_THPOOL_MAX_CPUS];
+    int ordered[CPPADCG_THPOOL_MAX_CPUS];
+    int nAllowed;
+    int nNodes;
+    int nOrdered = 0;
+    int i, j, node;
+
+    for (i = 0; i < num_threads; ++i) {
+        cpus[i] = -1;
+    }
+
+    if (cppadcg_pool_affinity == AFFINITY_EXPLICIT) {
+        if (cppadcg_pool_affinity_n_cpus > 0) {
+            for (i = 0; i < num_threads; ++i) {
+                cpus[i] = cppadcg_pool_affinity_cpus[i % cppadcg_pool_affinity_n_cpus];
+            }
+        }
+        return;
+    } else if (cppadcg_pool_affinity != AFFINITY_COMPACT && cppadcg_pool_affinity != AFFINITY_SCATTER) {
+        return;
+    }
+
+    nAllowed = affinity_allowed_cpus(allowed);
+    if (nAllowed == 0)
+        return;
+
+    nNodes = affinity_cpu_nodes(cpu2node);
+
+    if (cppadcg_pool_affinity == AFFINITY_COMPACT) {
+        /* node by node */
+        for (node = 0; node < nNodes; ++node) {
+            for (j = 0; j < nAllowed; ++j) {
+                if (cpu2node[allowed[j]] == node)
+                    ordered[nOrdered++] = allowed[j];
+            }
+        }
+    } else {
+        /* one CPU from each node at a time */
+        int next[CPPADCG_THPOOL_MAX_NODES];
+        for (node = 0; node < nNodes; ++node) {
+            next[node] = 0;
+        }
+        while (nOrdered < nAllowed) {
+            for (node = 0; node < nNodes; ++node) {
+                for (j = next[node]; j < nAllowed; ++j) {
+                    if (cpu2node[allowed[j]] == node) {
+                        ordered[nOrdered++] = allowed[j];
+                        break;
+                    }
+                }
+                next[node] = j + 1;
+            }
+        }
+    }
+
+    for (i = 0; i < num_threads; ++i) {
+        cpus[i] = ordered[i % nOrdered];
+    }
+}
+
+/* Binds the calling thread to the CPU defined for the thread */
+static void thread_bind_cpu(Thread* thread) {
+    if (thread->cpu < 0)
+        return;
+
+#if defined(__linux__)
+    unsigned long mask[CPPADCG_THPOOL_MAX_CPUS / (8 * sizeof(unsigned long))];
+    const int bits = 8 * sizeof(unsigned long);
+
+    if (thread->cpu >= CPPADCG_THPOOL_MAX_CPUS) {
+        fprintf(stderr, "thread_bind_cpu(): invalid CPU %i\n", thread->cpu);
+        return;
+    }
+
+    memset(mask, 0, sizeof(mask));
+    mask[thread->cpu / bits] |= 1UL << (thread->cpu % bits);
+
+    if (syscall(SYS_sched_setaffinity, 0, sizeof(mask), mask) != 0) {
+        fprintf(stderr, "thread_bind_cpu(): failed to bind thread %i to CPU %i\n", thread->id, thread->cpu);
+    } else if (cppadcg_pool_verbose) {
+        fprintf(stdout, "thread_bind_cpu(): thread %i bound to CPU %i\n", thread->id, thread->cpu);
+    }
+#else
+    fprintf(stderr, "thread_bind_cpu(): thread affinity is not supported on this system\n");
+#endif
+}
+
 
 /* ============================ JOB QUEUE =========================== */
 
@@ -1392,7 +1871,7 @@ static void bsem_reset(BSem* bsem) {
 /* Post to at least one thread */
 static void bsem_post(BSem* bsem) {
     pthread_mutex_lock(&bsem->mutex);
-    bsem->v = 1;
+    __atomic_store_n(&bsem->v, 1, __ATOMIC_RELEASE);
     pthread_cond_signal(&bsem->cond);
     pthread_mutex_unlock(&bsem->mutex);
 }
@@ -1401,7 +1880,7 @@ static void bsem_post(BSem* bsem) {
 /* Post to all threads */
 static void bsem_post_all(BSem* bsem) {
     pthread_mutex_lock(&bsem->mutex);
-    bsem->v = 1;
+    __atomic_store_n(&bsem->v, 1, __ATOMIC_RELEASE);
     pthread_cond_broadcast(&bsem->cond);
     pthread_mutex_unlock(&bsem->mutex);
 }
@@ -1409,10 +1888,46 @@ static void bsem_post_all(BSem* bsem) {
 
 /* Wait on semaphore until semaphore has value 0 */
 static void bsem_wait(BSem* bsem) {
+    if (cppadcg_pool_spin_time > 0) {
+        /* busy wait for a short time before blocking the thread */
+        while (spin_wait(&bsem->v, 1)) {
+            if (__atomic_exchange_n(&bsem->v, 0, __ATOMIC_ACQ_REL) == 1)
+                return;
+        }
+    }
+
     pthread_mutex_lock(&bsem->mutex);
-    while (bsem->v != 1) {
+    while (__atomic_load_n(&bsem->v, __ATOMIC_ACQUIRE) != 1) {
         pthread_cond_wait(&bsem->cond, &bsem->mutex);
     }
-    bsem->v = 0;
+    __atomic_store_n(&bsem->v, 0, __ATOMIC_RELEASE);
     pthread_mutex_unlock(&bsem->mutex);
 }
+
+
+/**
+ * Busy waits until the value is equal to expected or the spin time
+ * (cppadcg_pool_spin_time) elapses.
+ *
+ * @return 1 if the value became equal to expected and 0 otherwise
+ */
+static int spin_wait(int* value,
+                     int expected) {
+    struct timespec start, now;
+    float spent;
+    unsigned int i = 0;
+
+    get_monotonic_time2(&start);
+
+    while (__atomic_load_n(value, __ATOMIC_ACQUIRE) != expected) {
+        if (++i % CPPADCG_THPOOL_SPIN_CHECK == 0) {
+            get_monotonic_time2(&now);
+            spent = (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) * 1e-9f;
+            if (spent >= cppadcg_pool_spin_time)
+                return 0;
+        }
+        CPPADCG_THPOOL_CPU_RELAX();
+    }
+
+    return 1;
+}
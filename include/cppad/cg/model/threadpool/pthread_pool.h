@@ -27,8 +27,31 @@ enum ScheduleStrategy {SCHED_STATIC = 1,
 enum ElapsedTimeReference {ELAPSED_TIME_AVG,
                            ELAPSED_TIME_MIN};
 
+enum ThreadAffinity {AFFINITY_NONE = 0,
+                     AFFINITY_COMPACT = 1,
+                     AFFINITY_SCATTER = 2,
+                     AFFINITY_EXPLICIT = 3
+                     };
+
 typedef void (*cppadcg_thpool_function_type)(void*);
 
+#ifndef CPPADCG_THPOOL_EXECUTOR_DEFINED
+#define CPPADCG_THPOOL_EXECUTOR_DEFINED
+/**
+ * Callbacks used to run jobs in a thread pool owned by the host application
+ */
+typedef struct CppADCGThPoolExecutor {
+    void* data;
+    void* (*begin)(void* data);
+    void (*submit)(void* data,
+                   void* group,
+                   void (*function)(void*),
+                   void* arg);
+    void (*wait)(void* data,
+                 void* group);
+} CppADCGThPoolExecutor;
+#endif
+
 
 void cppadcg_thpool_set_threads(int n);
 
@@ -59,12 +82,36 @@ void cppadcg_thpool_set_verbose(int v);
 
 int cppadcg_thpool_is_verbose();
 
+void cppadcg_thpool_set_spin_time(float seconds);
+
+float cppadcg_thpool_get_spin_time();
+
+void cppadcg_thpool_set_sequential_threshold(float seconds);
+
+float cppadcg_thpool_get_sequential_threshold();
+
+
+void cppadcg_thpool_set_affinity(enum ThreadAffinity a);
+
+enum ThreadAffinity cppadcg_thpool_get_affinity();
+
+void cppadcg_thpool_set_affinity_cpus(const int cpus[],
+                                      int n);
+
+int cppadcg_thpool_get_affinity_cpus(int cpus[],
+                                     int n);
+
 
 void cppadcg_thpool_set_disabled(int disabled);
 
 int cppadcg_thpool_is_disabled();
 
 
+void cppadcg_thpool_set_executor(const CppADCGThPoolExecutor* executor);
+
+int cppadcg_thpool_has_executor();
+
+
 void cppadcg_thpool_prepare();
 
 void cppadcg_thpool_add_job(cppadcg_thpool_function_type function,
@@ -83,6 +130,16 @@ void cppadcg_thpool_add_jobs(cppadcg_thpool_function_type functions[],
 
 void cppadcg_thpool_wait();
 
+/**
+ * Runs function(args[i]) for each job using the thread pool and waits for
+ * all of them to complete.
+ * Any job added by these jobs (e.g. by multithreaded model functions) is
+ * executed by the thread running it.
+ */
+void cppadcg_thpool_run_jobs(cppadcg_thpool_function_type function,
+                             void* args[],
+                             int nJobs);
+
 void cppadcg_thpool_update_order(float refElapsed[],
                                  unsigned int nTimeMeas,
                                  const float elapsed[],
@@ -0,0 +1,31 @@
+#ifndef CPPAD_CG_THREAD_POOL_AFFINITY_INCLUDED
+#define CPPAD_CG_THREAD_POOL_AFFINITY_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+namespace CppAD {
+namespace cg {
+
+enum class ThreadPoolAffinity {
+    NONE = 0, // threads can run on any CPU
+    COMPACT = 1, // fill the CPUs of a NUMA node before using the next node
+    SCATTER = 2, // place consecutive threads in different NUMA nodes
+    EXPLICIT = 3 // use a user provided list of CPUs
+};
+
+}
+}
+
+#endif
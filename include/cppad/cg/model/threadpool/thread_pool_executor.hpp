@@ -0,0 +1,69 @@
+#ifndef CPPAD_CG_THREAD_POOL_EXECUTOR_INCLUDED
+#define CPPAD_CG_THREAD_POOL_EXECUTOR_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+extern "C" {
+
+/**
+ * Must be kept identical to the definition in pthread_pool.h
+ */
+#ifndef CPPADCG_THPOOL_EXECUTOR_DEFINED
+#define CPPADCG_THPOOL_EXECUTOR_DEFINED
+
+/**
+ * Callbacks used by compiled models to run the jobs of multithreaded
+ * evaluations (e.g. sparse Jacobians and Hessians) in a thread pool owned by
+ * the host application instead of the thread pool created by each model
+ * library.
+ * The same executor can be shared by several model libraries.
+ *
+ * The jobs of a model evaluation are submitted to a group which is created
+ * by begin() and then the evaluation waits for all the jobs in that group
+ * to complete by calling wait().
+ * Different model evaluations can be performed concurrently by different
+ * host threads (using different model libraries) and therefore the
+ * callbacks must be thread-safe.
+ */
+typedef struct CppADCGThPoolExecutor {
+    /**
+     * User data passed to all the callbacks (e.g. the host thread pool)
+     */
+    void* data;
+    /**
+     * Creates a new group of jobs (optional, nullptr groups are used if
+     * not provided)
+     */
+    void* (*begin)(void* data);
+    /**
+     * Schedules the execution of function(arg) in the group
+     */
+    void (*submit)(void* data,
+                   void* group,
+                   void (*function)(void*),
+                   void* arg);
+    /**
+     * Blocks until all the jobs submitted to the group complete and
+     * releases the group
+     */
+    void (*wait)(void* data,
+                 void* group);
+} CppADCGThPoolExecutor;
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef CPPAD_CG_THREAD_POOL_PROFILE_INCLUDED
+#define CPPAD_CG_THREAD_POOL_PROFILE_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * The reference execution times of the jobs of multithreaded model
+ * functions (e.g. the sparse Jacobian and Hessian) which are used by the
+ * thread pool to distribute those jobs among its threads.
+ *
+ * A profile can be saved after a model has been used and loaded again in a
+ * later execution of the application so that the first calls do not have
+ * to measure the execution time of each job again.
+ */
+class ThreadPoolProfile {
+public:
+    /**
+     * The profile of a single multithreaded function
+     */
+    struct Function {
+        /// reference execution time of each job (in seconds)
+        std::vector<float> elapsed;
+        /// number of time measurements used to determine the reference times
+        unsigned int measurements = 0;
+    };
+
+    /**
+     * The profiles of each multithreaded function
+     * (e.g. ModelCSourceGen::FUNCTION_SPARSE_JACOBIAN)
+     */
+    std::map<std::string, Function> functions;
+
+public:
+
+    inline bool empty() const {
+        return functions.empty();
+    }
+
+    /**
+     * Saves the profile using a text format.
+     *
+     * @param out the output stream
+     */
+    inline void write(std::ostream& out) const {
+        std::ios_base::fmtflags flags = out.flags();
+        std::streamsize precision = out.precision(std::numeric_limits<float>::max_digits10);
+        out << std::scientific;
+
+        out << "cppadcg_thread_pool_profile 1\n"
+            << functions.size() << "\n";
+        for (const auto& p : functions) {
+            const Function& f = p.second;
+            out << p.first << " " << f.measurements << " " << f.elapsed.size();
+            for (float e : f.elapsed) {
+                out << " " << e;
+            }
+            out << "\n";
+        }
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+
+    /**
+     * Loads a profile saved with write().
+     *
+     * The number of jobs of each function is validated against the
+     * profile of the model which will use the loaded times (e.g. obtained
+     * with GenericModel::getThreadPoolProfile()) before any memory is
+     * allocated.
+     *
+     * @param in the input stream
+     * @param reference the current profile of the model which determines
+     *                  the functions and their number of jobs
+     * @throws CGException if the profile could not be read or if it does
+     *                     not match the reference profile
+     */
+    inline void read(std::istream& in,
+                     const ThreadPoolProfile& reference) {
+        std::string header;
+        int version = 0;
+        in >> header >> version;
+        if (!in || header != "cppadcg_thread_pool_profile" || version != 1) {
+            throw CGException("Invalid thread pool profile");
+        }
+
+        size_t nFunctions = 0;
+        in >> nFunctions;
+
+        std::map<std::string, Function> newFunctions;
+        for (size_t i = 0; i < nFunctions && in; ++i) {
+            std::string name;
+            size_t n = 0;
+            Function f;
+            in >> name >> f.measurements >> n;
+            if (!in)
+                break;
+
+            auto it = reference.functions.find(name);
+            if (it == reference.functions.end()) {
+                throw CGException("The thread pool profile contains an unknown function '", name, "'");
+            } else if (n != it->second.elapsed.size()) {
+                throw CGException("The thread pool profile of '", name, "' has ", n, " jobs but ",
+                                  it->second.elapsed.size(), " were expected");
+            }
+
+            f.elapsed.resize(n);
+            for (size_t j = 0; j < n; ++j) {
+                in >> f.elapsed[j];
+            }
+            newFunctions[name] = std::move(f);
+        }
+
+        if (!in) {
+            throw CGException("Failed to read the thread pool profile");
+        }
+
+        functions.swap(newFunctions);
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
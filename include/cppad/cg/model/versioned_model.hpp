@@ -0,0 +1,496 @@
+#ifndef CPPAD_CG_VERSIONED_MODEL_INCLUDED
+#define CPPAD_CG_VERSIONED_MODEL_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * A model from a VersionedModelLibrary.
+ * Every call is forwarded to the model from the most recent version of the
+ * library.
+ * When the library is replaced, the model from the new version is created
+ * at the beginning of the next call and the atomic functions and external
+ * models previously provided are added to it.
+ *
+ * This class is not thread-safe and it should not be used simultaneously in
+ * different threads.
+ * Multiple instances of this class for the same model from the same model
+ * library object can be used simultaneously in different threads.
+ *
+ * The row and column pointers provided by SparseJacobian() and
+ * SparseHessian() are only valid until the next call.
+ * Bound functions (e.g. bindForwardZero()) are not available since they
+ * would not follow replacements of the library.
+ *
+ * A model can outlive the VersionedModelLibrary which created it and it
+ * then keeps using the last version of the library.
+ */
+template<class Base>
+class VersionedModel : public GenericModel<Base> {
+public:
+    using VersionPtr = typename VersionedModelLibrary<Base>::VersionPtr;
+    using CurrentVersion = typename VersionedModelLibrary<Base>::CurrentVersion;
+protected:
+    /// the current version of the library (shared with the library)
+    const std::shared_ptr<const CurrentVersion> _library;
+    /// the model name
+    const std::string _name;
+    /// the library version used by the current model (must be destroyed after the model)
+    VersionPtr _version;
+    /// the model from the current version of the library
+    std::unique_ptr<GenericModel<Base>> _model;
+    /// atomic functions provided by the user
+    std::vector<atomic_base<Base>*> _atomics;
+    /// external models provided by the user
+    std::vector<GenericModel<Base>*> _externalModels;
+public:
+
+    /**
+     * Creates a new model.
+     *
+     * @param library the current version of the library
+     * @param name the model name
+     */
+    inline VersionedModel(std::shared_ptr<const CurrentVersion> library,
+                          const std::string& name) :
+        _library(std::move(library)),
+        _name(name) {
+        update();
+    }
+
+    VersionedModel(const VersionedModel&) = delete;
+    VersionedModel& operator=(const VersionedModel&) = delete;
+
+    /**
+     * Provides the number of the library version currently used by this
+     * model.
+     */
+    inline size_t getVersionNumber() const {
+        return _version->number;
+    }
+
+    /**
+     * Switches to the most recent version of the library (if there is a
+     * new one).
+     * This is performed automatically at the beginning of each call.
+     *
+     * @return the model from the most recent version of the library
+     */
+    inline GenericModel<Base>& update() {
+        VersionPtr v = _library->get();
+        if (v != _version) {
+            std::unique_ptr<GenericModel<Base>> m = v->library->model(_name);
+            CPPADCG_ASSERT_KNOWN(m != nullptr, "Model not available in the new version of the model library")
+            for (atomic_base<Base>* a : _atomics)
+                m->addAtomicFunction(*a);
+            for (GenericModel<Base>* e : _externalModels)
+                m->addExternalModel(*e);
+
+            _model = std::move(m); // the previous model must be deleted before its library
+            _version = std::move(v);
+        }
+        return *_model;
+    }
+
+    const std::string& getName() const override {
+        return _name;
+    }
+
+    const std::vector<std::string>& getAtomicFunctionNames() override {
+        return update().getAtomicFunctionNames();
+    }
+
+    bool addAtomicFunction(atomic_base<Base>& atomic) override {
+        bool added = update().addAtomicFunction(atomic);
+        if (added)
+            _atomics.push_back(&atomic);
+        return added;
+    }
+
+    bool addExternalModel(GenericModel<Base>& atomic) override {
+        bool added = update().addExternalModel(atomic);
+        if (added)
+            _externalModels.push_back(&atomic);
+        return added;
+    }
+
+    bool isJacobianSparsityAvailable() override {
+        return update().isJacobianSparsityAvailable();
+    }
+
+    std::vector<bool> JacobianSparsityBool() override {
+        return update().JacobianSparsityBool();
+    }
+
+    std::vector<std::set<size_t> > JacobianSparsitySet() override {
+        return update().JacobianSparsitySet();
+    }
+
+    void JacobianSparsity(std::vector<size_t>& equations,
+                          std::vector<size_t>& variables) override {
+        update().JacobianSparsity(equations, variables);
+    }
+
+    bool isHessianSparsityAvailable() override {
+        return update().isHessianSparsityAvailable();
+    }
+
+    std::vector<bool> HessianSparsityBool() override {
+        return update().HessianSparsityBool();
+    }
+
+    std::vector<std::set<size_t> > HessianSparsitySet() override {
+        return update().HessianSparsitySet();
+    }
+
+    void HessianSparsity(std::vector<size_t>& rows,
+                         std::vector<size_t>& cols) override {
+        update().HessianSparsity(rows, cols);
+    }
+
+    bool isEquationHessianSparsityAvailable() override {
+        return update().isEquationHessianSparsityAvailable();
+    }
+
+    std::vector<bool> HessianSparsityBool(size_t i) override {
+        return update().HessianSparsityBool(i);
+    }
+
+    std::vector<std::set<size_t> > HessianSparsitySet(size_t i) override {
+        return update().HessianSparsitySet(i);
+    }
+
+    void HessianSparsity(size_t i, std::vector<size_t>& rows,
+                         std::vector<size_t>& cols) override {
+        update().HessianSparsity(i, rows, cols);
+    }
+
+    /**
+     * Provides the number of independent variables of the model version
+     * currently in use.
+     */
+    size_t Domain() const override {
+        return _model->Domain();
+    }
+
+    /**
+     * Provides the number of dependent variables of the model version
+     * currently in use.
+     */
+    size_t Range() const override {
+        return _model->Range();
+    }
+
+    bool isForwardZeroAvailable() override {
+        return update().isForwardZeroAvailable();
+    }
+
+    void ForwardZero(ArrayView<const Base> x,
+                     ArrayView<Base> dep) override {
+        update().ForwardZero(x, dep);
+    }
+
+    void ForwardZero(const std::vector<const Base*> &x,
+                     ArrayView<Base> dep) override {
+        update().ForwardZero(x, dep);
+    }
+
+    void ForwardZero(const CppAD::vector<bool>& vx,
+                     CppAD::vector<bool>& vy,
+                     ArrayView<const Base> tx,
+                     ArrayView<Base> ty) override {
+        update().ForwardZero(vx, vy, tx, ty);
+    }
+
+    bool isJacobianAvailable() override {
+        return update().isJacobianAvailable();
+    }
+
+    void Jacobian(ArrayView<const Base> x,
+                  ArrayView<Base> jac) override {
+        update().Jacobian(x, jac);
+    }
+
+    bool isHessianAvailable() override {
+        return update().isHessianAvailable();
+    }
+
+    void Hessian(ArrayView<const Base> x,
+                 ArrayView<const Base> w,
+                 ArrayView<Base> hess) override {
+        update().Hessian(x, w, hess);
+    }
+
+    bool isForwardOneAvailable() override {
+        return update().isForwardOneAvailable();
+    }
+
+    void ForwardOne(ArrayView<const Base> tx,
+                    ArrayView<Base> ty) override {
+        update().ForwardOne(tx, ty);
+    }
+
+    bool isSparseForwardOneAvailable() override {
+        return update().isSparseForwardOneAvailable();
+    }
+
+    void ForwardOne(ArrayView<const Base> x,
+                    size_t tx1Nnz, const size_t idx[], const Base tx1[],
+                    ArrayView<Base> ty1) override {
+        update().ForwardOne(x, tx1Nnz, idx, tx1, ty1);
+    }
+
+    bool isReverseOneAvailable() override {
+        return update().isReverseOneAvailable();
+    }
+
+    void ReverseOne(ArrayView<const Base> tx,
+                    ArrayView<const Base> ty,
+                    ArrayView<Base> px,
+                    ArrayView<const Base> py) override {
+        update().ReverseOne(tx, ty, px, py);
+    }
+
+    bool isSparseReverseOneAvailable() override {
+        return update().isSparseReverseOneAvailable();
+    }
+
+    void ReverseOne(ArrayView<const Base> x,
+                    ArrayView<Base> px,
+                    size_t pyNnz, const size_t idx[], const Base py[]) override {
+        update().ReverseOne(x, px, pyNnz, idx, py);
+    }
+
+    bool isReverseTwoAvailable() override {
+        return update().isReverseTwoAvailable();
+    }
+
+    void ReverseTwo(ArrayView<const Base> tx,
+                    ArrayView<const Base> ty,
+                    ArrayView<Base> px,
+                    ArrayView<const Base> py) override {
+        update().ReverseTwo(tx, ty, px, py);
+    }
+
+    bool isSparseReverseTwoAvailable() override {
+        return update().isSparseReverseTwoAvailable();
+    }
+
+    void ReverseTwo(ArrayView<const Base> x,
+                    size_t tx1Nnz, const size_t idx[], const Base tx1[],
+                    ArrayView<Base> px2,
+                    ArrayView<const Base> py2) override {
+        update().ReverseTwo(x, tx1Nnz, idx, tx1, px2, py2);
+    }
+
+    bool isSparseJacobianAvailable() override {
+        return update().isSparseJacobianAvailable();
+    }
+
+    void SparseJacobian(ArrayView<const Base> x,
+                        ArrayView<Base> jac) override {
+        update().SparseJacobian(x, jac);
+    }
+
+    void SparseJacobian(const std::vector<Base> &x,
+                        std::vector<Base>& jac,
+                        std::vector<size_t>& row,
+                        std::vector<size_t>& col) override {
+        update().SparseJacobian(x, jac, row, col);
+    }
+
+    void SparseJacobian(ArrayView<const Base> x,
+                        ArrayView<Base> jac,
+                        size_t const** row,
+                        size_t const** col) override {
+        update().SparseJacobian(x, jac, row, col);
+    }
+
+    void SparseJacobian(const std::vector<const Base*>& x,
+                        ArrayView<Base> jac,
+                        size_t const** row,
+                        size_t const** col) override {
+        update().SparseJacobian(x, jac, row, col);
+    }
+
+    bool isSparseHessianAvailable() override {
+        return update().isSparseHessianAvailable();
+    }
+
+    void SparseHessian(ArrayView<const Base> x,
+                       ArrayView<const Base> w,
+                       ArrayView<Base> hess) override {
+        update().SparseHessian(x, w, hess);
+    }
+
+    void SparseHessian(const std::vector<Base> &x,
+                       const std::vector<Base> &w,
+                       std::vector<Base>& hess,
+                       std::vector<size_t>& row,
+                       std::vector<size_t>& col) override {
+        update().SparseHessian(x, w, hess, row, col);
+    }
+
+    void SparseHessian(ArrayView<const Base> x,
+                       ArrayView<const Base> w,
+                       ArrayView<Base> hess,
+                       size_t const** row,
+                       size_t const** col) override {
+        update().SparseHessian(x, w, hess, row, col);
+    }
+
+    void SparseHessian(const std::vector<const Base*>& x,
+                       ArrayView<const Base> w,
+                       ArrayView<Base> hess,
+                       size_t const** row,
+                       size_t const** col) override {
+        update().SparseHessian(x, w, hess, row, col);
+    }
+
+    SparseMatrixLayout getSparseJacobianLayout() override {
+        return update().getSparseJacobianLayout();
+    }
+
+    void JacobianSparsityPointers(size_t const** ptr,
+                                  size_t* size) override {
+        update().JacobianSparsityPointers(ptr, size);
+    }
+
+    SparseMatrixLayout getSparseHessianLayout() override {
+        return update().getSparseHessianLayout();
+    }
+
+    void HessianSparsityPointers(size_t const** ptr,
+                                 size_t* size) override {
+        update().HessianSparsityPointers(ptr, size);
+    }
+
+    MatrixTriangle getSparseHessianTriangle() override {
+        return update().getSparseHessianTriangle();
+    }
+
+    bool isForwardOneMultiAvailable() override {
+        return update().isForwardOneMultiAvailable();
+    }
+
+    size_t getForwardOneMultiMaxDirections() override {
+        return update().getForwardOneMultiMaxDirections();
+    }
+
+    void ForwardOneMulti(ArrayView<const Base> x,
+                         ArrayView<const Base> tx1,
+                         ArrayView<Base> ty1) override {
+        update().ForwardOneMulti(x, tx1, ty1);
+    }
+
+    bool isReverseOneMultiAvailable() override {
+        return update().isReverseOneMultiAvailable();
+    }
+
+    size_t getReverseOneMultiMaxDirections() override {
+        return update().getReverseOneMultiMaxDirections();
+    }
+
+    void ReverseOneMulti(ArrayView<const Base> x,
+                         ArrayView<const Base> py,
+                         ArrayView<Base> px) override {
+        update().ReverseOneMulti(x, py, px);
+    }
+
+    bool isForwardTaylorAvailable() override {
+        return update().isForwardTaylorAvailable();
+    }
+
+    size_t getForwardTaylorOrder() override {
+        return update().getForwardTaylorOrder();
+    }
+
+    void ForwardTaylor(size_t p,
+                       ArrayView<const Base> tx,
+                       ArrayView<Base> ty) override {
+        update().ForwardTaylor(p, tx, ty);
+    }
+
+    bool isHessianVectorProductAvailable() override {
+        return update().isHessianVectorProductAvailable();
+    }
+
+    size_t getHessianVectorProductMaxVectors() override {
+        return update().getHessianVectorProductMaxVectors();
+    }
+
+    void HessianVectorProduct(ArrayView<const Base> x,
+                              ArrayView<const Base> w,
+                              ArrayView<const Base> v,
+                              ArrayView<Base> hv) override {
+        update().HessianVectorProduct(x, w, v, hv);
+    }
+
+    bool isSparseJacobianFloatAvailable() override {
+        return update().isSparseJacobianFloatAvailable();
+    }
+
+    void SparseJacobianFloat(ArrayView<const Base> x,
+                             ArrayView<float> jac,
+                             size_t const** row,
+                             size_t const** col) override {
+        update().SparseJacobianFloat(x, jac, row, col);
+    }
+
+    bool isSparseHessianFloatAvailable() override {
+        return update().isSparseHessianFloatAvailable();
+    }
+
+    void SparseHessianFloat(ArrayView<const Base> x,
+                            ArrayView<const Base> w,
+                            ArrayView<float> hess,
+                            size_t const** row,
+                            size_t const** col) override {
+        update().SparseHessianFloat(x, w, hess, row, col);
+    }
+
+    void ForwardZeroMany(const std::vector<const Base*>& x,
+                         const std::vector<Base*>& dep,
+                         size_t chunkSize = 0) override {
+        update().ForwardZeroMany(x, dep, chunkSize);
+    }
+
+    void SparseJacobianMany(const std::vector<const Base*>& x,
+                            const std::vector<Base*>& jac,
+                            size_t const** row,
+                            size_t const** col,
+                            size_t chunkSize = 0) override {
+        update().SparseJacobianMany(x, jac, row, col, chunkSize);
+    }
+
+    ThreadPoolProfile getThreadPoolProfile() override {
+        return update().getThreadPoolProfile();
+    }
+
+    void setThreadPoolProfile(const ThreadPoolProfile& profile) override {
+        update().setThreadPoolProfile(profile);
+    }
+
+    inline virtual ~VersionedModel() {
+        _model.reset(); // must be deleted before the library version
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
@@ -0,0 +1,364 @@
+#ifndef CPPAD_CG_VERSIONED_MODEL_LIBRARY_INCLUDED
+#define CPPAD_CG_VERSIONED_MODEL_LIBRARY_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * A model library which can be replaced by a new version while its models
+ * are being used (e.g. a new dynamic library created after a change in the
+ * model equations).
+ *
+ * Models obtained from this library (VersionedModel) always use the most
+ * recent version of the library for new calls.
+ * Models can be used after this object is deleted, in which case they
+ * keep using the last version of the library.
+ * A call which already started is completed using the previous version.
+ * Each version of the library is kept loaded while there are models
+ * still using it and it is closed (e.g. dlclose) once the last model
+ * switches to a newer version.
+ *
+ * The methods of this class can be called from different threads.
+ * Like other models, each VersionedModel should only be used by one thread
+ * at a time.
+ *
+ * Usage example:
+ * @code
+ * VersionedModelLibrary<double> lib(p.createDynamicLibrary(compiler));
+ * std::unique_ptr<GenericModel<double>> model = lib.model("model");
+ * ...
+ * // build and load a new version in a background thread
+ * std::future<size_t> v = lib.replaceAsync([&]() {
+ *     return p2.createDynamicLibrary(compiler2);
+ * });
+ * @endcode
+ */
+template<class Base>
+class VersionedModelLibrary : public ModelLibrary<Base> {
+public:
+
+    /**
+     * A version of the model library
+     */
+    class Version {
+    public:
+        /// the library
+        const std::unique_ptr<ModelLibrary<Base>> library;
+        /// version number (starts at 1)
+        const size_t number;
+
+        inline Version(std::unique_ptr<ModelLibrary<Base>> lib,
+                       size_t n) :
+            library(std::move(lib)),
+            number(n) {
+        }
+    };
+
+    using VersionPtr = std::shared_ptr<const Version>;
+
+    /**
+     * Holds the current version of the library.
+     * It is shared with the models so that they can outlive the library
+     * object (they then keep using the last version).
+     */
+    class CurrentVersion {
+    private:
+        /// the current version (only accessed using atomic operations)
+        VersionPtr _version;
+    public:
+        inline explicit CurrentVersion(VersionPtr version) :
+            _version(std::move(version)) {
+        }
+
+        inline VersionPtr get() const {
+            return std::atomic_load(&_version);
+        }
+
+        inline void set(VersionPtr version) {
+            std::atomic_store(&_version, std::move(version));
+        }
+    };
+
+protected:
+    /**
+     * The current version of the library
+     */
+    std::shared_ptr<CurrentVersion> _current;
+    /**
+     * Used to serialize library replacements
+     */
+    std::mutex _replaceMutex;
+    /**
+     * All the versions of the library which may still be in use
+     * (guarded by _replaceMutex)
+     */
+    std::vector<std::weak_ptr<const Version>> _versions;
+    /**
+     * The host executor provided to all versions of the library
+     * (guarded by _replaceMutex)
+     */
+    std::unique_ptr<CppADCGThPoolExecutor> _executor;
+public:
+
+    /**
+     * Creates a new versioned model library.
+     *
+     * @param library the initial version of the model library
+     */
+    explicit VersionedModelLibrary(std::unique_ptr<ModelLibrary<Base>> library) {
+        CPPADCG_ASSERT_KNOWN(library != nullptr, "Invalid model library")
+        VersionPtr v = std::make_shared<const Version>(std::move(library), 1);
+        _versions.push_back(v);
+        _current = std::make_shared<CurrentVersion>(std::move(v));
+    }
+
+    VersionedModelLibrary(const VersionedModelLibrary&) = delete;
+    VersionedModelLibrary& operator=(const VersionedModelLibrary&) = delete;
+
+    /**
+     * Provides the current version of the library.
+     * The library will remain loaded at least while the returned pointer
+     * is kept.
+     */
+    inline VersionPtr getCurrentVersion() const {
+        return _current->get();
+    }
+
+    /**
+     * Provides the number of the current version of the library.
+     */
+    inline size_t getVersionNumber() const {
+        return getCurrentVersion()->number;
+    }
+
+    /**
+     * Replaces the library used by new calls of all models.
+     * Thread pool settings (including the host executor) are copied from
+     * the previous version.
+     * The previous version is closed once all the models stop using it.
+     *
+     * Each version must be built into a different file (e.g. a dynamic
+     * library with a version number in its name) since loading a file
+     * which is already loaded (e.g. with dlopen) provides the code of the
+     * previous version.
+     *
+     * @param library the new version of the model library
+     * @return the new version number
+     * @throws CGException if the new library uses the same loaded code as a
+     *                     version which may still be in use
+     */
+    virtual size_t replace(std::unique_ptr<ModelLibrary<Base>> library) {
+        CPPADCG_ASSERT_KNOWN(library != nullptr, "Invalid model library")
+
+        std::lock_guard<std::mutex> lock(_replaceMutex);
+
+        // versions no longer in use have been closed
+        _versions.erase(std::remove_if(_versions.begin(), _versions.end(),
+                                       [](const std::weak_ptr<const Version>& w) { return w.expired(); }),
+                        _versions.end());
+
+        void* models = loadedModelsFunction(*library);
+        if (models != nullptr) {
+            for (const std::weak_ptr<const Version>& w : _versions) {
+                VersionPtr v = w.lock();
+                if (v != nullptr && loadedModelsFunction(*v->library) == models) {
+                    throw CGException("The new version of the model library was loaded from the same file as version ",
+                                      v->number, " (each version must use a different file)");
+                }
+            }
+        }
+
+        VersionPtr old = getCurrentVersion();
+        ModelLibrary<Base>& oldLib = *old->library;
+
+        library->setThreadPoolDisabled(oldLib.isThreadPoolDisabled());
+        library->setThreadNumber(oldLib.getThreadNumber());
+        library->setThreadPoolSchedulerStrategy(oldLib.getThreadPoolSchedulerStrategy());
+        library->setThreadPoolVerbose(oldLib.isThreadPoolVerbose());
+        library->setThreadPoolGuidedMaxWork(oldLib.getThreadPoolGuidedMaxWork());
+        library->setThreadPoolNumberOfTimeMeas(oldLib.getThreadPoolNumberOfTimeMeas());
+        library->setThreadPoolAffinityCpus(oldLib.getThreadPoolAffinityCpus());
+        library->setThreadPoolAffinity(oldLib.getThreadPoolAffinity());
+        library->setThreadPoolSpinTime(oldLib.getThreadPoolSpinTime());
+        library->setThreadPoolSequentialThreshold(oldLib.getThreadPoolSequentialThreshold());
+        if (_executor != nullptr) {
+            library->setThreadPoolExecutor(_executor.get());
+        }
+
+        VersionPtr v = std::make_shared<const Version>(std::move(library), old->number + 1);
+        _versions.push_back(v);
+        _current->set(v);
+
+        return v->number;
+    }
+
+    /**
+     * Creates (e.g. generates, compiles, and loads) a new version of the
+     * library in a different thread and then replaces the current version.
+     * This object must not be deleted before the returned future is ready.
+     *
+     * @param creator a function which creates the new library version
+     * @return the new version number (available once the new library is
+     *         in use)
+     */
+    template<class LibraryCreator>
+    inline std::future<size_t> replaceAsync(LibraryCreator creator) {
+        return std::async(std::launch::async, [this, creator]() mutable {
+            std::unique_ptr<ModelLibrary<Base>> lib(creator());
+            return this->replace(std::move(lib));
+        });
+    }
+
+    std::set<std::string> getModelNames() override {
+        return getCurrentVersion()->library->getModelNames();
+    }
+
+    /**
+     * Creates a new model which always uses the current version of the
+     * library.
+     *
+     * @param modelName the model name
+     * @return the model or an empty pointer if it does not exist in the
+     *         current version of the library
+     */
+    virtual std::unique_ptr<VersionedModel<Base>> modelVersioned(const std::string& modelName) {
+        std::unique_ptr<VersionedModel<Base>> m;
+        std::set<std::string> names = getModelNames();
+        if (names.find(modelName) == names.end()) {
+            return m;
+        }
+        m.reset(new VersionedModel<Base>(_current, modelName));
+        return m;
+    }
+
+    std::unique_ptr<GenericModel<Base>> model(const std::string& modelName) override {
+        return std::unique_ptr<GenericModel<Base>>(modelVersioned(modelName).release());
+    }
+
+    void setThreadPoolDisabled(bool disabled) override {
+        getCurrentVersion()->library->setThreadPoolDisabled(disabled);
+    }
+
+    bool isThreadPoolDisabled() const override {
+        return getCurrentVersion()->library->isThreadPoolDisabled();
+    }
+
+    unsigned int getThreadNumber() const override {
+        return getCurrentVersion()->library->getThreadNumber();
+    }
+
+    void setThreadNumber(unsigned int n) override {
+        getCurrentVersion()->library->setThreadNumber(n);
+    }
+
+    ThreadPoolScheduleStrategy getThreadPoolSchedulerStrategy() const override {
+        return getCurrentVersion()->library->getThreadPoolSchedulerStrategy();
+    }
+
+    void setThreadPoolSchedulerStrategy(ThreadPoolScheduleStrategy s) override {
+        getCurrentVersion()->library->setThreadPoolSchedulerStrategy(s);
+    }
+
+    void setThreadPoolVerbose(bool v) override {
+        getCurrentVersion()->library->setThreadPoolVerbose(v);
+    }
+
+    bool isThreadPoolVerbose() const override {
+        return getCurrentVersion()->library->isThreadPoolVerbose();
+    }
+
+    void setThreadPoolGuidedMaxWork(float v) override {
+        getCurrentVersion()->library->setThreadPoolGuidedMaxWork(v);
+    }
+
+    float getThreadPoolGuidedMaxWork() const override {
+        return getCurrentVersion()->library->getThreadPoolGuidedMaxWork();
+    }
+
+    void setThreadPoolNumberOfTimeMeas(unsigned int n) override {
+        getCurrentVersion()->library->setThreadPoolNumberOfTimeMeas(n);
+    }
+
+    unsigned int getThreadPoolNumberOfTimeMeas() const override {
+        return getCurrentVersion()->library->getThreadPoolNumberOfTimeMeas();
+    }
+
+    void setThreadPoolAffinity(ThreadPoolAffinity a) override {
+        getCurrentVersion()->library->setThreadPoolAffinity(a);
+    }
+
+    ThreadPoolAffinity getThreadPoolAffinity() const override {
+        return getCurrentVersion()->library->getThreadPoolAffinity();
+    }
+
+    void setThreadPoolAffinityCpus(const std::vector<int>& cpus) override {
+        getCurrentVersion()->library->setThreadPoolAffinityCpus(cpus);
+    }
+
+    std::vector<int> getThreadPoolAffinityCpus() const override {
+        return getCurrentVersion()->library->getThreadPoolAffinityCpus();
+    }
+
+    void setThreadPoolSpinTime(float seconds) override {
+        getCurrentVersion()->library->setThreadPoolSpinTime(seconds);
+    }
+
+    float getThreadPoolSpinTime() const override {
+        return getCurrentVersion()->library->getThreadPoolSpinTime();
+    }
+
+    void setThreadPoolSequentialThreshold(float seconds) override {
+        getCurrentVersion()->library->setThreadPoolSequentialThreshold(seconds);
+    }
+
+    float getThreadPoolSequentialThreshold() const override {
+        return getCurrentVersion()->library->getThreadPoolSequentialThreshold();
+    }
+
+    void setThreadPoolExecutor(const CppADCGThPoolExecutor* executor) override {
+        std::lock_guard<std::mutex> lock(_replaceMutex);
+
+        if (executor != nullptr) {
+            _executor.reset(new CppADCGThPoolExecutor(*executor));
+        } else {
+            _executor.reset();
+        }
+        getCurrentVersion()->library->setThreadPoolExecutor(executor);
+    }
+
+    inline virtual ~VersionedModelLibrary() = default;
+
+protected:
+
+    /**
+     * Provides the address of the function listing the models of a library
+     * which identifies the loaded library code.
+     *
+     * @return the function address or null if it is not available
+     */
+    static void* loadedModelsFunction(ModelLibrary<Base>& library) {
+        auto* functorLib = dynamic_cast<FunctorModelLibrary<Base>*>(&library);
+        if (functorLib == nullptr)
+            return nullptr;
+        return functorLib->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_MODELS, false);
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
@@ -0,0 +1,239 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+#include "model_benchmark.hpp"
+#include "../../../../test/cppad/cg/models/cstr.hpp"
+#include "../../../../test/cppad/cg/models/distillation.hpp"
+#include "../../../../test/cppad/cg/models/tank_battery.hpp"
+#include "../../../../test/cppad/cg/models/plug_flow.hpp"
+#include "../../../../test/cppad/cg/models/collocation.hpp"
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * A model with a fixed number of equations which is repeated several times
+ * (with different independent variables) to increase the model size.
+ */
+class RepeatedModelBenchmark : public ModelBenchmark {
+protected:
+    std::vector<ADCGD> (*function_)(const std::vector<ADCGD>& x);
+    std::vector<Base> x0_;
+public:
+
+    inline RepeatedModelBenchmark(const std::string& name,
+                                  size_t repeat,
+                                  std::vector<ADCGD> (*model)(const std::vector<ADCGD>& x),
+                                  const std::vector<Base>& x0) :
+        ModelBenchmark(name, repeat),
+        function_(model),
+        x0_(x0) {
+    }
+
+    std::vector<Base> getTypicalValues() override {
+        std::vector<Base> x(x0_.size() * size_);
+        for (size_t r = 0; r < size_; r++) {
+            for (size_t j = 0; j < x0_.size(); j++) {
+                x[r * x0_.size() + j] = x0_[j] * (1.0 + 1e-3 * r);
+            }
+        }
+        return x;
+    }
+
+    std::vector<ADCGD> evaluate(const std::vector<ADCGD>& x) override {
+        size_t n0 = x0_.size();
+        std::vector<ADCGD> y;
+        std::vector<ADCGD> xr(n0);
+        for (size_t r = 0; r < size_; r++) {
+            std::copy(x.begin() + r * n0, x.begin() + (r + 1) * n0, xr.begin());
+            std::vector<ADCGD> yr = (*function_)(xr);
+            y.insert(y.end(), yr.begin(), yr.end());
+        }
+        return y;
+    }
+};
+
+class PlugFlowBenchmark : public ModelBenchmark {
+public:
+
+    inline explicit PlugFlowBenchmark(size_t nEls) :
+        ModelBenchmark("plugflow", nEls) {
+    }
+
+    std::vector<Base> getTypicalValues() override {
+        return PlugFlowModel<Base>::getTypicalValues(size_);
+    }
+
+    std::vector<ADCGD> evaluate(const std::vector<ADCGD>& x) override {
+        PlugFlowModel<CGD> m;
+        return m.model2(x, size_);
+    }
+};
+
+/**
+ * Collocation model using the plug flow model (as an atomic function)
+ */
+class PlugFlowCollocationModel : public CollocationModel<CG<double> > {
+protected:
+    size_t nEls_; // number of plug flow discretization elements
+public:
+
+    explicit PlugFlowCollocationModel(size_t nEls) :
+        CollocationModel<CG<double> >(PlugFlowModel<AD<double> >::N_EL_STATES * nEls, // ns
+                                      PlugFlowModel<AD<double> >::N_CONTROLS, // nm
+                                      PlugFlowModel<AD<double> >::N_PAR), // npar
+        nEls_(nEls) {
+    }
+
+protected:
+
+    void atomicFunction(const std::vector<AD<CG<double> > >& x,
+                        std::vector<AD<CG<double> > >& y) override {
+        PlugFlowModel<CG<double> > m;
+        y = m.model2(x, nEls_);
+    }
+
+    void atomicFunction(const std::vector<AD<double> >& x,
+                        std::vector<AD<double> >& y) override {
+        PlugFlowModel<double> m;
+        y = m.model2(x, nEls_);
+    }
+
+    std::string getAtomicLibName() override {
+        return "plugflow";
+    }
+};
+
+class CollocationBenchmark : public ModelBenchmark {
+protected:
+    size_t nTimeInt_;
+    PlugFlowCollocationModel collocation_;
+public:
+
+    inline CollocationBenchmark(size_t nTimeInt,
+                                size_t nEls) :
+        ModelBenchmark("collocation", nTimeInt),
+        nTimeInt_(nTimeInt),
+        collocation_(nEls) {
+        collocation_.setTypicalAtomModelValues(PlugFlowModel<Base>::getTypicalValues(nEls));
+        collocation_.createAtomicLib();
+    }
+
+    std::vector<Base> getTypicalValues() override {
+        return collocation_.getTypicalValues(nTimeInt_);
+    }
+
+    std::vector<ADCGD> evaluate(const std::vector<ADCGD>& x) override {
+        return collocation_.evaluateModel(x, nTimeInt_);
+    }
+
+    std::vector<GenericModel<Base>*> getExternalModels() override {
+        return std::vector<GenericModel<Base>*>{collocation_.getGenericModel()};
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using Base = double;
+using ADCGD = ModelBenchmark::ADCGD;
+
+static std::vector<ADCGD> cstr(const std::vector<ADCGD>& x) {
+    return CstrFunc<ModelBenchmark::CGD>(x);
+}
+
+static std::vector<ADCGD> distillation(const std::vector<ADCGD>& x) {
+    return distillationFunc<ModelBenchmark::CGD>(x);
+}
+
+static std::vector<ADCGD> tankBattery(const std::vector<ADCGD>& x) {
+    return tankBatteryFunc<ModelBenchmark::CGD>(x);
+}
+
+static std::vector<Base> cstrTypicalValues() {
+    return std::vector<Base>{0.3, 7.82e3, 304.65, 301.15, 2.3333e-04, 6.6667e-05, 6.2e14, 10080, 2e3, 10e3,
+                             1e-11, 6.6667e-05, 294.15, 294.15, 1000, 4184, -33488, 299.15, 302.65, 7e5,
+                             1203, 3.22, 950.0, 0.48649427192323, 1000, 4184, 0.014, 1e-7};
+}
+
+static std::vector<Base> distillationTypicalValues() {
+    const size_t nStage = 8;
+    std::vector<Base> x;
+    for (size_t i = 0; i < nStage; i++) x.push_back(12000 + 1); // mWater
+    for (size_t i = 0; i < nStage; i++) x.push_back(12000 + 1); // mEthanol
+    for (size_t i = 0; i < nStage; i++) x.push_back(360 + (i + 1)); // T
+    for (size_t i = 0; i < nStage; i++) x.push_back(0.3 + 0.05 * i); // yWater
+    for (size_t i = 0; i < nStage; i++) x.push_back(0.7 - 0.05 * i); // yEthanol
+    for (size_t i = 0; i < nStage - 1; i++) x.push_back(8 + 0.1 * i); // V
+    x.push_back(150e3); // Qc
+    x.push_back(250e3); // Qsteam
+    x.push_back(0.1); // Fdistillate
+    x.push_back(2.5); // reflux
+    x.push_back(4); // Frectifier
+    x.push_back(30); // feed
+    x.push_back(1.01325e5); // P
+    x.push_back(0.7); // xFWater
+    x.push_back(366); // Tfeed
+    return x;
+}
+
+static std::vector<Base> tankBatteryTypicalValues() {
+    std::vector<Base> x(8);
+    for (size_t i = 0; i < 6; i++) x[i] = 1.0 + 0.1 * i; // tank levels
+    x[6] = 2.0; // inlet flow
+    x[7] = 0.1; // tank radius
+    return x;
+}
+
+/**
+ * Usage:
+ *   benchmark_models <model> [size] [executions] [preparations] [atomic elements]
+ *
+ * model: cstr, distillation, tank_battery, plugflow, collocation
+ *
+ * The results are printed to the standard output in JSON.
+ */
+int main(int argc, char **argv) {
+    std::string modelName = argc > 1 ? argv[1] : "cstr";
+    size_t size = ModelBenchmark::parseProgramArguments(2, argc, argv, 10);
+    size_t nExec = ModelBenchmark::parseProgramArguments(3, argc, argv, 50);
+    size_t nPrep = ModelBenchmark::parseProgramArguments(4, argc, argv, 3);
+
+    std::unique_ptr<ModelBenchmark> benchmark;
+    if (modelName == "cstr") {
+        benchmark.reset(new RepeatedModelBenchmark(modelName, size, &cstr, cstrTypicalValues()));
+    } else if (modelName == "distillation") {
+        benchmark.reset(new RepeatedModelBenchmark(modelName, size, &distillation, distillationTypicalValues()));
+    } else if (modelName == "tank_battery") {
+        benchmark.reset(new RepeatedModelBenchmark(modelName, size, &tankBattery, tankBatteryTypicalValues()));
+    } else if (modelName == "plugflow") {
+        benchmark.reset(new PlugFlowBenchmark(size));
+    } else if (modelName == "collocation") {
+        size_t nEls = ModelBenchmark::parseProgramArguments(5, argc, argv, 10); // number of plug flow elements
+        benchmark.reset(new CollocationBenchmark(size, nEls));
+    } else {
+        std::cerr << "Unknown model '" << modelName << "'" << std::endl;
+        return 1;
+    }
+
+    benchmark->setNumberOfExecutions(nExec);
+    benchmark->setNumberOfPreparations(nPrep);
+    benchmark->measureSpeed(std::cout);
+
+    return 0;
+}
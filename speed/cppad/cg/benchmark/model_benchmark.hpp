@@ -0,0 +1,467 @@
+#ifndef CPPAD_CG_MODEL_BENCHMARK_INCLUDED
+#define CPPAD_CG_MODEL_BENCHMARK_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+#include <cppad/cg/cppadcg.hpp>
+#if CPPADCG_BENCHMARK_LLVM
+#include <cppad/cg/model/llvm/llvm.hpp>
+#endif
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Collects the elapsed time of the jobs reported by a JobTimer
+ * (accumulated by job type).
+ */
+class BenchmarkJobListener : public JobListener {
+public:
+    std::map<const JobType*, duration> elapsed;
+public:
+
+    inline void reset() {
+        elapsed.clear();
+    }
+
+    inline duration get(const JobType& type) const {
+        auto it = elapsed.find(&type);
+        if (it == elapsed.end())
+            return duration(0);
+        return it->second;
+    }
+
+    void jobStarted(const std::vector<Job>& job) override {
+        // do nothing
+    }
+
+    void jobEndended(const std::vector<Job>& job,
+                     duration elapsedTime) override {
+        elapsed[&job.back().getType()] += elapsedTime;
+    }
+};
+
+/**
+ * C language generator which measures the time spent emitting source code
+ * (everything else in CodeHandler::generateCode() are the graph
+ * optimization passes).
+ */
+template<class Base>
+class BenchmarkLanguageC : public LanguageC<Base> {
+public:
+    std::chrono::steady_clock::duration emission;
+public:
+
+    explicit BenchmarkLanguageC(const std::string& varTypeName) :
+        LanguageC<Base>(varTypeName),
+        emission(0) {
+    }
+
+protected:
+
+    void generateSourceCode(std::ostream& out,
+                            std::unique_ptr<LanguageGenerationData<Base> > info) override {
+        auto t0 = std::chrono::steady_clock::now();
+        LanguageC<Base>::generateSourceCode(out, std::move(info));
+        emission += std::chrono::steady_clock::now() - t0;
+    }
+};
+
+/**
+ * Measures the time required by each phase of the creation of a model
+ * library (taping, operation graph creation and optimization, C source
+ * generation, compilation, loading) and the time of each evaluation
+ * function of the GenericModel API.
+ *
+ * The results are written in JSON.
+ */
+class ModelBenchmark {
+public:
+    using Base = double;
+    using CGD = CppAD::cg::CG<Base>;
+    using ADCGD = CppAD::AD<CGD>;
+    using duration = std::chrono::steady_clock::duration;
+public:
+    bool zeroOrder;
+    bool jacobian;
+    bool hessian;
+    bool sparseJacobian;
+    bool sparseHessian;
+    bool forwardOne;
+    bool reverseOne;
+    bool reverseTwo;
+    bool jit;
+protected:
+    const std::string name_;
+    const size_t size_;
+    std::vector<std::string> compileFlags_;
+    size_t nPrepare_;
+    size_t nTimes_;
+    BenchmarkJobListener listener_;
+    std::unique_ptr<DynamicLib<Base> > dynamicLib_;
+    std::unique_ptr<GenericModel<Base> > model_;
+    /// preparation phase durations
+    std::map<std::string, std::vector<duration> > phases_;
+    /// evaluation durations
+    std::map<std::string, std::vector<duration> > evaluation_;
+public:
+
+    /**
+     * @param name the model family name
+     * @param size the model size (meaning depends on the model family)
+     */
+    inline ModelBenchmark(const std::string& name,
+                          size_t size) :
+        zeroOrder(true),
+        jacobian(true),
+        hessian(true),
+        sparseJacobian(true),
+        sparseHessian(true),
+        forwardOne(true),
+        reverseOne(true),
+        reverseTwo(true),
+        jit(true),
+        name_(name),
+        size_(size),
+        nPrepare_(3),
+        nTimes_(50) {
+    }
+
+    inline virtual ~ModelBenchmark() = default;
+
+    /**
+     * Defines how many times the model library is created
+     */
+    inline void setNumberOfPreparations(size_t nPrepare) {
+        nPrepare_ = nPrepare;
+    }
+
+    /**
+     * Defines how many times each evaluation function is called
+     */
+    inline void setNumberOfExecutions(size_t nTimes) {
+        nTimes_ = nTimes;
+    }
+
+    inline void setCompileFlags(const std::vector<std::string>& compileFlags) {
+        compileFlags_ = compileFlags;
+    }
+
+    /**
+     * The independent variable values used for taping and evaluation
+     */
+    virtual std::vector<Base> getTypicalValues() = 0;
+
+    /**
+     * The model
+     */
+    virtual std::vector<ADCGD> evaluate(const std::vector<ADCGD>& x) = 0;
+
+    /**
+     * Models which must be provided as atomic functions to the generated
+     * model
+     */
+    virtual std::vector<GenericModel<Base>*> getExternalModels() {
+        return std::vector<GenericModel<Base>*>();
+    }
+
+    inline void measureSpeed(std::ostream& out) {
+        using namespace std::chrono;
+
+        phases_.clear();
+        evaluation_.clear();
+
+        std::vector<Base> x = getTypicalValues();
+
+        for (size_t i = 0; i < nPrepare_; i++) {
+            // tape
+            auto t0 = steady_clock::now();
+            std::unique_ptr<ADFun<CGD> > fun(tapeModel(x));
+            phases_["tape"].push_back(steady_clock::now() - t0);
+
+            // operation graph and source code for the original model only
+            measureCodeHandler(*fun, x);
+
+            // model library
+            createDynamicLib(*fun, x);
+        }
+
+        evaluationSpeed(x);
+
+        printJSON(out, x.size());
+    }
+
+    inline static size_t parseProgramArguments(int pos, int argc, char **argv, size_t defaultValue) {
+        if (argc > pos) {
+            std::istringstream is(argv[pos]);
+            size_t value;
+            is >> value;
+            return value;
+        }
+        return defaultValue;
+    }
+
+protected:
+
+    inline ADFun<CGD>* tapeModel(const std::vector<Base>& x) {
+        std::vector<ADCGD> xa(x.size());
+        for (size_t j = 0; j < x.size(); j++)
+            xa[j] = x[j];
+
+        CppAD::Independent(xa);
+
+        std::vector<ADCGD> y = evaluate(xa);
+
+        ADFun<CGD>* fun = new ADFun<CGD>();
+        fun->Dependent(y);
+        return fun;
+    }
+
+    inline void measureCodeHandler(ADFun<CGD>& fun,
+                                   const std::vector<Base>& x) {
+        using namespace std::chrono;
+
+        CodeHandler<Base> handler;
+
+        std::vector<CGD> xx(x.size());
+        handler.makeVariables(xx);
+        for (size_t j = 0; j < x.size(); j++)
+            xx[j].setValue(x[j]);
+
+        auto t0 = steady_clock::now();
+        std::vector<CGD> yy = fun.Forward(0, xx);
+        phases_["operation_graph"].push_back(steady_clock::now() - t0);
+
+        BenchmarkLanguageC<Base> langC("double");
+        LangCDefaultVariableNameGenerator<Base> nameGen;
+        std::vector<std::string> atomicFunctions;
+        std::ostringstream code;
+
+        t0 = steady_clock::now();
+        handler.generateCode(code, langC, yy, nameGen, atomicFunctions);
+        duration total = steady_clock::now() - t0;
+
+        phases_["graph_optimization"].push_back(total - langC.emission);
+        phases_["c_emission"].push_back(langC.emission);
+    }
+
+    inline void createDynamicLib(ADFun<CGD>& fun,
+                                 const std::vector<Base>& x) {
+        using namespace std::chrono;
+
+        listener_.reset();
+
+        ModelCSourceGen<Base> modelSourceGen(fun, name_);
+        modelSourceGen.setTypicalIndependentValues(x);
+        modelSourceGen.setCreateForwardZero(zeroOrder);
+        modelSourceGen.setCreateJacobian(jacobian);
+        modelSourceGen.setCreateHessian(hessian);
+        modelSourceGen.setCreateSparseJacobian(sparseJacobian);
+        modelSourceGen.setCreateSparseHessian(sparseHessian);
+        modelSourceGen.setCreateForwardOne(forwardOne);
+        modelSourceGen.setCreateReverseOne(reverseOne);
+        modelSourceGen.setCreateReverseTwo(reverseTwo);
+
+        ModelLibraryCSourceGen<Base> libSourceGen(modelSourceGen);
+        libSourceGen.addListener(listener_);
+
+        std::string libName = "benchmark_" + name_;
+        DynamicModelLibraryProcessor<Base> p(libSourceGen, libName);
+        GccCompiler<Base> compiler;
+        if (!compileFlags_.empty())
+            compiler.setCompileFlags(compileFlags_);
+
+        p.createDynamicLibrary(compiler, false);
+
+        phases_["derivative_graphs"].push_back(listener_.get(JobTimer::GRAPH));
+        phases_["source_generation"].push_back(listener_.get(JobTimer::SOURCE_FOR_MODEL));
+        phases_["compilation"].push_back(listener_.get(JobTimer::COMPILING));
+        phases_["linking"].push_back(listener_.get(JobTimer::COMPILING_DYNAMIC_LIBRARY));
+        phases_["library_total"].push_back(listener_.get(JobTimer::DYNAMIC_MODEL_LIBRARY));
+
+        /**
+         * load the library (dlopen) and the model (function symbols)
+         */
+        model_.reset();
+        dynamicLib_.reset();
+
+        auto t0 = steady_clock::now();
+#if CPPAD_CG_SYSTEM_LINUX
+        dynamicLib_.reset(new LinuxDynamicLib<Base>(libName + system::SystemInfo<>::DYNAMIC_LIB_EXTENSION));
+#else
+        throw CGException("Loading dynamic libraries is not supported on this system");
+#endif
+        phases_["library_load"].push_back(steady_clock::now() - t0);
+
+        t0 = steady_clock::now();
+        model_ = dynamicLib_->model(name_);
+        phases_["model_load"].push_back(steady_clock::now() - t0);
+
+        for (GenericModel<Base>* atom : getExternalModels())
+            model_->addExternalModel(*atom);
+
+#if CPPADCG_BENCHMARK_LLVM
+        if (jit) {
+            listener_.reset();
+            std::unique_ptr<LlvmModelLibrary<Base> > llvmLib = LlvmModelLibraryProcessor<Base>::create(libSourceGen);
+            phases_["jit"].push_back(listener_.get(JobTimer::JIT_MODEL_LIBRARY));
+        }
+#endif
+    }
+
+    template<class Function>
+    inline void measureEvaluation(const std::string& function,
+                                  Function f) {
+        using namespace std::chrono;
+
+        std::vector<duration>& dt = evaluation_[function];
+        dt.resize(nTimes_);
+        f(); // warm up
+        for (size_t i = 0; i < nTimes_; i++) {
+            auto t0 = steady_clock::now();
+            f();
+            dt[i] = steady_clock::now() - t0;
+        }
+    }
+
+    inline void evaluationSpeed(const std::vector<Base>& x) {
+        const size_t n = model_->Domain();
+        const size_t m = model_->Range();
+        const ArrayView<const Base> xv(x);
+
+        std::vector<Base> w(m, 1.0);
+        std::vector<Base> y(m);
+
+        if (zeroOrder) {
+            measureEvaluation("ForwardZero", [&]() {
+                model_->ForwardZero(x, y);
+            });
+        }
+
+        if (jacobian) {
+            std::vector<Base> jac(m * n);
+            measureEvaluation("Jacobian", [&]() {
+                model_->Jacobian(x, jac);
+            });
+        }
+
+        if (hessian) {
+            std::vector<Base> hess(n * n);
+            measureEvaluation("Hessian", [&]() {
+                model_->Hessian(x, w, hess);
+            });
+        }
+
+        if (sparseJacobian) {
+            std::vector<Base> jac;
+            std::vector<size_t> rows, cols;
+            measureEvaluation("SparseJacobian", [&]() {
+                model_->SparseJacobian(x, jac, rows, cols);
+            });
+        }
+
+        if (sparseHessian) {
+            std::vector<Base> hess;
+            std::vector<size_t> rows, cols;
+            measureEvaluation("SparseHessian", [&]() {
+                model_->SparseHessian(x, w, hess, rows, cols);
+            });
+        }
+
+        // directional functions (a single direction)
+        const size_t idx[1] = {0};
+        const Base one[1] = {1.0};
+
+        if (forwardOne) {
+            std::vector<Base> ty1(m);
+            measureEvaluation("ForwardOne", [&]() {
+                model_->ForwardOne(xv, 1, idx, one, ty1);
+            });
+        }
+
+        if (reverseOne) {
+            std::vector<Base> px(n);
+            measureEvaluation("ReverseOne", [&]() {
+                model_->ReverseOne(xv, px, 1, idx, one);
+            });
+        }
+
+        if (reverseTwo) {
+            std::vector<Base> px2(n);
+            measureEvaluation("ReverseTwo", [&]() {
+                model_->ReverseTwo(xv, 1, idx, one, px2, w);
+            });
+        }
+    }
+
+    static inline void printJSONStat(std::ostream& out,
+                                     const std::vector<duration>& dt) {
+        using namespace std::chrono;
+
+        std::vector<double> t(dt.size());
+        for (size_t i = 0; i < dt.size(); i++)
+            t[i] = duration_cast<std::chrono::duration<double> >(dt[i]).count();
+        std::sort(t.begin(), t.end());
+
+        double total = 0;
+        for (double ti : t)
+            total += ti;
+
+        out << "{\"samples\": " << t.size();
+        if (!t.empty()) {
+            out << ", \"min\": " << t.front()
+                    << ", \"median\": " << t[t.size() / 2]
+                    << ", \"mean\": " << total / t.size()
+                    << ", \"max\": " << t.back();
+        }
+        out << "}";
+    }
+
+    static inline void printJSONSection(std::ostream& out,
+                                        const std::string& name,
+                                        const std::map<std::string, std::vector<duration> >& stats) {
+        out << "  \"" << name << "\": {";
+        for (auto it = stats.begin(); it != stats.end(); ++it) {
+            if (it != stats.begin())
+                out << ",";
+            out << "\n    \"" << it->first << "\": ";
+            printJSONStat(out, it->second);
+        }
+        out << "\n  }";
+    }
+
+    inline void printJSON(std::ostream& out,
+                          size_t n) const {
+        OStreamConfigRestore osr(out);
+        out << std::setprecision(9);
+
+        out << "{\n"
+                "  \"model\": \"" << name_ << "\",\n"
+                "  \"size\": " << size_ << ",\n"
+                "  \"n\": " << n << ",\n"
+                "  \"m\": " << (model_ != nullptr ? model_->Range() : 0) << ",\n"
+                "  \"units\": \"s\",\n";
+        printJSONSection(out, "phases", phases_);
+        out << ",\n";
+        printJSONSection(out, "evaluation", evaluation_);
+        out << "\n}\n";
+    }
+
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+#endif
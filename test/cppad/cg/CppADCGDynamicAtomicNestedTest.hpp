@@ -38,6 +38,7 @@ protected:
     bool forwardOne = true;
     bool reverseOne = true;
     bool reverseTwo = true;
+    bool directAtomicCalls = false;
 public:
 
     inline CppADCGDynamicAtomicNestedTest(const std::string& modelName,
@@ -631,7 +632,8 @@ private:
          * generate source code
          */
         ModelLibraryCSourceGen<double> compDynHelp(compHelp1, compHelp2);
-        std::string folder = std::string("nested_sources_atomiclibmodelbridge_") + (createOuterReverse2 ? "rev2_" : "dir_") + _modelName;
+        compDynHelp.setDirectAtomicCalls(directAtomicCalls);
+        std::string folder = std::string("nested_sources_atomiclibmodelbridge_") + (createOuterReverse2 ? "rev2_" : "dir_") + (directAtomicCalls ? "inline_" : "") + _modelName;
         SaveFilesModelLibraryProcessor<double>::saveLibrarySourcesTo(compDynHelp, folder);
 
         /**
@@ -39,9 +39,13 @@ protected:
     MultiThreadingType _multithread;
     bool _multithreadDisabled;
     ThreadPoolScheduleStrategy _multithreadScheduler;
+    const CppADCGThPoolExecutor* _threadPoolExecutor = nullptr;
+    float _threadPoolSpinTime = 0;
     std::vector<Base> _xTape;
     std::vector<double> _xRun;
     size_t _maxAssignPerFunc = 100;
+    bool _minimizeLiveTemps = false;
+    bool _localFunctionTasks = false;
     double epsilonR = 1e-14;
     double epsilonA = 1e-14;
     std::vector<double> _xNorm;
@@ -120,6 +124,8 @@ public:
         modelSourceGen.setCreateReverseOne(_reverseOne);
         modelSourceGen.setCreateReverseTwo(_reverseTwo);
         modelSourceGen.setMaxAssignmentsPerFunc(_maxAssignPerFunc);
+        modelSourceGen.setMinimizeLiveTemporaries(_minimizeLiveTemps);
+        modelSourceGen.setLocalFunctionTasks(_localFunctionTasks);
         modelSourceGen.setMultiThreading(true);
 
         if (!_jacRow.empty())
@@ -156,6 +162,10 @@ public:
         _dynamicLib->setThreadPoolDisabled(_multithreadDisabled);
         _dynamicLib->setThreadPoolSchedulerStrategy(_multithreadScheduler);
         _dynamicLib->setThreadPoolGuidedMaxWork(0.75);
+        _dynamicLib->setThreadPoolSpinTime(_threadPoolSpinTime);
+        if (_threadPoolExecutor != nullptr) {
+            _dynamicLib->setThreadPoolExecutor(_threadPoolExecutor);
+        }
 
         /**
          * test the library
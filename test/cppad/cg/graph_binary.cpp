@@ -0,0 +1,273 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+#include "CppADCGTest.hpp"
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+namespace {
+
+void atomicFunction(const std::vector<AD<double> >& x,
+                    std::vector<AD<double> >& y) {
+    y[0] = x[0] * x[1];
+    y[1] = 2 * x[1] * x[1];
+}
+
+}
+
+class CppADCGGraphBinaryTest : public CppADCGTest {
+protected:
+
+    static std::unique_ptr<ADFun<CGD> > tape() {
+        std::vector<ADCGD> x(4, 1.0);
+        CppAD::Independent(x);
+
+        std::vector<ADCGD> y(4);
+        ADCGD a = x[0] * x[1] + 2.5;
+        y[0] = a + sin(x[2]);
+        y[1] = CondExpLt(x[0], x[1], x[2] / x[3], exp(a));
+        y[2] = pow(x[3], 3.0) - a;
+        y[3] = 1.5; // parameter
+
+        return std::unique_ptr<ADFun<CGD> >(new ADFun<CGD>(x, y));
+    }
+
+    /**
+     * A model which calls an atomic function
+     */
+    static std::unique_ptr<ADFun<CGD> > tapeAtomic(atomic_base<CGD>& atomic) {
+        std::vector<ADCGD> x(3, 1.0);
+        CppAD::Independent(x);
+
+        std::vector<ADCGD> ax{x[0], x[1]};
+        std::vector<ADCGD> ay(2);
+        atomic(ax, ay);
+
+        std::vector<ADCGD> y(2);
+        y[0] = ay[0] + x[2];
+        y[1] = ay[1] * x[0];
+
+        return std::unique_ptr<ADFun<CGD> >(new ADFun<CGD>(x, y));
+    }
+
+    /**
+     * Provides the record of the first saved node with a given operation
+     */
+    static GraphBinaryFormat::NodeRecord* findNode(std::vector<uint64_t>& buffer,
+                                                   CGOpCode op) {
+        const auto& h = *reinterpret_cast<const GraphBinaryFormat::Header*>(buffer.data());
+        auto* records = reinterpret_cast<GraphBinaryFormat::NodeRecord*>(buffer.data() + sizeof(GraphBinaryFormat::Header) / 8);
+        for (size_t i = 0; i < h.nodes; ++i) {
+            if (records[i].op == uint64_t(op))
+                return &records[i];
+        }
+        return nullptr;
+    }
+
+    /**
+     * Provides the saved information values of all nodes
+     */
+    static uint64_t* infoSection(std::vector<uint64_t>& buffer) {
+        const auto& h = *reinterpret_cast<const GraphBinaryFormat::Header*>(buffer.data());
+        return buffer.data() + (sizeof(GraphBinaryFormat::Header) + h.nodes * sizeof(GraphBinaryFormat::NodeRecord)) / 8;
+    }
+
+    static std::string generateSource(CodeHandler<double>& handler,
+                                      std::vector<CGD>& dep) {
+        std::vector<std::string> atomicFunctions;
+        return generateSource(handler, dep, atomicFunctions);
+    }
+
+    static std::string generateSource(CodeHandler<double>& handler,
+                                      std::vector<CGD>& dep,
+                                      std::vector<std::string>& atomicFunctions) {
+        LanguageC<double> langC("double");
+        LangCDefaultVariableNameGenerator<double> nameGen;
+
+        std::ostringstream code;
+        handler.generateCode(code, langC, dep, nameGen, atomicFunctions);
+        return code.str();
+    }
+
+    /**
+     * Saves the graph of a model, loads it into a new code handler, and
+     * compares the generated source code of both graphs
+     */
+    static void testWriteRead(bool useFile) {
+        std::unique_ptr<ADFun<CGD> > fun = tape();
+
+        CodeHandler<double> handler;
+        std::vector<CGD> x(fun->Domain());
+        handler.makeVariables(x);
+        x[1].getOperationNode()->setName("x_1");
+
+        std::vector<CGD> y = fun->Forward(0, x);
+
+        std::stringstream stream;
+        GraphBinaryWriter<double>::write(stream, handler, x, y);
+
+        std::string expected = generateSource(handler, y);
+
+        std::string data = stream.str();
+        std::vector<uint64_t> buffer((data.size() + 7) / 8); // aligned memory
+        memcpy(buffer.data(), data.data(), data.size());
+
+        std::string file = "graph_binary_test.cgg";
+        std::unique_ptr<MappedFile> mapped;
+        std::unique_ptr<GraphBinaryReader<double> > reader;
+        if (useFile) {
+            std::ofstream out(file, std::ios::binary);
+            out << data;
+            out.close();
+            mapped.reset(new MappedFile(file));
+            reader.reset(new GraphBinaryReader<double>(*mapped));
+        } else {
+            reader.reset(new GraphBinaryReader<double>(reinterpret_cast<const char*>(buffer.data()), data.size()));
+        }
+
+        ASSERT_EQ(reader->getIndependentCount(), x.size());
+        ASSERT_EQ(reader->getDependentCount(), y.size());
+        ASSERT_TRUE(reader->getAtomicFunctionNames().empty());
+
+        CodeHandler<double> handler2;
+        std::vector<CGD> x2;
+        std::vector<CGD> y2 = reader->load(handler2, x2);
+
+        ASSERT_EQ(x2.size(), x.size());
+        ASSERT_EQ(y2.size(), y.size());
+        ASSERT_TRUE(y2[3].isParameter());
+        ASSERT_EQ(y2[3].getValue(), 1.5);
+        ASSERT_NE(x2[1].getOperationNode()->getName(), nullptr);
+        ASSERT_EQ(*x2[1].getOperationNode()->getName(), "x_1");
+
+        ASSERT_EQ(generateSource(handler2, y2), expected);
+
+        reader.reset();
+        mapped.reset();
+        if (useFile) {
+            std::remove(file.c_str());
+        }
+    }
+};
+
+TEST_F(CppADCGGraphBinaryTest, Memory) {
+    testWriteRead(false);
+}
+
+TEST_F(CppADCGGraphBinaryTest, MappedFile) {
+    testWriteRead(true);
+}
+
+TEST_F(CppADCGGraphBinaryTest, Invalid) {
+    std::unique_ptr<ADFun<CGD> > fun = tape();
+
+    CodeHandler<double> handler;
+    std::vector<CGD> x(fun->Domain());
+    handler.makeVariables(x);
+    std::vector<CGD> y = fun->Forward(0, x);
+
+    std::stringstream stream;
+    GraphBinaryWriter<double>::write(stream, handler, x, y);
+    std::string data = stream.str();
+
+    std::vector<uint64_t> buffer((data.size() + 7) / 8);
+    memcpy(buffer.data(), data.data(), data.size());
+    const char* aligned = reinterpret_cast<const char*>(buffer.data());
+
+    // truncated
+    ASSERT_THROW(GraphBinaryReader<double>(aligned, data.size() / 2), CGException);
+
+    // different base type
+    ASSERT_THROW(GraphBinaryReader<float>(aligned, data.size()), CGException);
+
+    // operation with an invalid number of arguments
+    std::vector<uint64_t> corrupted = buffer;
+    GraphBinaryFormat::NodeRecord* mul = findNode(corrupted, CGOpCode::Mul);
+    ASSERT_TRUE(mul != nullptr);
+    mul->argsSize = 0;
+    GraphBinaryReader<double> corruptedReader(reinterpret_cast<const char*>(corrupted.data()), data.size());
+    CodeHandler<double> handler2;
+    std::vector<CGD> x2;
+    ASSERT_THROW(corruptedReader.load(handler2, x2), CGException);
+
+    // missing independent variables
+    std::vector<CGD> xPart(x.begin(), x.begin() + 1);
+    std::stringstream stream2;
+    ASSERT_THROW(GraphBinaryWriter<double>::write(stream2, handler, xPart, y), CGException);
+}
+
+TEST_F(CppADCGGraphBinaryTest, AtomicFunction) {
+    std::vector<AD<double> > ax(2, 1.0);
+    std::vector<AD<double> > ay(2);
+    checkpoint<double> atomicFun("atomicFunc", atomicFunction, ax, ay);
+    CGAtomicFun<double> cgAtomicFun(atomicFun, ax, true);
+
+    std::unique_ptr<ADFun<CGD> > fun = tapeAtomic(cgAtomicFun);
+
+    CodeHandler<double> handler;
+    std::vector<CGD> x(fun->Domain());
+    handler.makeVariables(x);
+    std::vector<CGD> y = fun->Forward(0, x);
+    ASSERT_EQ(handler.getAtomicFunctions().size(), 1u);
+
+    std::stringstream stream;
+    GraphBinaryWriter<double>::write(stream, handler, x, y);
+
+    std::vector<std::string> atomicNames;
+    std::string expected = generateSource(handler, y, atomicNames);
+    ASSERT_EQ(atomicNames, std::vector<std::string>{"atomicFunc"});
+
+    std::string data = stream.str();
+    std::vector<uint64_t> buffer((data.size() + 7) / 8); // aligned memory
+    memcpy(buffer.data(), data.data(), data.size());
+    GraphBinaryReader<double> reader(reinterpret_cast<const char*>(buffer.data()), data.size());
+
+    ASSERT_EQ(reader.getAtomicFunctionNames(), std::vector<std::string>{"atomicFunc"});
+
+    // the same atomic function with a different ID
+    CGAtomicFun<double> cgAtomicFun2(atomicFun, ax, true);
+    ASSERT_NE(cgAtomicFun2.getId(), cgAtomicFun.getId());
+
+    CodeHandler<double> handler2;
+    std::vector<CGD> x2;
+    std::vector<CGD> y2 = reader.load(handler2, x2, {&cgAtomicFun2});
+
+    ASSERT_EQ(x2.size(), x.size());
+    ASSERT_EQ(y2.size(), y.size());
+    const auto& atomics2 = handler2.getAtomicFunctions();
+    ASSERT_EQ(atomics2.size(), 1u);
+    ASSERT_TRUE(atomics2.find(cgAtomicFun2.getId()) != atomics2.end());
+
+    std::vector<std::string> atomicNames2;
+    ASSERT_EQ(generateSource(handler2, y2, atomicNames2), expected);
+    ASSERT_EQ(atomicNames2, atomicNames);
+
+    // the atomic function is not provided
+    CodeHandler<double> handler3;
+    std::vector<CGD> x3;
+    ASSERT_THROW(reader.load(handler3, x3), CGException);
+
+    // array element outside of the array
+    std::vector<uint64_t> corrupted = buffer;
+    GraphBinaryFormat::NodeRecord* element = findNode(corrupted, CGOpCode::ArrayElement);
+    ASSERT_TRUE(element != nullptr);
+    ASSERT_EQ(element->infoSize, 1u);
+    infoSection(corrupted)[element->info] = 1000;
+    GraphBinaryReader<double> corruptedReader(reinterpret_cast<const char*>(corrupted.data()), data.size());
+    CodeHandler<double> handler4;
+    std::vector<CGD> x4;
+    ASSERT_THROW(corruptedReader.load(handler4, x4, {&cgAtomicFun2}), CGException);
+}
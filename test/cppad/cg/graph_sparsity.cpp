@@ -0,0 +1,83 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+#include "CppADCGTest.hpp"
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+class CppADCGGraphSparsityTest : public CppADCGTest {
+protected:
+    using SparsitySetType = std::vector<std::set<size_t> >;
+
+    /**
+     * Compares the sparsity patterns determined from the operation graph
+     * with the ones provided by CppAD
+     */
+    void compareWithCppAD(ADFun<CGD>& fun) {
+        size_t m = fun.Range();
+
+        GraphSparsity<double> graph(fun);
+        ASSERT_TRUE(graph.isSupported());
+
+        compareVectorSetValues(jacobianSparsitySet<SparsitySetType, CGD>(fun),
+                               graph.getJacobianSparsity());
+
+        compareVectorSetValues(hessianSparsitySet<SparsitySetType, CGD>(fun),
+                               graph.getHessianSparsity());
+
+        const std::vector<SparsitySetType>& hessians = graph.getHessianSparsities();
+        ASSERT_EQ(hessians.size(), m);
+        for (size_t i = 0; i < m; ++i) {
+            compareVectorSetValues(hessianSparsitySet<SparsitySetType, CGD>(fun, i),
+                                   hessians[i]);
+        }
+    }
+};
+
+TEST_F(CppADCGGraphSparsityTest, Operations) {
+    std::vector<ADCGD> x(5, 1.0);
+    CppAD::Independent(x);
+
+    ADCGD a = x[0] * x[1]; // shared by several equations
+
+    std::vector<ADCGD> y(5);
+    y[0] = a + sin(x[2]);
+    y[1] = x[3] / x[4] + x[0];
+    y[2] = CondExpLt(x[0], x[1], x[2] * x[3], exp(x[4]));
+    y[3] = pow(x[1], x[2]) + 2.0 * a;
+    y[4] = x[4] - x[0];
+
+    ADFun<CGD> fun(x, y);
+
+    compareWithCppAD(fun);
+}
+
+TEST_F(CppADCGGraphSparsityTest, LongChain) {
+    std::vector<ADCGD> x(3, 1.0);
+    CppAD::Independent(x);
+
+    std::vector<ADCGD> y(2);
+    ADCGD v = x[0];
+    for (size_t k = 0; k < 10000; ++k) {
+        v = v * 1.5 + x[1];
+    }
+    y[0] = v;
+    y[1] = v * x[2];
+
+    ADFun<CGD> fun(x, y);
+
+    compareWithCppAD(fun);
+}
@@ -0,0 +1,86 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+#include "CppADCGTest.hpp"
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+TEST_F(CppADCGTest, JobProfilerHierarchy) {
+    JobTimer timer;
+    JobProfiler profiler;
+    timer.addListener(profiler);
+
+    timer.startingJob("'model'", JobTimer::SOURCE_FOR_MODEL);
+    for (size_t i = 0; i < 2; ++i) {
+        timer.startingJob("'jacobian'", JobTimer::GRAPH);
+        timer.addNodeCount(10);
+        timer.addSourceBytes(100);
+        timer.finishedJob();
+    }
+    timer.finishedJob();
+
+    const std::vector<JobProfiler::Event>& events = profiler.getEvents();
+    ASSERT_EQ(events.size(), 3u);
+    ASSERT_EQ(events[0].depth, 0u);
+    ASSERT_EQ(events[0].parent, -1);
+    ASSERT_EQ(events[1].parent, 0);
+    ASSERT_EQ(events[2].parent, 0);
+    ASSERT_EQ(events[1].nodes, 10u);
+    ASSERT_EQ(events[0].nodes, 20u); // includes nested jobs
+    ASSERT_EQ(events[0].sourceBytes, 200u);
+
+    std::vector<JobProfiler::FlatProfileEntry> profile = profiler.getFlatProfile();
+    ASSERT_EQ(profile.size(), 2u);
+    size_t calls = 0;
+    for (const auto& e : profile) {
+        calls += e.calls;
+        ASSERT_TRUE(e.self <= e.total);
+    }
+    ASSERT_EQ(calls, 3u);
+
+    std::ostringstream trace;
+    profiler.writeChromeTrace(trace);
+    std::string json = trace.str();
+    ASSERT_NE(json.find("\"traceEvents\""), std::string::npos);
+    ASSERT_NE(json.find("\"name\": \"'jacobian'\""), std::string::npos);
+    ASSERT_NE(json.find("\"nodes\": 20"), std::string::npos);
+}
+
+TEST_F(CppADCGTest, JobProfilerCodeHandler) {
+    JobTimer timer;
+    JobProfiler profiler;
+    timer.addListener(profiler);
+
+    CodeHandler<double> handler;
+    handler.setJobTimer(&timer);
+
+    std::vector<CGD> x(2);
+    handler.makeVariables(x);
+
+    std::vector<CGD> y{x[0] * x[1] + x[0]};
+
+    LanguageC<double> langC("double");
+    LangCDefaultVariableNameGenerator<double> nameGen;
+
+    std::ostringstream code;
+    handler.generateCode(code, langC, y, nameGen);
+
+    const std::vector<JobProfiler::Event>& events = profiler.getEvents();
+    ASSERT_EQ(events.size(), 1u);
+    ASSERT_TRUE(events[0].finished);
+    ASSERT_EQ(events[0].nodes, handler.getManagedNodesCount());
+    ASSERT_EQ(events[0].sourceBytes, code.str().size());
+}
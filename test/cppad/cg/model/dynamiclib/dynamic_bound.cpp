@@ -0,0 +1,96 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+#include "CppADCGTest.hpp"
+#include "gccCompilerFlags.hpp"
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+TEST_F(CppADCGTest, BoundModelFunction) {
+    using CGD = CG<double>;
+    using ADCG = AD<CGD>;
+
+    const size_t n = 3;
+    const size_t m = 2;
+
+    std::vector<ADCG> u(n);
+    for (size_t j = 0; j < n; j++)
+        u[j] = 1.0;
+    CppAD::Independent(u);
+
+    std::vector<ADCG> y(m);
+    y[0] = exp(u[0]) * u[1] + u[2] * u[2];
+    y[1] = sin(u[1]) * u[2] - u[0] / u[2];
+
+    ADFun<CGD> fun(u, y);
+
+    ModelCSourceGen<double> compHelp(fun, "model_bound");
+    compHelp.setCreateJacobian(true);
+    compHelp.setCreateHessian(true);
+    compHelp.setCreateSparseJacobian(true);
+    compHelp.setCreateSparseHessian(true);
+
+    ModelLibraryCSourceGen<double> compDynHelp(compHelp);
+
+    DynamicModelLibraryProcessor<double> p(compDynHelp, "model_bound");
+
+    GccCompiler<double> compiler;
+    prepareTestCompilerFlags(compiler);
+
+    std::unique_ptr<DynamicLib<double>> lib = p.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> model = lib->model("model_bound");
+
+    ASSERT_TRUE(model->isBindAvailable());
+
+    std::vector<double> x(n), w{1.0, -2.0};
+    std::vector<double> yb(m), jac(m * n);
+
+    BoundModelFunction<double> zero = model->bindForwardZero(x, yb);
+    BoundModelFunction<double> jacobian = model->bindJacobian(x, jac);
+    ASSERT_TRUE(zero.isBound());
+
+    size_t const* jrow, * jcol;
+    size_t const* hrow, * hcol;
+    std::vector<size_t> jr, jc, hr, hc;
+    model->JacobianSparsity(jr, jc);
+    model->HessianSparsity(hr, hc);
+    std::vector<double> sjac(jr.size()), shess(hr.size());
+    BoundModelFunction<double> sparseJac = model->bindSparseJacobian(x, sjac, &jrow, &jcol);
+    BoundModelFunction<double> sparseHess = model->bindSparseHessian(x, w, shess, &hrow, &hcol);
+
+    // the same arrays are used with different values
+    for (size_t k = 0; k < 3; k++) {
+        for (size_t j = 0; j < n; j++)
+            x[j] = 0.5 + j + 0.25 * k;
+
+        zero();
+        jacobian();
+        sparseJac();
+        sparseHess();
+
+        std::vector<double> yExpected = model->ForwardZero(x);
+        std::vector<double> jacExpected = model->Jacobian(x);
+        std::vector<double> hessExpected = model->Hessian(x, w);
+
+        for (size_t i = 0; i < m; i++)
+            ASSERT_NEAR(yb[i], yExpected[i], 1e-10);
+        for (size_t e = 0; e < jac.size(); e++)
+            ASSERT_NEAR(jac[e], jacExpected[e], 1e-10);
+        for (size_t e = 0; e < sjac.size(); e++)
+            ASSERT_NEAR(sjac[e], jacExpected[jrow[e] * n + jcol[e]], 1e-10);
+        for (size_t e = 0; e < shess.size(); e++)
+            ASSERT_NEAR(shess[e], hessExpected[hrow[e] * n + hcol[e]], 1e-10);
+    }
+}
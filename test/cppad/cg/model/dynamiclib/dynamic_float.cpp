@@ -0,0 +1,104 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+#include "CppADCGTest.hpp"
+#include "gccCompilerFlags.hpp"
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+namespace {
+
+void testSinglePrecision(bool reuseOtherModes) {
+    using CGD = CG<double>;
+    using ADCG = AD<CGD>;
+
+    std::vector<double> x{0.5, 1.5, 2.5};
+
+    std::vector<ADCG> u(x.size());
+    for (size_t j = 0; j < x.size(); j++)
+        u[j] = x[j];
+    CppAD::Independent(u);
+
+    std::vector<ADCG> y(2);
+    y[0] = exp(u[0]) * u[1] + 0.1 * u[2];
+    y[1] = sin(u[1]) * u[2] * u[2] - pow(u[0], 3);
+
+    ADFun<CGD> fun(u, y);
+
+    ModelCSourceGen<double> compHelp(fun, "model_float");
+    compHelp.setCreateSparseJacobian(true);
+    compHelp.setCreateSparseHessian(true);
+    compHelp.setCreateSparseJacobianFloat(true);
+    compHelp.setCreateSparseHessianFloat(true);
+    compHelp.setCreateForwardOne(reuseOtherModes);
+    compHelp.setCreateReverseTwo(reuseOtherModes);
+
+    ModelLibraryCSourceGen<double> compDynHelp(compHelp);
+
+    DynamicModelLibraryProcessor<double> p(compDynHelp, reuseOtherModes ? "model_float_reuse" : "model_float");
+
+    GccCompiler<double> compiler;
+    prepareTestCompilerFlags(compiler);
+
+    std::unique_ptr<DynamicLib<double>> lib = p.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> model = lib->model("model_float");
+
+    ASSERT_TRUE(model->isSparseJacobianFloatAvailable());
+    ASSERT_TRUE(model->isSparseHessianFloatAvailable());
+
+    /**
+     * Jacobian
+     */
+    std::vector<double> jac;
+    std::vector<size_t> row, col;
+    model->SparseJacobian(x, jac, row, col);
+
+    std::vector<float> jacFloat(jac.size());
+    size_t const* rowFloat;
+    size_t const* colFloat;
+    model->SparseJacobianFloat(x, jacFloat, &rowFloat, &colFloat);
+
+    for (size_t e = 0; e < jac.size(); e++) {
+        ASSERT_EQ(row[e], rowFloat[e]);
+        ASSERT_EQ(col[e], colFloat[e]);
+        ASSERT_NEAR(jac[e], jacFloat[e], 1e-5 * std::max(1.0, std::abs(jac[e])));
+    }
+
+    /**
+     * Hessian
+     */
+    std::vector<double> w{1.0, 2.0};
+    std::vector<double> hess;
+    model->SparseHessian(x, w, hess, row, col);
+
+    std::vector<float> hessFloat(hess.size());
+    model->SparseHessianFloat(x, w, hessFloat, &rowFloat, &colFloat);
+
+    for (size_t e = 0; e < hess.size(); e++) {
+        ASSERT_EQ(row[e], rowFloat[e]);
+        ASSERT_EQ(col[e], colFloat[e]);
+        ASSERT_NEAR(hess[e], hessFloat[e], 1e-5 * std::max(1.0, std::abs(hess[e])));
+    }
+}
+
+}
+
+TEST_F(CppADCGTest, SinglePrecisionSparse) {
+    testSinglePrecision(false);
+}
+
+TEST_F(CppADCGTest, SinglePrecisionSparseReuse) {
+    testSinglePrecision(true);
+}
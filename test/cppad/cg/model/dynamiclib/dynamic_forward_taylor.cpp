@@ -0,0 +1,126 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+#include "CppADCGTest.hpp"
+#include "gccCompilerFlags.hpp"
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+namespace {
+
+template<class T>
+std::vector<T> taylorModel(const std::vector<T>& u) {
+    std::vector<T> y(2);
+    y[0] = exp(u[0]) * u[1] + sqrt(u[2]);
+    y[1] = sin(u[1]) * u[2] / u[0] + pow(u[0], 3);
+    return y;
+}
+
+void atomicFunction(const std::vector<AD<double> >& x,
+                    std::vector<AD<double> >& y) {
+    y[0] = x[0] * x[1];
+}
+
+}
+
+TEST_F(CppADCGTest, ForwardTaylor) {
+    using CGD = CG<double>;
+    using ADCG = AD<CGD>;
+
+    const size_t n = 3;
+    const size_t m = 2;
+    const size_t q = 3;
+
+    std::vector<double> x{0.5, 1.5, 2.5};
+
+    // reference
+    std::vector<AD<double>> ax(x.begin(), x.end());
+    CppAD::Independent(ax);
+    std::vector<AD<double>> ay = taylorModel(ax);
+    ADFun<double> funD(ax, ay);
+
+    // compiled model
+    std::vector<ADCG> u(n);
+    for (size_t j = 0; j < n; j++)
+        u[j] = x[j];
+    CppAD::Independent(u);
+    std::vector<ADCG> y = taylorModel(u);
+    ADFun<CGD> fun(u, y);
+
+    ModelCSourceGen<double> compHelp(fun, "model_taylor");
+    compHelp.setCreateForwardTaylor(q);
+
+    ModelLibraryCSourceGen<double> compDynHelp(compHelp);
+
+    DynamicModelLibraryProcessor<double> p(compDynHelp, "model_taylor");
+
+    GccCompiler<double> compiler;
+    prepareTestCompilerFlags(compiler);
+
+    std::unique_ptr<DynamicLib<double>> lib = p.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> model = lib->model("model_taylor");
+
+    ASSERT_TRUE(model->isForwardTaylorAvailable());
+    ASSERT_EQ(model->getForwardTaylorOrder(), q);
+
+    // all orders up to the compiled one
+    for (size_t p = 0; p <= q; p++) {
+        std::vector<double> tx(n * (p + 1));
+        for (size_t j = 0; j < n; j++) {
+            tx[j * (p + 1)] = x[j];
+            for (size_t k = 1; k <= p; k++)
+                tx[j * (p + 1) + k] = 0.1 * (j + 1) / k;
+        }
+
+        std::vector<double> tyExpected = funD.Forward(p, tx);
+
+        std::vector<double> ty(m * (p + 1));
+        model->ForwardTaylor(p, tx, ty);
+
+        ASSERT_EQ(ty.size(), tyExpected.size());
+        for (size_t i = 0; i < ty.size(); i++) {
+            ASSERT_NEAR(ty[i], tyExpected[i], 1e-10);
+        }
+    }
+}
+
+TEST_F(CppADCGTest, ForwardTaylorAtomic) {
+    using CGD = CG<double>;
+    using ADCG = AD<CGD>;
+
+    std::vector<AD<double>> ax(2, 1.0);
+    std::vector<AD<double>> ay(1);
+    checkpoint<double> atomicFun("atomicFunc", atomicFunction, ax, ay);
+    CGAtomicFun<double> cgAtomicFun(atomicFun, ax, true);
+
+    std::vector<ADCG> u(2, 1.0);
+    CppAD::Independent(u);
+    std::vector<ADCG> y(1);
+    cgAtomicFun(u, y);
+    ADFun<CGD> fun(u, y);
+
+    // atomic functions do not provide second order coefficients
+    ModelCSourceGen<double> compHelp(fun, "model_taylor_atomic");
+    compHelp.setCreateForwardTaylor(2);
+
+    ModelLibraryCSourceGen<double> compDynHelp(compHelp);
+
+    DynamicModelLibraryProcessor<double> p(compDynHelp, "model_taylor_atomic");
+
+    GccCompiler<double> compiler;
+    prepareTestCompilerFlags(compiler);
+
+    ASSERT_THROW(p.createDynamicLibrary(compiler), CGException);
+}
@@ -0,0 +1,78 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+#include "CppADCGTest.hpp"
+#include "gccCompilerFlags.hpp"
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+TEST_F(CppADCGTest, HessianVectorProduct) {
+    using CGD = CG<double>;
+    using ADCG = AD<CGD>;
+
+    const size_t n = 3;
+    const size_t m = 2;
+    const size_t maxK = 2;
+
+    std::vector<double> x{0.5, 1.5, 2.5};
+    std::vector<double> w{2.0, -0.5};
+
+    std::vector<ADCG> u(n);
+    for (size_t j = 0; j < n; j++)
+        u[j] = x[j];
+    CppAD::Independent(u);
+
+    std::vector<ADCG> y(m);
+    y[0] = exp(u[0]) * u[1] + u[2] * u[2] * u[1];
+    y[1] = sin(u[1]) * u[2] - u[0] / u[2];
+
+    ADFun<CGD> fun(u, y);
+
+    ModelCSourceGen<double> compHelp(fun, "model_hv");
+    compHelp.setCreateHessian(true);
+    compHelp.setCreateHessianVectorProduct(true, maxK);
+
+    ModelLibraryCSourceGen<double> compDynHelp(compHelp);
+
+    DynamicModelLibraryProcessor<double> p(compDynHelp, "model_hv");
+
+    GccCompiler<double> compiler;
+    prepareTestCompilerFlags(compiler);
+
+    std::unique_ptr<DynamicLib<double>> lib = p.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> model = lib->model("model_hv");
+
+    ASSERT_TRUE(model->isHessianVectorProductAvailable());
+    ASSERT_EQ(model->getHessianVectorProductMaxVectors(), maxK);
+
+    std::vector<double> hess = model->Hessian(x, w);
+
+    // 3 vectors (one more than the compiled function evaluates per call)
+    const size_t k = 3;
+    std::vector<double> v{1, 0, 0,
+                          0.5, -1, 2,
+                          0, 0, 3};
+    std::vector<double> hv(n * k);
+    model->HessianVectorProduct(x, w, v, hv);
+
+    for (size_t d = 0; d < k; d++) {
+        for (size_t j = 0; j < n; j++) {
+            double expected = 0;
+            for (size_t l = 0; l < n; l++)
+                expected += hess[j * n + l] * v[d * n + l];
+            ASSERT_NEAR(hv[d * n + j], expected, 1e-10);
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+#include "CppADCGTest.hpp"
+#include "gccCompilerFlags.hpp"
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+TEST_F(CppADCGTest, MultiDirectionForwardReverse) {
+    using CGD = CG<double>;
+    using ADCG = AD<CGD>;
+
+    const size_t n = 3;
+    const size_t m = 2;
+    const size_t maxK = 2;
+
+    std::vector<double> x{0.5, 1.5, 2.5};
+
+    std::vector<ADCG> u(n);
+    for (size_t j = 0; j < n; j++)
+        u[j] = x[j];
+    CppAD::Independent(u);
+
+    std::vector<ADCG> y(m);
+    y[0] = exp(u[0]) * u[1] + 2.0 * u[2];
+    y[1] = sin(u[1]) * u[2] * u[2] - u[0] / u[2];
+
+    ADFun<CGD> fun(u, y);
+
+    ModelCSourceGen<double> compHelp(fun, "model_multi");
+    compHelp.setCreateJacobian(true);
+    compHelp.setCreateForwardOneMulti(maxK);
+    compHelp.setCreateReverseOneMulti(maxK);
+
+    ModelLibraryCSourceGen<double> compDynHelp(compHelp);
+
+    DynamicModelLibraryProcessor<double> p(compDynHelp, "model_multi");
+
+    GccCompiler<double> compiler;
+    prepareTestCompilerFlags(compiler);
+
+    std::unique_ptr<DynamicLib<double>> lib = p.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> model = lib->model("model_multi");
+
+    ASSERT_TRUE(model->isForwardOneMultiAvailable());
+    ASSERT_TRUE(model->isReverseOneMultiAvailable());
+    ASSERT_EQ(model->getForwardOneMultiMaxDirections(), maxK);
+    ASSERT_EQ(model->getReverseOneMultiMaxDirections(), maxK);
+
+    std::vector<double> jac = model->Jacobian(x);
+
+    // 3 directions (one more than the compiled function evaluates per call)
+    const size_t k = 3;
+
+    /**
+     * forward mode
+     */
+    std::vector<double> tx1{1, 0, 0,
+                            0.5, -1, 2,
+                            0, 0, 3};
+    std::vector<double> ty1(m * k);
+    model->ForwardOneMulti(x, tx1, ty1);
+
+    for (size_t d = 0; d < k; d++) {
+        for (size_t i = 0; i < m; i++) {
+            double expected = 0;
+            for (size_t j = 0; j < n; j++)
+                expected += jac[i * n + j] * tx1[d * n + j];
+            ASSERT_NEAR(ty1[d * m + i], expected, 1e-10);
+        }
+    }
+
+    /**
+     * reverse mode
+     */
+    std::vector<double> py{1, 0,
+                           0.5, 2,
+                           0, -1};
+    std::vector<double> px(n * k);
+    model->ReverseOneMulti(x, py, px);
+
+    for (size_t d = 0; d < k; d++) {
+        for (size_t j = 0; j < n; j++) {
+            double expected = 0;
+            for (size_t i = 0; i < m; i++)
+                expected += py[d * m + i] * jac[i * n + j];
+            ASSERT_NEAR(px[d * n + j], expected, 1e-10);
+        }
+    }
+}
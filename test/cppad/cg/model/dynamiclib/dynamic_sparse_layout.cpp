@@ -0,0 +1,231 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+#include "CppADCGTest.hpp"
+#include "gccCompilerFlags.hpp"
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+namespace {
+
+void checkCompressed(const std::vector<double>& values,
+                     size_t const* outer,
+                     size_t const* inner,
+                     size_t const* ptr,
+                     size_t ptrSize,
+                     const std::vector<double>& dense,
+                     size_t nOuter,
+                     size_t nInner,
+                     bool byRow) {
+    ASSERT_EQ(ptrSize, nOuter + 1);
+    ASSERT_EQ(ptr[0], 0u);
+    ASSERT_EQ(ptr[nOuter], values.size());
+
+    for (size_t k = 0; k < nOuter; k++) {
+        for (size_t e = ptr[k]; e < ptr[k + 1]; e++) {
+            ASSERT_EQ(outer[e], k);
+            if (e > ptr[k])
+                ASSERT_LT(inner[e - 1], inner[e]);
+
+            size_t pos = byRow ? k * nInner + inner[e] : inner[e] * nOuter + k;
+            ASSERT_NEAR(values[e], dense[pos], 1e-10);
+        }
+    }
+}
+
+void testSparseHessianTriangle(MatrixTriangle triangle,
+                               bool reverseTwo,
+                               MultiThreadingType multiThreading,
+                               const std::string& libName) {
+    using CGD = CG<double>;
+    using ADCG = AD<CGD>;
+
+    const size_t n = 4;
+    const size_t m = 2;
+
+    std::vector<double> x{0.5, 1.5, 2.5, 3.5};
+    std::vector<double> w{1.0, -2.0};
+
+    std::vector<ADCG> u(n);
+    for (size_t j = 0; j < n; j++)
+        u[j] = x[j];
+    CppAD::Independent(u);
+
+    std::vector<ADCG> y(m);
+    y[0] = exp(u[0]) * u[3] + u[1] * u[2];
+    y[1] = sin(u[1]) * u[2] * u[3] + u[0] * u[0];
+
+    ADFun<CGD> fun(u, y);
+
+    ModelCSourceGen<double> compHelp(fun, "model_triangle");
+    compHelp.setCreateHessian(true);
+    compHelp.setCreateSparseHessian(true);
+    compHelp.setCreateReverseTwo(reverseTwo);
+    compHelp.setMultiThreading(multiThreading != MultiThreadingType::NONE);
+    compHelp.setSparseHessianTriangle(triangle);
+
+    ModelLibraryCSourceGen<double> compDynHelp(compHelp);
+    compDynHelp.setMultiThreading(multiThreading);
+
+    DynamicModelLibraryProcessor<double> p(compDynHelp, libName);
+
+    GccCompiler<double> compiler;
+    prepareTestCompilerFlags(compiler);
+    if (multiThreading == MultiThreadingType::PTHREADS) {
+        compiler.addCompileFlag("-pthread");
+    }
+
+    std::unique_ptr<DynamicLib<double>> lib = p.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> model = lib->model("model_triangle");
+
+    ASSERT_EQ(model->getSparseHessianTriangle(), triangle);
+
+    std::vector<double> hessDense = model->Hessian(x, w);
+
+    std::vector<size_t> hr, hc;
+    model->HessianSparsity(hr, hc);
+    std::vector<double> hess(hr.size());
+    size_t const* row, * col;
+    model->SparseHessian(x, w, hess, &row, &col);
+
+    size_t nnzLower = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j <= i; j++) {
+            if (hessDense[i * n + j] != 0) // symmetric
+                nnzLower++;
+        }
+    }
+    ASSERT_EQ(hess.size(), nnzLower);
+
+    for (size_t e = 0; e < hess.size(); e++) {
+        if (triangle == MatrixTriangle::Lower) {
+            ASSERT_GE(row[e], col[e]);
+        } else {
+            ASSERT_LE(row[e], col[e]);
+        }
+        ASSERT_NEAR(hess[e], hessDense[row[e] * n + col[e]], 1e-10);
+    }
+
+    // the dense Hessian from the sparse one is complete
+    std::vector<double> hessDense2(n * n);
+    model->SparseHessian(x, w, hessDense2);
+    for (size_t e = 0; e < n * n; e++) {
+        ASSERT_NEAR(hessDense2[e], hessDense[e], 1e-10);
+    }
+
+    if (reverseTwo) {
+        // the second order reverse mode still provides complete rows
+        ASSERT_TRUE(model->isSparseReverseTwoAvailable());
+        std::vector<double> px(n);
+        for (size_t j = 0; j < n; j++) {
+            size_t idx[] = {j};
+            double tx1[] = {1.0};
+            model->ReverseTwo(ArrayView<const double>(x), 1, idx, tx1,
+                              ArrayView<double>(px), ArrayView<const double>(w));
+            for (size_t j2 = 0; j2 < n; j2++) {
+                ASSERT_NEAR(px[j2], hessDense[j * n + j2], 1e-10);
+            }
+        }
+    }
+}
+
+}
+
+TEST_F(CppADCGTest, SparseMatrixLayout) {
+    using CGD = CG<double>;
+    using ADCG = AD<CGD>;
+
+    const size_t n = 4;
+    const size_t m = 3;
+
+    std::vector<double> x{0.5, 1.5, 2.5, 3.5};
+    std::vector<double> w{1.0, -2.0, 0.5};
+
+    std::vector<ADCG> u(n);
+    for (size_t j = 0; j < n; j++)
+        u[j] = x[j];
+    CppAD::Independent(u);
+
+    std::vector<ADCG> y(m);
+    y[0] = exp(u[0]) * u[3];
+    y[1] = sin(u[1]) * u[2] + u[0];
+    y[2] = u[3] * u[3] * u[1] - u[2];
+
+    ADFun<CGD> fun(u, y);
+
+    ModelCSourceGen<double> compHelp(fun, "model_layout");
+    compHelp.setCreateJacobian(true);
+    compHelp.setCreateHessian(true);
+    compHelp.setCreateSparseJacobian(true);
+    compHelp.setCreateSparseHessian(true);
+    compHelp.setSparseJacobianLayout(SparseMatrixLayout::CompressedColumn);
+    compHelp.setSparseHessianLayout(SparseMatrixLayout::CompressedRow);
+
+    ModelLibraryCSourceGen<double> compDynHelp(compHelp);
+
+    DynamicModelLibraryProcessor<double> p(compDynHelp, "model_layout");
+
+    GccCompiler<double> compiler;
+    prepareTestCompilerFlags(compiler);
+
+    std::unique_ptr<DynamicLib<double>> lib = p.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> model = lib->model("model_layout");
+
+    ASSERT_EQ(model->getSparseJacobianLayout(), SparseMatrixLayout::CompressedColumn);
+    ASSERT_EQ(model->getSparseHessianLayout(), SparseMatrixLayout::CompressedRow);
+
+    /**
+     * Jacobian (CSC)
+     */
+    std::vector<double> jacDense = model->Jacobian(x);
+
+    std::vector<size_t> jr, jc;
+    model->JacobianSparsity(jr, jc);
+    std::vector<double> jac(jr.size());
+    size_t const* row, * col;
+    model->SparseJacobian(x, jac, &row, &col);
+
+    size_t const* ptr;
+    size_t ptrSize;
+    model->JacobianSparsityPointers(&ptr, &ptrSize);
+    checkCompressed(jac, col, row, ptr, ptrSize, jacDense, n, m, false);
+
+    /**
+     * Hessian (CSR)
+     */
+    std::vector<double> hessDense = model->Hessian(x, w);
+
+    std::vector<size_t> hr, hc;
+    model->HessianSparsity(hr, hc);
+    std::vector<double> hess(hr.size());
+    model->SparseHessian(x, w, hess, &row, &col);
+
+    model->HessianSparsityPointers(&ptr, &ptrSize);
+    checkCompressed(hess, row, col, ptr, ptrSize, hessDense, n, n, true);
+}
+
+TEST_F(CppADCGTest, SparseHessianTriangle) {
+    testSparseHessianTriangle(MatrixTriangle::Lower, false, MultiThreadingType::NONE, "model_triangle");
+}
+
+TEST_F(CppADCGTest, SparseHessianTriangleRev2) {
+    // the sparse Hessian is assembled from the second order reverse mode
+    testSparseHessianTriangle(MatrixTriangle::Lower, true, MultiThreadingType::NONE, "model_triangle_rev2");
+    testSparseHessianTriangle(MatrixTriangle::Upper, true, MultiThreadingType::NONE, "model_triangle_rev2_upper");
+}
+
+TEST_F(CppADCGTest, SparseHessianTriangleRev2Threads) {
+    testSparseHessianTriangle(MatrixTriangle::Upper, true, MultiThreadingType::PTHREADS, "model_triangle_rev2_pthreads");
+}
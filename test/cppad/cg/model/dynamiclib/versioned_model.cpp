@@ -0,0 +1,119 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+#include "CppADCGTest.hpp"
+#include "gccCompilerFlags.hpp"
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+namespace {
+
+/**
+ * Creates a dynamic library with the model y = a * x0 * x1
+ */
+std::unique_ptr<ModelLibrary<double>> createLibrary(double a,
+                                                    const std::string& libName) {
+    using CGD = CG<double>;
+    using ADCG = AD<CGD>;
+
+    std::vector<ADCG> x(2, 1.0);
+    CppAD::Independent(x);
+
+    std::vector<ADCG> y{a * x[0] * x[1]};
+
+    ADFun<CGD> fun(x, y);
+
+    ModelCSourceGen<double> compHelp(fun, "model");
+    compHelp.setCreateForwardZero(true);
+    compHelp.setCreateSparseJacobian(true);
+
+    ModelLibraryCSourceGen<double> compDynHelp(compHelp);
+
+    DynamicModelLibraryProcessor<double> p(compDynHelp, libName);
+
+    GccCompiler<double> compiler;
+    prepareTestCompilerFlags(compiler);
+
+    return p.createDynamicLibrary(compiler);
+}
+
+}
+
+TEST_F(CppADCGTest, VersionedModelLibrary) {
+    VersionedModelLibrary<double> lib(createLibrary(2.0, "versioned_model_v1"));
+    ASSERT_EQ(lib.getVersionNumber(), 1u);
+
+    std::unique_ptr<GenericModel<double>> model = lib.model("model");
+    ASSERT_TRUE(model != nullptr);
+    ASSERT_TRUE(lib.model("missing") == nullptr);
+
+    std::vector<double> x{3.0, 5.0};
+    std::vector<double> y = model->ForwardZero(x);
+    ASSERT_EQ(y.size(), 1u);
+    ASSERT_NEAR(y[0], 30.0, 1e-10);
+
+    // build the new version in the background
+    std::future<size_t> version = lib.replaceAsync([]() {
+        return createLibrary(4.0, "versioned_model_v2");
+    });
+    ASSERT_EQ(version.get(), 2u);
+    ASSERT_EQ(lib.getVersionNumber(), 2u);
+
+    y = model->ForwardZero(x);
+    ASSERT_NEAR(y[0], 60.0, 1e-10);
+    ASSERT_EQ(dynamic_cast<VersionedModel<double>&>(*model).getVersionNumber(), 2u);
+
+    std::vector<double> jac = model->SparseJacobian(x);
+    ASSERT_EQ(jac.size(), 2u);
+    ASSERT_NEAR(jac[0], 20.0, 1e-10);
+    ASSERT_NEAR(jac[1], 12.0, 1e-10);
+
+    // the previous version is kept while it is in use
+    VersionedModelLibrary<double>::VersionPtr v2 = lib.getCurrentVersion();
+    lib.replace(createLibrary(1.0, "versioned_model_v3"));
+    ASSERT_EQ(v2.use_count(), 2); // this test and the model
+    y = model->ForwardZero(x);
+    ASSERT_NEAR(y[0], 15.0, 1e-10);
+    ASSERT_EQ(v2.use_count(), 1);
+}
+
+TEST_F(CppADCGTest, VersionedModelOutlivesLibrary) {
+    std::unique_ptr<GenericModel<double>> model;
+    {
+        VersionedModelLibrary<double> lib(createLibrary(2.0, "versioned_model_lifetime"));
+        model = lib.model("model");
+        ASSERT_TRUE(model != nullptr);
+    }
+
+    // the last version of the library is kept by the model
+    std::vector<double> x{3.0, 5.0};
+    std::vector<double> y = model->ForwardZero(x);
+    ASSERT_EQ(y.size(), 1u);
+    ASSERT_NEAR(y[0], 30.0, 1e-10);
+}
+
+TEST_F(CppADCGTest, VersionedModelLibrarySameFile) {
+    VersionedModelLibrary<double> lib(createLibrary(2.0, "versioned_model_same"));
+    std::unique_ptr<GenericModel<double>> model = lib.model("model");
+    ASSERT_TRUE(model != nullptr);
+
+    // the file is already loaded and would provide the code of the first version
+    ASSERT_THROW(lib.replace(createLibrary(3.0, "versioned_model_same")), CGException);
+    ASSERT_EQ(lib.getVersionNumber(), 1u);
+
+    std::vector<double> x{3.0, 5.0};
+    std::vector<double> y = model->ForwardZero(x);
+    ASSERT_NEAR(y[0], 30.0, 1e-10);
+}
@@ -15,8 +15,10 @@
 
 #include <iostream>
 #include <fstream>
+#include <regex>
 
 #include "CppADCGTest.hpp"
+#include "gccCompilerFlags.hpp"
 #include <cppad/cg/cppadcg.hpp>
 #include <cppad/cg/lang/dot/dot.hpp>
 #include <cppad/cg/lang/c/lang_c_default_var_name_gen.hpp>
@@ -40,14 +42,34 @@ public:
     void testNumberOfSources(size_t maxAssignPerFunction,
                              size_t maxOperationsPerAssign,
                              size_t expectedNumberOfSources) {
+        std::map<std::string, std::string> sources = generateSources(maxAssignPerFunction,
+                                                                      maxOperationsPerAssign,
+                                                                      false);
+
+        ASSERT_EQ(sources.size(), expectedNumberOfSources);
+    }
+
+    std::map<std::string, std::string> generateSources(size_t maxAssignPerFunction,
+                                                       size_t maxOperationsPerAssign,
+                                                       bool splitByDependencies,
+                                                       MultiThreadingType tasks = MultiThreadingType::NONE) {
         ADFun<CGD> fun = model();
 
+        return generateSources(fun, maxAssignPerFunction, maxOperationsPerAssign, splitByDependencies, tasks);
+    }
+
+    std::map<std::string, std::string> generateSources(ADFun<CGD>& fun,
+                                                       size_t maxAssignPerFunction,
+                                                       size_t maxOperationsPerAssign,
+                                                       bool splitByDependencies,
+                                                       MultiThreadingType tasks = MultiThreadingType::NONE) {
         /**
          * start the special steps for source code generation
          */
         CodeHandler<double> handler;
+        handler.setReuseVariableIDs(tasks == MultiThreadingType::NONE);
 
-        CppAD::vector<CGD> indVars(5);
+        CppAD::vector<CGD> indVars(fun.Domain());
         handler.makeVariables(indVars);
 
         CppAD::vector<CGD> vals = fun.Forward(0, indVars);
@@ -59,6 +81,8 @@ public:
 
         std::map<std::string, std::string> sources;
         langC.setMaxAssignmentsPerFunction(maxAssignPerFunction, &sources);
+        langC.setFunctionSplitByDependencies(splitByDependencies);
+        langC.setLocalFunctionTasks(tasks);
         langC.setGenerateFunction("split_model");
         langC.setMaxOperationsPerAssignment(maxOperationsPerAssign);
 
@@ -68,7 +92,7 @@ public:
             printSources(sources);
         }
 
-        ASSERT_EQ(sources.size(), expectedNumberOfSources);
+        return sources;
     }
 
 protected:
@@ -102,6 +126,37 @@ protected:
         return fun;
     }
 
+    /**
+     * A model with independent components: y[k] = cos(sin(x[2k] * x[2k+1]))
+     */
+    inline static ADFun<CGD> componentModel() {
+        CppAD::vector<ADCG> x(6);
+        for (size_t j = 0; j < x.size(); j++)
+            x[j] = 0.5 + j;
+        Independent(x);
+
+        CppAD::vector<ADCG> y(3);
+        for (size_t k = 0; k < y.size(); k++)
+            y[k] = cos(sin(x[2 * k] * x[2 * k + 1]));
+
+        ADFun<CGD> fun(x, y);
+
+        return fun;
+    }
+
+    /**
+     * Determines the indexes of an array used in a source
+     */
+    inline static std::set<size_t> arrayIndexes(const std::string& source,
+                                                const std::string& array) {
+        std::set<size_t> indexes;
+        std::regex pattern("\\b" + array + "\\[([0-9]+)\\]");
+        for (auto it = std::sregex_iterator(source.begin(), source.end(), pattern); it != std::sregex_iterator(); ++it) {
+            indexes.insert(std::stoul((*it)[1].str()));
+        }
+        return indexes;
+    }
+
     inline static void printSources(const std::map<std::string, std::string>& sources) {
         for (const auto& name2content : sources) {
             std::ofstream texfile;
@@ -137,4 +192,102 @@ TEST_F(CppADCGTestLangC, maxOperationPerAssign1) {
     testNumberOfSources(2u,
                         1u,
                         11u);
-}
\ No newline at end of file
+}
+
+TEST_F(CppADCGTestLangC, splitByDependencies) {
+    ADFun<CGD> fun = componentModel();
+
+    // each component has 3 assignments and no temporary variables are shared between components
+    std::map<std::string, std::string> sources = generateSources(fun, 3u, 1u, true);
+
+    ASSERT_EQ(sources.size(), 4u);
+    ASSERT_TRUE(sources.find("split_model.c") != sources.end());
+
+    for (size_t k = 0; k < 3; k++) {
+        std::string name = "split_model__" + std::to_string(k + 1) + ".c";
+        ASSERT_TRUE(sources.find(name) != sources.end()) << name;
+        const std::string& source = sources.at(name);
+
+        ASSERT_EQ(arrayIndexes(source, "x"), std::set<size_t>({2 * k, 2 * k + 1})) << name;
+        ASSERT_EQ(arrayIndexes(source, "y"), std::set<size_t>({k})) << name;
+    }
+}
+
+#ifdef CPPAD_CG_SYSTEM_LINUX
+/**
+ * Provides access to the generated sources
+ */
+class SplitSourceGen : public ModelCSourceGen<double> {
+public:
+    using ModelCSourceGen<double>::ModelCSourceGen;
+
+    inline const std::map<std::string, std::string>& sources() {
+        return this->getSources(MultiThreadingType::NONE, nullptr);
+    }
+};
+
+TEST_F(CppADCGTestLangC, splitByDependenciesCompiled) {
+    ADFun<CGD> fun = componentModel();
+
+    SplitSourceGen splitGen(fun, "split_deps");
+    splitGen.setCreateForwardZero(true);
+    splitGen.setCreateSparseJacobian(true);
+    splitGen.setMaxAssignmentsPerFunc(3);
+    splitGen.setMaxOperationsPerAssignment(1);
+    splitGen.setFunctionSplitByDependencies(true);
+
+    const std::map<std::string, std::string>& splitSources = splitGen.sources();
+    ASSERT_TRUE(splitSources.find("split_deps_forward_zero__3.c") != splitSources.end());
+
+    SplitSourceGen noSplitGen(fun, "split_none");
+    noSplitGen.setCreateForwardZero(true);
+    noSplitGen.setCreateSparseJacobian(true);
+
+    const std::map<std::string, std::string>& noSplitSources = noSplitGen.sources();
+    ASSERT_TRUE(noSplitSources.find("split_none_forward_zero__1.c") == noSplitSources.end());
+
+    ModelLibraryCSourceGen<double> libSourceGen(splitGen, noSplitGen);
+
+    DynamicModelLibraryProcessor<double> p(libSourceGen, "split_by_dependencies");
+
+    GccCompiler<double> compiler;
+    prepareTestCompilerFlags(compiler);
+
+    std::unique_ptr<DynamicLib<double>> dynamicLib = p.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> split = dynamicLib->model("split_deps");
+    std::unique_ptr<GenericModel<double>> noSplit = dynamicLib->model("split_none");
+    ASSERT_TRUE(split != nullptr);
+    ASSERT_TRUE(noSplit != nullptr);
+
+    std::vector<double> x{0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+
+    std::vector<double> ySplit = split->ForwardZero(x);
+    std::vector<double> yNoSplit = noSplit->ForwardZero(x);
+    ASSERT_EQ(ySplit.size(), 3u);
+    for (size_t k = 0; k < ySplit.size(); k++) {
+        ASSERT_NEAR(ySplit[k], std::cos(std::sin(x[2 * k] * x[2 * k + 1])), 1e-10);
+        ASSERT_NEAR(ySplit[k], yNoSplit[k], 1e-10);
+    }
+
+    std::vector<double> jacSplit = split->SparseJacobian(x);
+    std::vector<double> jacNoSplit = noSplit->SparseJacobian(x);
+    ASSERT_EQ(jacSplit.size(), jacNoSplit.size());
+    for (size_t e = 0; e < jacSplit.size(); e++) {
+        ASSERT_NEAR(jacSplit[e], jacNoSplit[e], 1e-10);
+    }
+}
+#endif
+
+TEST_F(CppADCGTestLangC, localFunctionTasks) {
+    std::map<std::string, std::string> sources = generateSources(2u, 1u, false, MultiThreadingType::PTHREADS);
+
+    ASSERT_TRUE(sources.find("split_model__1.c") != sources.end());
+    const std::string& wrapper = sources.at("split_model.c");
+    // some local functions are evaluated concurrently
+    ASSERT_NE(wrapper.find("task_level_start"), std::string::npos);
+    ASSERT_NE(wrapper.find("cppadcg_thpool_add_job(split_model_task"), std::string::npos);
+
+    std::map<std::string, std::string> sourcesOmp = generateSources(2u, 1u, false, MultiThreadingType::OPENMP);
+    ASSERT_EQ(sourcesOmp.size(), sources.size());
+    ASSERT_NE(sourcesOmp.at("split_model.c").find("#pragma omp parallel for"), std::string::npos);
+}
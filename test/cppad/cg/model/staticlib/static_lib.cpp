@@ -0,0 +1,137 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+#include <dlfcn.h>
+#include "CppADCGModelTest.hpp"
+#include "gccCompilerFlags.hpp"
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+namespace CppAD {
+namespace cg {
+
+class CppADCGStaticLibTest : public CppADCGModelTest {
+protected:
+    const std::string _libName = "static_model";
+    const std::string _registryName = "static_model_functions";
+    std::unique_ptr<ADFun<CGD>> _fun;
+    std::vector<double> _xRun{1, 2, 1};
+public:
+
+    inline CppADCGStaticLibTest() :
+            CppADCGModelTest(false, false) {
+    }
+
+    void SetUp() override {
+        std::vector<ADCGD> x(3, 1.0);
+        CppAD::Independent(x);
+
+        std::vector<ADCGD> y(2);
+        y[0] = cos(x[0]);
+        y[1] = x[1] * x[2] + sin(x[0]);
+
+        _fun.reset(new ADFun<CGD>(x, y));
+    }
+
+    void TearDown() override {
+        _fun.reset();
+    }
+
+    /**
+     * Generates the model sources and compiles them into a static library
+     */
+    void createStaticLibrary() {
+        ModelCSourceGen<double> modelSourceGen(*_fun, "static");
+        modelSourceGen.setCreateForwardZero(true);
+        modelSourceGen.setCreateJacobian(true);
+        modelSourceGen.setCreateHessian(true);
+        modelSourceGen.setCreateSparseJacobian(true);
+        modelSourceGen.setCreateSparseHessian(true);
+        modelSourceGen.setCreateForwardOne(true);
+        modelSourceGen.setCreateReverseOne(true);
+        modelSourceGen.setCreateReverseTwo(true);
+
+        ModelLibraryCSourceGen<double> libSourceGen(modelSourceGen);
+
+        StaticModelLibraryProcessor<double> p(libSourceGen, _libName, _registryName);
+        ASSERT_EQ(p.getRegistryName(), _registryName);
+
+        const std::map<std::string, std::string>& registry = p.getRegistrySources();
+        ASSERT_EQ(registry.size(), 1u);
+        ASSERT_NE(registry.begin()->second.find("\"static_" + ModelCSourceGen<double>::FUNCTION_SPARSE_JACOBIAN + "\""), std::string::npos);
+
+        GccCompiler<double> compiler;
+        prepareTestCompilerFlags(compiler);
+        ArArchiver ar;
+
+        // position independent code so that it can be linked into a shared object
+        p.createStaticLibrary(compiler, ar, true);
+
+        std::ifstream header(_registryName + ".h");
+        ASSERT_TRUE(header.is_open());
+        std::string headerContent((std::istreambuf_iterator<char>(header)), std::istreambuf_iterator<char>());
+        ASSERT_NE(headerContent.find(" " + _registryName + "("), std::string::npos);
+    }
+
+    /**
+     * Links the whole static library into a shared object
+     */
+    std::string linkSharedObject() {
+        std::string library = "./lib" + _libName + "_linked" + system::SystemInfo<>::DYNAMIC_LIB_EXTENSION;
+
+        GccCompiler<double> linker;
+        prepareTestCompilerFlags(linker);
+        linker.addLinkFlag("--whole-archive");
+        linker.addLinkFlag(_libName + system::SystemInfo<>::STATIC_LIB_EXTENSION);
+        linker.addLinkFlag("--no-whole-archive");
+        linker.buildDynamic(library);
+
+        return library;
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+TEST_F(CppADCGStaticLibTest, LinkedModel) {
+    ASSERT_NO_FATAL_FAILURE(createStaticLibrary());
+
+    std::string library = linkSharedObject();
+
+    void* handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+    ASSERT_TRUE(handle != nullptr) << dlerror();
+
+    // the registration function is the only symbol which is looked up
+    auto registry = reinterpret_cast<StaticLib<double>::RegistryFunction>(dlsym(handle, _registryName.c_str()));
+    ASSERT_TRUE(registry != nullptr);
+
+    {
+        StaticLib<double> lib(registry);
+
+        std::set<std::string> names = lib.getModelNames();
+        ASSERT_EQ(names.size(), 1u);
+        ASSERT_EQ(*names.begin(), "static");
+        ASSERT_TRUE(lib.model("missing") == nullptr);
+        ASSERT_THROW(lib.loadFunction("missing"), CGException);
+        ASSERT_TRUE(lib.loadFunction("missing", false) == nullptr);
+
+        std::unique_ptr<GenericModel<double>> model = lib.model("static");
+        ASSERT_TRUE(model != nullptr);
+
+        this->testModelResults(lib, *model, *_fun, _xRun, false);
+    }
+
+    dlclose(handle);
+}
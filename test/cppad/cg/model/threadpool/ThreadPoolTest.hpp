@@ -60,6 +60,54 @@ public:
         return y;
     }
 
+    /**
+     * Compares the evaluation of several points at once with the
+     * evaluation of each point individually
+     */
+    void testManyPoints(size_t chunkSize) {
+        size_t nPoints = 37;
+        size_t n = _model->Domain();
+        size_t m = _model->Range();
+
+        std::vector<std::vector<double>> x(nPoints, std::vector<double>(n));
+        for (size_t p = 0; p < nPoints; ++p) {
+            for (size_t j = 0; j < n; ++j)
+                x[p][j] = 0.5 + 0.1 * p + 0.01 * j;
+        }
+
+        std::vector<size_t> rows, cols;
+        _model->JacobianSparsity(rows, cols);
+        size_t nnz = rows.size();
+
+        std::vector<std::vector<double>> y(nPoints, std::vector<double>(m));
+        std::vector<std::vector<double>> jac(nPoints, std::vector<double>(nnz));
+        std::vector<const double*> xPtr(nPoints);
+        std::vector<double*> yPtr(nPoints), jacPtr(nPoints);
+        for (size_t p = 0; p < nPoints; ++p) {
+            xPtr[p] = x[p].data();
+            yPtr[p] = y[p].data();
+            jacPtr[p] = jac[p].data();
+        }
+
+        _model->ForwardZeroMany(xPtr, yPtr, chunkSize);
+
+        size_t const* row;
+        size_t const* col;
+        _model->SparseJacobianMany(xPtr, jacPtr, &row, &col, chunkSize);
+
+        std::vector<double> yRef(m), jacRef(nnz);
+        for (size_t p = 0; p < nPoints; ++p) {
+            _model->ForwardZero(x[p], yRef);
+            ASSERT_TRUE(compareValues<double>(y[p], yRef, epsilonR, epsilonA));
+
+            size_t const* rowRef;
+            size_t const* colRef;
+            _model->SparseJacobian(ArrayView<const double>(x[p]), jacRef, &rowRef, &colRef);
+            ASSERT_TRUE(compareValues<double>(jac[p], jacRef, epsilonR, epsilonA));
+            ASSERT_EQ(row, rowRef);
+            ASSERT_EQ(col, colRef);
+        }
+    }
 };
 
 } // END cg namespace
@@ -158,3 +158,55 @@ TEST_F(CppADCGThreadPoolDynamicCustomTest, Jacobian) {
 TEST_F(CppADCGThreadPoolDynamicCustomTest, Hessian) {
     this->testHessian();
 }
+
+namespace CppAD {
+namespace cg {
+
+class CppADCGLocalFunctionTasksTest : public ThreadPoolTest {
+public:
+    explicit CppADCGLocalFunctionTasksTest() :
+            ThreadPoolTest(MultiThreadingType::OPENMP) {
+        this->_multithreadDisabled = false;
+        this->_denseJacobian = true;
+        this->_denseHessian = true;
+        this->_localFunctionTasks = true;
+        this->_maxAssignPerFunc = 2;
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+TEST_F(CppADCGLocalFunctionTasksTest, ForwardZero) {
+    this->testForwardZero();
+}
+
+TEST_F(CppADCGLocalFunctionTasksTest, DenseJacobian) {
+    this->testDenseJacobian();
+}
+
+TEST_F(CppADCGLocalFunctionTasksTest, DenseHessian) {
+    this->testDenseHessian();
+}
+
+namespace CppAD {
+namespace cg {
+
+class CppADCGThreadPoolManyTest : public ThreadPoolTest {
+public:
+    explicit CppADCGThreadPoolManyTest() :
+            ThreadPoolTest(MultiThreadingType::OPENMP) {
+        this->_multithreadDisabled = false;
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+TEST_F(CppADCGThreadPoolManyTest, AutomaticChunks) {
+    this->testManyPoints(0);
+}
+
+TEST_F(CppADCGThreadPoolManyTest, FixedChunks) {
+    this->testManyPoints(5);
+}
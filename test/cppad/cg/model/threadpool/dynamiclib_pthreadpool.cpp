@@ -13,6 +13,7 @@
  * ----------------------------------------------------------------------------
  * Author: Joao Leal
  */
+#include <atomic>
 #include "ThreadPoolTest.hpp"
 
 using namespace CppAD::cg;
@@ -158,3 +159,351 @@ TEST_F(CppADCGThreadPoolDynamicCustomTest, Jacobian) {
 TEST_F(CppADCGThreadPoolDynamicCustomTest, Hessian) {
     this->testHessian();
 }
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * A host thread pool which runs each job in a new thread
+ */
+class HostExecutor {
+public:
+    struct Group {
+        std::vector<std::thread> threads;
+    };
+
+    std::atomic<int> groups;
+    std::atomic<int> jobs;
+    CppADCGThPoolExecutor executor;
+public:
+
+    inline HostExecutor() :
+            groups(0),
+            jobs(0) {
+        executor.data = this;
+        executor.begin = &begin;
+        executor.submit = &submit;
+        executor.wait = &wait;
+    }
+
+    static void* begin(void* data) {
+        static_cast<HostExecutor*>(data)->groups++;
+        return new Group();
+    }
+
+    static void submit(void* data,
+                       void* group,
+                       void (* function)(void*),
+                       void* arg) {
+        static_cast<HostExecutor*>(data)->jobs++;
+        static_cast<Group*>(group)->threads.emplace_back(function, arg);
+    }
+
+    static void wait(void* data,
+                     void* group) {
+        auto* g = static_cast<Group*>(group);
+        for (auto& t : g->threads)
+            t.join();
+        delete g;
+    }
+};
+
+class CppADCGThreadPoolExecutorTest : public ThreadPoolTest {
+protected:
+    HostExecutor _host;
+public:
+    explicit CppADCGThreadPoolExecutorTest() :
+            ThreadPoolTest(MultiThreadingType::PTHREADS) {
+        this->_multithreadDisabled = false;
+        this->_threadPoolExecutor = &_host.executor;
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+TEST_F(CppADCGThreadPoolExecutorTest, Jacobian) {
+    this->testJacobian();
+
+    ASSERT_GT(_host.groups.load(), 0);
+    ASSERT_GE(_host.jobs.load(), _host.groups.load());
+}
+
+TEST_F(CppADCGThreadPoolExecutorTest, Hessian) {
+    this->testHessian();
+
+    ASSERT_GT(_host.groups.load(), 0);
+    ASSERT_GE(_host.jobs.load(), _host.groups.load());
+}
+
+TEST_F(CppADCGThreadPoolExecutorTest, ConcurrentHosts) {
+    // two host threads evaluate models of the same library at the same time
+    size_t nThreads = 2;
+    size_t nEvals = 50;
+
+    std::vector<double> jacRef;
+    std::vector<size_t> rowRef, colRef;
+    _model->SparseJacobian(_xRun, jacRef, rowRef, colRef);
+
+    std::vector<std::unique_ptr<GenericModel<double>>> models(nThreads);
+    for (auto& m : models) {
+        m = _dynamicLib->model(_name + "dynamic");
+        ASSERT_TRUE(m != nullptr);
+    }
+
+    std::vector<size_t> failed(nThreads, 0);
+    std::vector<std::thread> hosts;
+    for (size_t t = 0; t < nThreads; ++t) {
+        hosts.emplace_back([&, t]() {
+            std::vector<double> jac;
+            std::vector<size_t> row, col;
+            for (size_t e = 0; e < nEvals; ++e) {
+                models[t]->SparseJacobian(_xRun, jac, row, col);
+                if (jac != jacRef || row != rowRef || col != colRef)
+                    failed[t]++;
+            }
+        });
+    }
+    for (auto& h : hosts)
+        h.join();
+
+    for (size_t t = 0; t < nThreads; ++t) {
+        ASSERT_EQ(failed[t], 0u);
+    }
+    ASSERT_GE(_host.groups.load(), int(nThreads * nEvals));
+}
+
+namespace CppAD {
+namespace cg {
+
+class CppADCGThreadPoolAffinityTest : public ThreadPoolTest {
+public:
+    explicit CppADCGThreadPoolAffinityTest() :
+            ThreadPoolTest(MultiThreadingType::PTHREADS) {
+        this->_multithreadDisabled = false;
+        this->_multithreadScheduler = ThreadPoolScheduleStrategy::DYNAMIC;
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+TEST_F(CppADCGThreadPoolAffinityTest, Compact) {
+    _dynamicLib->setThreadPoolAffinity(ThreadPoolAffinity::COMPACT);
+    ASSERT_EQ(_dynamicLib->getThreadPoolAffinity(), ThreadPoolAffinity::COMPACT);
+
+    this->testJacobian();
+    this->testHessian();
+}
+
+TEST_F(CppADCGThreadPoolAffinityTest, Scatter) {
+    _dynamicLib->setThreadPoolAffinity(ThreadPoolAffinity::SCATTER);
+
+    this->testJacobian();
+    this->testHessian();
+}
+
+TEST_F(CppADCGThreadPoolAffinityTest, Explicit) {
+    std::vector<int> cpus{0};
+    _dynamicLib->setThreadPoolAffinityCpus(cpus);
+    _dynamicLib->setThreadPoolAffinity(ThreadPoolAffinity::EXPLICIT);
+    ASSERT_EQ(_dynamicLib->getThreadPoolAffinityCpus(), cpus);
+
+    this->testJacobian();
+    this->testHessian();
+}
+
+namespace CppAD {
+namespace cg {
+
+class CppADCGThreadPoolProfileTest : public ThreadPoolTest {
+public:
+    explicit CppADCGThreadPoolProfileTest() :
+            ThreadPoolTest(MultiThreadingType::PTHREADS) {
+        this->_multithreadDisabled = false;
+        this->_multithreadScheduler = ThreadPoolScheduleStrategy::STATIC;
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+TEST_F(CppADCGThreadPoolProfileTest, SaveLoad) {
+    using Function = ThreadPoolProfile::Function;
+
+    // estimates from the number of operations
+    ThreadPoolProfile initial = _model->getThreadPoolProfile();
+    ASSERT_EQ(initial.functions.count(ModelCSourceGen<double>::FUNCTION_SPARSE_JACOBIAN), 1u);
+    ASSERT_EQ(initial.functions.count(ModelCSourceGen<double>::FUNCTION_SPARSE_HESSIAN), 1u);
+    const Function& jacInitial = initial.functions.at(ModelCSourceGen<double>::FUNCTION_SPARSE_JACOBIAN);
+    ASSERT_FALSE(jacInitial.elapsed.empty());
+    ASSERT_EQ(jacInitial.measurements, 0u);
+    for (float e : jacInitial.elapsed) {
+        ASSERT_GT(e, 0.0f);
+    }
+
+    this->testJacobian();
+    this->testHessian();
+
+    ThreadPoolProfile measured = _model->getThreadPoolProfile();
+    const Function& jacMeasured = measured.functions.at(ModelCSourceGen<double>::FUNCTION_SPARSE_JACOBIAN);
+    ASSERT_EQ(jacMeasured.elapsed.size(), jacInitial.elapsed.size());
+    ASSERT_GT(jacMeasured.measurements, 0u);
+
+    std::stringstream ss;
+    measured.write(ss);
+
+    ThreadPoolProfile loaded;
+    loaded.read(ss, initial);
+    ASSERT_EQ(loaded.functions.size(), measured.functions.size());
+    for (const auto& p : measured.functions) {
+        const Function& f = loaded.functions.at(p.first);
+        ASSERT_EQ(f.measurements, p.second.measurements);
+        ASSERT_EQ(f.elapsed, p.second.elapsed);
+    }
+
+    // saved profiles must match the jobs of the model
+    ThreadPoolProfile other;
+    other.functions[ModelCSourceGen<double>::FUNCTION_SPARSE_JACOBIAN].elapsed.resize(jacInitial.elapsed.size() + 1, 1.0f);
+    std::stringstream ssOther;
+    other.write(ssOther);
+    ThreadPoolProfile rejected;
+    ASSERT_THROW(rejected.read(ssOther, initial), CGException);
+    ASSERT_TRUE(rejected.empty());
+
+    std::stringstream ssCorrupt("cppadcg_thread_pool_profile 1\n1\n" +
+                                ModelCSourceGen<double>::FUNCTION_SPARSE_JACOBIAN +
+                                " 1 18446744073709551615\n");
+    ASSERT_THROW(rejected.read(ssCorrupt, initial), CGException);
+
+    // profiles with a different number of jobs are ignored
+    ThreadPoolProfile invalid;
+    invalid.functions[ModelCSourceGen<double>::FUNCTION_SPARSE_JACOBIAN].elapsed.resize(jacInitial.elapsed.size() + 1, 1.0f);
+    _model->setThreadPoolProfile(invalid);
+    ASSERT_EQ(_model->getThreadPoolProfile().functions.at(ModelCSourceGen<double>::FUNCTION_SPARSE_JACOBIAN).elapsed,
+              jacMeasured.elapsed);
+
+    _model->setThreadPoolProfile(initial);
+    ThreadPoolProfile reset = _model->getThreadPoolProfile();
+    ASSERT_EQ(reset.functions.at(ModelCSourceGen<double>::FUNCTION_SPARSE_JACOBIAN).measurements, 0u);
+
+    _model->setThreadPoolProfile(loaded);
+    ASSERT_EQ(_model->getThreadPoolProfile().functions.at(ModelCSourceGen<double>::FUNCTION_SPARSE_JACOBIAN).elapsed,
+              jacMeasured.elapsed);
+
+    this->testJacobian();
+    this->testHessian();
+}
+
+namespace CppAD {
+namespace cg {
+
+class CppADCGLocalFunctionTasksTest : public ThreadPoolTest {
+public:
+    explicit CppADCGLocalFunctionTasksTest() :
+            ThreadPoolTest(MultiThreadingType::PTHREADS) {
+        this->_multithreadDisabled = false;
+        this->_denseJacobian = true;
+        this->_denseHessian = true;
+        this->_localFunctionTasks = true;
+        this->_maxAssignPerFunc = 2;
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+TEST_F(CppADCGLocalFunctionTasksTest, ForwardZero) {
+    this->testForwardZero();
+}
+
+TEST_F(CppADCGLocalFunctionTasksTest, DenseJacobian) {
+    this->testDenseJacobian();
+}
+
+TEST_F(CppADCGLocalFunctionTasksTest, DenseHessian) {
+    this->testDenseHessian();
+}
+
+namespace CppAD {
+namespace cg {
+
+class CppADCGThreadPoolSpinTest : public ThreadPoolTest {
+public:
+    explicit CppADCGThreadPoolSpinTest() :
+            ThreadPoolTest(MultiThreadingType::PTHREADS) {
+        this->_multithreadDisabled = false;
+        this->_threadPoolSpinTime = 50e-6f;
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+TEST_F(CppADCGThreadPoolSpinTest, ForwardZero) {
+    ASSERT_FLOAT_EQ(_dynamicLib->getThreadPoolSpinTime(), 50e-6f);
+    this->testForwardZero();
+}
+
+TEST_F(CppADCGThreadPoolSpinTest, Jacobian) {
+    this->testJacobian();
+}
+
+TEST_F(CppADCGThreadPoolSpinTest, Hessian) {
+    this->testHessian();
+}
+
+namespace CppAD {
+namespace cg {
+
+class CppADCGThreadPoolSequentialTest : public ThreadPoolTest {
+public:
+    explicit CppADCGThreadPoolSequentialTest() :
+            ThreadPoolTest(MultiThreadingType::PTHREADS) {
+        this->_multithreadDisabled = false;
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+TEST_F(CppADCGThreadPoolSequentialTest, SmallWork) {
+    // the evaluations of this model are always below the threshold
+    _dynamicLib->setThreadPoolSequentialThreshold(1.0f);
+    ASSERT_FLOAT_EQ(_dynamicLib->getThreadPoolSequentialThreshold(), 1.0f);
+
+    this->testJacobian();
+    this->testHessian();
+
+    // execution times are still measured by the calling thread
+    ThreadPoolProfile profile = _model->getThreadPoolProfile();
+    ASSERT_GT(profile.functions.at(ModelCSourceGen<double>::FUNCTION_SPARSE_JACOBIAN).measurements, 0u);
+    ASSERT_GT(profile.functions.at(ModelCSourceGen<double>::FUNCTION_SPARSE_HESSIAN).measurements, 0u);
+
+    _dynamicLib->setThreadPoolSequentialThreshold(0);
+
+    this->testJacobian();
+    this->testHessian();
+}
+
+namespace CppAD {
+namespace cg {
+
+class CppADCGThreadPoolManyTest : public ThreadPoolTest {
+public:
+    explicit CppADCGThreadPoolManyTest() :
+            ThreadPoolTest(MultiThreadingType::PTHREADS) {
+        this->_multithreadDisabled = false;
+    }
+};
+
+} // END cg namespace
+} // END CppAD namespace
+
+TEST_F(CppADCGThreadPoolManyTest, AutomaticChunks) {
+    this->testManyPoints(0);
+}
+
+TEST_F(CppADCGThreadPoolManyTest, FixedChunks) {
+    this->testManyPoints(5);
+}
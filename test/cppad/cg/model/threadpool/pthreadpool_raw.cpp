@@ -168,6 +168,17 @@ void pooldynamic_sparse_jacobian(double const* const* in, double* const* out, st
 
 }
 
+typedef struct NestedModelArgStruct {
+    double const* const* in;
+    double* out[1];
+    struct LangCAtomicFun atomicFun;
+} NestedModelArgStruct;
+
+static void exec_nested_model(void* arg) {
+    NestedModelArgStruct* nArg = (NestedModelArgStruct*) arg;
+    pooldynamic_sparse_jacobian(nArg->in, nArg->out, nArg->atomicFun);
+}
+
 }
 
 namespace CppAD {
@@ -251,4 +262,57 @@ TEST_F(PThreadPoolTest, StaticJac) {
     pooldynamic_sparse_jacobian(in.data(), out.data(), atomicFun); // reuse previous work group schedule
 
     ASSERT_TRUE(compareValues(jac, out0));
-}
\ No newline at end of file
+}
+TEST_F(PThreadPoolTest, SpinJac) {
+    cppadcg_thpool_set_spin_time(50e-6f);
+    ASSERT_FLOAT_EQ(cppadcg_thpool_get_spin_time(), 50e-6f);
+
+    for (auto s : {SCHED_DYNAMIC, SCHED_GUIDED, SCHED_STATIC}) {
+        cppadcg_thpool_set_scheduler_strategy(s);
+
+        for (size_t i = 0; i < 3; ++i) {
+            pooldynamic_sparse_jacobian(in.data(), out.data(), atomicFun);
+        }
+
+        ASSERT_TRUE(compareValues(jac, out0));
+    }
+
+    cppadcg_thpool_set_spin_time(0);
+}
+
+TEST_F(PThreadPoolTest, SequentialThresholdJac) {
+    cppadcg_thpool_set_scheduler_strategy(SCHED_DYNAMIC);
+    cppadcg_thpool_set_sequential_threshold(1.0f);
+    ASSERT_FLOAT_EQ(cppadcg_thpool_get_sequential_threshold(), 1.0f);
+
+    for (size_t i = 0; i < 3; ++i) {
+        pooldynamic_sparse_jacobian(in.data(), out.data(), atomicFun);
+    }
+
+    cppadcg_thpool_set_sequential_threshold(0);
+
+    ASSERT_TRUE(compareValues(jac, out0));
+}
+
+TEST_F(PThreadPoolTest, NestedJac) {
+    cppadcg_thpool_set_scheduler_strategy(SCHED_DYNAMIC);
+
+    // a multithreaded model evaluated inside the jobs of the pool
+    // (e.g. an atomic function) must not wait for the pool threads
+    std::vector<std::vector<double>> nestedOut(4, std::vector<double>(12));
+    std::vector<NestedModelArgStruct> args(nestedOut.size());
+    for (size_t i = 0; i < args.size(); ++i) {
+        args[i].in = in.data();
+        args[i].out[0] = nestedOut[i].data();
+        args[i].atomicFun = atomicFun;
+        cppadcg_thpool_add_job(exec_nested_model, &args[i], nullptr, nullptr);
+    }
+
+    cppadcg_thpool_wait();
+
+    ASSERT_FALSE(cppadcg_thpool_is_disabled());
+
+    for (const auto& o : nestedOut) {
+        ASSERT_TRUE(compareValues(jac, o));
+    }
+}
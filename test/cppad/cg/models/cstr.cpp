@@ -24,8 +24,10 @@ namespace cg {
 class CstrDynamicTest : public CppADCGDynamicTest {
 public:
 
-    explicit CstrDynamicTest(bool verbose = false, bool printValues = false) :
-        CppADCGDynamicTest("cstr", verbose, printValues) {
+    explicit CstrDynamicTest(const std::string& name = "cstr",
+                             bool verbose = false,
+                             bool printValues = false) :
+        CppADCGDynamicTest(name, verbose, printValues) {
         // independent variable vector
         _xTape = std::vector<double>(28, 1.0);
         _xNorm.resize(28);
@@ -77,6 +79,20 @@ public:
 
 };
 
+/**
+ * Reorders operations to reduce the number of live temporary variables
+ */
+class CstrLiveTempsDynamicTest : public CstrDynamicTest {
+public:
+
+    explicit CstrLiveTempsDynamicTest(bool verbose = false,
+                                      bool printValues = false) :
+        CstrDynamicTest("cstr_live_temps", verbose, printValues) {
+        _minimizeLiveTemps = true;
+    }
+
+};
+
 } // END cg namespace
 } // END CppAD namespace
 
@@ -102,3 +118,15 @@ TEST_F(CstrDynamicTest, Jacobian) {
 TEST_F(CstrDynamicTest, Hessian) {
     this->testHessian();
 }
+
+TEST_F(CstrLiveTempsDynamicTest, ForwardZero) {
+    this->testForwardZero();
+}
+
+TEST_F(CstrLiveTempsDynamicTest, Jacobian) {
+    this->testJacobian();
+}
+
+TEST_F(CstrLiveTempsDynamicTest, Hessian) {
+    this->testHessian();
+}
@@ -0,0 +1,267 @@
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 agent
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: agent
+ */
+
+#include "CppADCGTest.hpp"
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+/**
+ * Provides access to the sparsity cache and to the generated sources
+ */
+class SparsityCacheSourceGen : public ModelCSourceGen<double> {
+public:
+    using ModelCSourceGen<double>::ModelCSourceGen;
+    using ModelCSourceGen<double>::getSparsityCache;
+
+    inline const std::map<std::string, std::string>& sources() {
+        return this->getSources(MultiThreadingType::NONE, nullptr);
+    }
+
+    /**
+     * The sources with the sparsity patterns
+     */
+    inline std::map<std::string, std::string> sparsitySources() {
+        std::map<std::string, std::string> sparsity;
+        for (const std::string& f : {FUNCTION_JACOBIAN_SPARSITY, FUNCTION_HESSIAN_SPARSITY, FUNCTION_HESSIAN_SPARSITY2}) {
+            auto it = sources().find(_name + "_" + f + ".c");
+            if (it != sources().end())
+                sparsity.insert(*it);
+        }
+        return sparsity;
+    }
+};
+
+class CppADCGSparsityCacheTest : public CppADCGTest {
+protected:
+    using SparsitySetType = SparsityCache::SparsitySetType;
+
+    static void configure(SparsityCacheSourceGen& gen,
+                          const std::string& cacheFile,
+                          JacobianADMode mode) {
+        gen.setCreateSparseJacobian(true);
+        gen.setCreateSparseHessian(true);
+        gen.setCreateHessianSparsityByEquation(true);
+        gen.setJacobianADMode(mode);
+        gen.setSparsityCacheFile(cacheFile);
+    }
+
+    static SparsityCache loadCache(const std::string& cacheFile,
+                                   ADFun<CGD>& fun) {
+        SparsityCache cache;
+        EXPECT_TRUE(cache.load(cacheFile, tapeFingerprint(fun), fun.Domain(), fun.Range()));
+        return cache;
+    }
+
+    static std::unique_ptr<ADFun<CGD> > tape(double c) {
+        std::vector<ADCGD> x(4, 1.0);
+        CppAD::Independent(x);
+
+        std::vector<ADCGD> y(3);
+        y[0] = x[0] * x[1] + c;
+        y[1] = sin(x[2]) / x[3];
+        y[2] = c * x[3];
+
+        return std::unique_ptr<ADFun<CGD> >(new ADFun<CGD>(x, y));
+    }
+};
+
+TEST_F(CppADCGSparsityCacheTest, ReadWrite) {
+    std::unique_ptr<ADFun<CGD> > fun = tape(2.0);
+    size_t m = fun->Range();
+    size_t n = fun->Domain();
+
+    SparsityCache cache;
+    cache.reset(tapeFingerprint(*fun), n, m);
+    cache.jacobian = jacobianSparsitySet<SparsitySetType, CGD>(*fun);
+    cache.hasJacobian = true;
+    cache.hessian = hessianSparsitySet<SparsitySetType, CGD>(*fun);
+    cache.hasHessian = true;
+    for (size_t i = 0; i < m; ++i) {
+        cache.hessians.push_back(hessianSparsitySet<SparsitySetType, CGD>(*fun, i));
+    }
+    cache.hasHessians = true;
+
+    std::stringstream stream;
+    cache.write(stream);
+
+    SparsityCache cache2;
+    cache2.read(stream, cache.fingerprint, n, m);
+
+    ASSERT_TRUE(cache2.matches(cache.fingerprint, n, m));
+    ASSERT_TRUE(cache2.hasJacobian);
+    compareVectorSetValues(cache.jacobian, cache2.jacobian);
+    ASSERT_TRUE(cache2.hasHessian);
+    compareVectorSetValues(cache.hessian, cache2.hessian);
+    ASSERT_TRUE(cache2.hasHessians);
+    ASSERT_EQ(cache2.hessians.size(), m);
+    for (size_t i = 0; i < m; ++i) {
+        compareVectorSetValues(cache.hessians[i], cache2.hessians[i]);
+    }
+
+    // truncated file
+    std::string data = stream.str();
+    std::stringstream truncated(data.substr(0, data.size() / 2));
+    ASSERT_THROW(cache2.read(truncated, cache.fingerprint, n, m), CGException);
+
+    // different tape
+    std::stringstream other(data);
+    ASSERT_THROW(cache2.read(other, cache.fingerprint + 1, n, m), CGException);
+
+    // corrupted dimensions are rejected before any allocation
+    SparsityCache huge = cache;
+    huge.range = std::numeric_limits<size_t>::max() / 2;
+    std::stringstream hugeStream;
+    huge.write(hugeStream);
+    ASSERT_THROW(cache2.read(hugeStream, cache.fingerprint, n, m), CGException);
+}
+
+TEST_F(CppADCGSparsityCacheTest, Fingerprint) {
+    std::unique_ptr<ADFun<CGD> > fun1 = tape(2.0);
+    std::unique_ptr<ADFun<CGD> > fun2 = tape(2.0);
+    std::unique_ptr<ADFun<CGD> > fun3 = tape(3.0);
+
+    ASSERT_EQ(tapeFingerprint(*fun1), tapeFingerprint(*fun2));
+    ASSERT_NE(tapeFingerprint(*fun1), tapeFingerprint(*fun3));
+}
+
+TEST_F(CppADCGSparsityCacheTest, ModelSources) {
+    std::string file = "sparsity_cache_model.cgsp";
+    std::remove(file.c_str());
+
+    std::unique_ptr<ADFun<CGD> > fun = tape(2.0);
+    uint64_t fingerprint = tapeFingerprint(*fun);
+
+    // the patterns are determined and saved
+    std::map<std::string, std::string> expected;
+    {
+        SparsityCacheSourceGen gen(*fun, "model");
+        configure(gen, file, JacobianADMode::Forward);
+        ASSERT_FALSE(gen.getSparsityCache()->hasJacobian);
+
+        expected = gen.sparsitySources();
+        ASSERT_EQ(expected.size(), 3u);
+    }
+
+    SparsityCache saved = loadCache(file, *fun);
+    ASSERT_TRUE(saved.matches(fingerprint, fun->Domain(), fun->Range()));
+    ASSERT_TRUE(saved.hasJacobian);
+    ASSERT_TRUE(saved.hasHessian);
+    ASSERT_TRUE(saved.hasHessians);
+
+    // the patterns are read from the file with different options
+    {
+        SparsityCacheSourceGen gen(*fun, "model");
+        configure(gen, file, JacobianADMode::Reverse);
+        SparsityCache* cache = gen.getSparsityCache();
+        ASSERT_TRUE(cache != nullptr);
+        ASSERT_TRUE(cache->hasJacobian);
+        ASSERT_TRUE(cache->hasHessian);
+        ASSERT_TRUE(cache->hasHessians);
+
+        ASSERT_EQ(gen.sparsitySources(), expected);
+    }
+
+    // a file created for a different tape is ignored and replaced
+    std::unique_ptr<ADFun<CGD> > fun2 = tape(3.0);
+    uint64_t fingerprint2 = tapeFingerprint(*fun2);
+    ASSERT_NE(fingerprint2, fingerprint);
+    {
+        SparsityCacheSourceGen gen(*fun2, "model");
+        configure(gen, file, JacobianADMode::Forward);
+        SparsityCache* cache = gen.getSparsityCache();
+        ASSERT_FALSE(cache->hasJacobian);
+        ASSERT_FALSE(cache->hasHessian);
+        ASSERT_EQ(cache->fingerprint, fingerprint2);
+
+        SparsityCacheSourceGen genNoCache(*fun2, "model");
+        configure(genNoCache, "", JacobianADMode::Forward);
+        ASSERT_TRUE(genNoCache.getSparsityCache() == nullptr);
+
+        ASSERT_EQ(gen.sparsitySources(), genNoCache.sparsitySources());
+    }
+
+    saved = loadCache(file, *fun2);
+    ASSERT_TRUE(saved.matches(fingerprint2, fun2->Domain(), fun2->Range()));
+
+    std::remove(file.c_str());
+}
+
+TEST_F(CppADCGSparsityCacheTest, CustomHessian) {
+    std::string file = "sparsity_cache_custom.cgsp";
+    std::remove(file.c_str());
+
+    std::unique_ptr<ADFun<CGD> > fun = tape(2.0);
+
+    std::vector<size_t> row{1, 2, 3};
+    std::vector<size_t> col{0, 2, 2};
+
+    // the CppAD methods only determine the custom elements of each equation
+    std::map<std::string, std::string> expected;
+    {
+        SparsityCacheSourceGen gen(*fun, "model");
+        configure(gen, file, JacobianADMode::Forward);
+        gen.setCustomSparseHessianElements(row, col);
+
+        expected = gen.sparsitySources();
+    }
+
+    SparsityCache saved = loadCache(file, *fun);
+    ASSERT_TRUE(saved.hasJacobian);
+    ASSERT_TRUE(saved.hasHessian);
+    ASSERT_FALSE(saved.hasHessians);
+
+    // the per equation patterns are determined again
+    {
+        SparsityCacheSourceGen gen(*fun, "model");
+        configure(gen, file, JacobianADMode::Forward);
+        gen.setCustomSparseHessianElements(row, col);
+        ASSERT_TRUE(gen.getSparsityCache()->hasHessian);
+        ASSERT_FALSE(gen.getSparsityCache()->hasHessians);
+
+        ASSERT_EQ(gen.sparsitySources(), expected);
+    }
+
+    std::remove(file.c_str());
+
+    // the operation graph provides the complete patterns of each equation
+    {
+        SparsityCacheSourceGen gen(*fun, "model");
+        configure(gen, file, JacobianADMode::Forward);
+        gen.setCustomSparseHessianElements(row, col);
+        gen.setSparsityFromGraph(true);
+
+        ASSERT_EQ(gen.sparsitySources(), expected);
+    }
+
+    saved = loadCache(file, *fun);
+    ASSERT_TRUE(saved.hasHessians);
+    ASSERT_EQ(saved.hessians.size(), fun->Range());
+
+    std::remove(file.c_str());
+}
+
+TEST_F(CppADCGSparsityCacheTest, UnwritableFile) {
+    std::unique_ptr<ADFun<CGD> > fun = tape(2.0);
+
+    SparsityCacheSourceGen genNoCache(*fun, "model");
+    configure(genNoCache, "", JacobianADMode::Forward);
+
+    // the sources are still generated when the cache cannot be saved
+    SparsityCacheSourceGen gen(*fun, "model");
+    configure(gen, "sparsity_cache_missing_dir/model.cgsp", JacobianADMode::Forward);
+
+    ASSERT_EQ(gen.sparsitySources(), genNoCache.sparsitySources());
+}
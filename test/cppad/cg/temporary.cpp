@@ -13,6 +13,7 @@
  * Author: Joao Leal
  */
 #include "CppADCGTest.hpp"
+#include "gccCompilerFlags.hpp"
 
 namespace CppAD {
 namespace cg {
@@ -36,20 +37,69 @@ public:
         size_t n = f.Domain();
         //size_t m = f.Range();
 
-        CodeHandler<double> handler(10 + n * n);
+        for (bool minimizeLiveTemps : {false, true}) {
+            CodeHandler<double> handler(10 + n * n);
+            handler.setMinimizeLiveTemporaries(minimizeLiveTemps);
 
-        vector<CGD> indVars(n);
+            vector<CGD> indVars(n);
+            handler.makeVariables(indVars);
+
+            vector<CGD> dep = f.Forward(0, indVars);
+
+            LanguageC<double> langC("double");
+            LangCDefaultVariableNameGenerator<double> nameGen;
+
+            handler.generateCode(std::cout, langC, dep, nameGen);
+
+            ASSERT_EQ(handler.getTemporaryVariableCount(), expectedTmp);
+            ASSERT_EQ(handler.getTemporaryArraySize(), expectedArraySize);
+        }
+    }
+
+    /**
+     * A model where the default evaluation order keeps many temporary
+     * variables alive: the values of exp(x[i]) are computed while the
+     * first sum is evaluated but they are only released by the second sum
+     */
+    static std::unique_ptr<ADFun<CGD> > twoSumsModel(size_t n) {
+        std::vector<ADCGD> x(n);
+        for (size_t i = 0; i < n; i++)
+            x[i] = 0.1 * (i + 1);
+        Independent(x);
+
+        std::vector<ADCGD> a(n);
+        for (size_t i = 0; i < n; i++)
+            a[i] = exp(x[i]);
+
+        std::vector<ADCGD> y(2);
+        y[0] = sin(a[0]);
+        y[1] = cos(a[0]);
+        for (size_t i = 1; i < n; i++) {
+            y[0] += sin(a[i]);
+            y[1] += cos(a[i]);
+        }
+
+        return std::unique_ptr<ADFun<CGD> >(new ADFun<CGD>(x, y));
+    }
+
+    static size_t countTemporaries(ADFun<CGD>& f,
+                                   bool minimizeLiveTemps) {
+        CodeHandler<double> handler;
+        handler.setMinimizeLiveTemporaries(minimizeLiveTemps);
+
+        std::vector<CGD> indVars(f.Domain());
         handler.makeVariables(indVars);
 
-        vector<CGD> dep = f.Forward(0, indVars);
+        std::vector<CGD> dep = f.Forward(0, indVars);
 
         LanguageC<double> langC("double");
+        langC.setMaxOperationsPerAssignment(1);
         LangCDefaultVariableNameGenerator<double> nameGen;
 
-        handler.generateCode(std::cout, langC, dep, nameGen);
+        std::ostringstream code;
+        handler.generateCode(code, langC, dep, nameGen);
 
-        ASSERT_EQ(handler.getTemporaryVariableCount(), expectedTmp);
-        ASSERT_EQ(handler.getTemporaryArraySize(), expectedArraySize);
+        return handler.getTemporaryVariableCount();
     }
 };
 
@@ -148,3 +198,67 @@ TEST_F(CppADCGTempTest, Temporary3) {
     ADFun<CGD> f(ind, dep);
     testModel(f, 1, 0);
 }
+
+TEST_F(CppADCGTempTest, MinimizeLiveTemporaries) {
+    size_t n = 8;
+    std::unique_ptr<ADFun<CGD> > f = twoSumsModel(n);
+
+    size_t tmpDefault = countTemporaries(*f, false);
+    size_t tmpMinimized = countTemporaries(*f, true);
+
+    // all the values of exp(x[i]) are alive at the end of the first sum
+    ASSERT_GT(tmpDefault, n);
+    ASSERT_LT(tmpMinimized, tmpDefault);
+}
+
+#ifdef CPPAD_CG_SYSTEM_LINUX
+TEST_F(CppADCGTempTest, MinimizeLiveTemporariesResults) {
+    size_t n = 8;
+    std::unique_ptr<ADFun<CGD> > f = twoSumsModel(n);
+
+    ModelCSourceGen<double> defaultGen(*f, "live_temps_default");
+    ModelCSourceGen<double> minimizedGen(*f, "live_temps_minimized");
+    for (ModelCSourceGen<double>* gen : {&defaultGen, &minimizedGen}) {
+        gen->setCreateForwardZero(true);
+        gen->setCreateSparseJacobian(true);
+        gen->setMaxOperationsPerAssignment(1);
+    }
+    minimizedGen.setMinimizeLiveTemporaries(true);
+
+    ModelLibraryCSourceGen<double> libSourceGen(defaultGen, minimizedGen);
+
+    DynamicModelLibraryProcessor<double> p(libSourceGen, "live_temps");
+
+    GccCompiler<double> compiler;
+    prepareTestCompilerFlags(compiler);
+
+    std::unique_ptr<DynamicLib<double>> dynamicLib = p.createDynamicLibrary(compiler);
+
+    const std::string zeroJob = "model (zero-order forward)";
+    ASSERT_LT(minimizedGen.getTemporaryVariableCount().at(zeroJob),
+              defaultGen.getTemporaryVariableCount().at(zeroJob));
+
+    std::unique_ptr<GenericModel<double>> defaultModel = dynamicLib->model("live_temps_default");
+    std::unique_ptr<GenericModel<double>> minimizedModel = dynamicLib->model("live_temps_minimized");
+    ASSERT_TRUE(defaultModel != nullptr);
+    ASSERT_TRUE(minimizedModel != nullptr);
+
+    std::vector<double> x(n);
+    for (size_t i = 0; i < n; i++)
+        x[i] = 0.05 * (i + 2);
+
+    std::vector<double> yDefault = defaultModel->ForwardZero(x);
+    std::vector<double> yMinimized = minimizedModel->ForwardZero(x);
+    ASSERT_EQ(yMinimized.size(), yDefault.size());
+    for (size_t i = 0; i < yDefault.size(); i++) {
+        ASSERT_NEAR(yMinimized[i], yDefault[i], 1e-10);
+    }
+
+    std::vector<double> jacDefault = defaultModel->SparseJacobian(x);
+    std::vector<double> jacMinimized = minimizedModel->SparseJacobian(x);
+    ASSERT_EQ(jacMinimized.size(), jacDefault.size());
+    for (size_t e = 0; e < jacDefault.size(); e++) {
+        ASSERT_NEAR(jacMinimized[e], jacDefault[e], 1e-10);
+    }
+}
+#endif